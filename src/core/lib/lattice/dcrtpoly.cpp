@@ -206,37 +206,38 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(const DggType& dgg, const shared_ptr<DCRTPol
     m_format = format;
     m_params = dcrtParams;
 
-    size_t vecSize = dcrtParams->GetParams().size();
-    m_vectors.reserve(vecSize);
-
-    //dgg generating random values
+    //dgg generating random values, once for all the towers
     std::shared_ptr<int32_t> dggValues = dgg.GenerateIntVector(dcrtParams->GetRingDimension());
+    SetSmallValues(dggValues.get());
+}
+
+template<typename VecType>
+void DCRTPolyImpl<VecType>::SetSmallValues(const int32_t *values)
+{
+    size_t vecSize = m_params->GetParams().size();
+    usint ringDimension = m_params->GetRingDimension();
+    m_vectors.clear();
+    m_vectors.reserve(vecSize);
 
     for(usint i = 0; i < vecSize; i++) {
 
-        NativeVector ilDggValues(dcrtParams->GetRingDimension(), dcrtParams->GetParams()[i]->GetModulus());
+        const NativeInteger &modulus = m_params->GetParams()[i]->GetModulus();
+        uint64_t q = modulus.ConvertToInt();
+        NativeVector ilValues(ringDimension, modulus);
+        uint64_t *entries = ilValues.GetData();
 
-        for(usint j = 0; j < dcrtParams->GetRingDimension(); j++) {
-            uint64_t    entry;
-            // if the random generated value is less than zero, then multiply it by (-1) and subtract the modulus of the current tower to set the coefficient
-            int64_t k = (dggValues.get())[j];
-            if (k < 0) {
-                k *= (-1);
-                entry = (uint64_t)dcrtParams->GetParams()[i]->GetModulus().ConvertToInt() - (uint64_t)k;
-            }
-            //if greater than or equal to zero, set it the value generated
-            else {
-                entry = k;
-            }
-            ilDggValues.at(j)=entry;
+        for(usint j = 0; j < ringDimension; j++) {
+            // negative values are lifted by the modulus of the current tower, without a branch
+            int64_t k = values[j];
+            entries[j] = (uint64_t)k + (q & -(uint64_t)(k < 0));
         }
 
-        PolyType ilvector(dcrtParams->GetParams()[i]);
-        ilvector.SetValues(ilDggValues, Format::COEFFICIENT); // the random values are set in coefficient format
+        PolyType ilvector(m_params->GetParams()[i]);
+        ilvector.SetValues(std::move(ilValues), Format::COEFFICIENT); // the random values are set in coefficient format
         if (m_format == Format::EVALUATION) {  // if the input format is evaluation, then once random values are set in coefficient format, switch the format to achieve what the caller asked for.
             ilvector.SwitchFormat();
         }
-        m_vectors.push_back(ilvector);
+        m_vectors.push_back(std::move(ilvector));
     }
 }
 
@@ -253,91 +254,83 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(DugType& dug, const shared_ptr<DCRTPolyImpl:
     for (usint i = 0; i < numberOfTowers; i++) {
 
         dug.SetModulus(dcrtParams->GetParams()[i]->GetModulus());
-        NativeVector vals(dug.GenerateVector(dcrtParams->GetRingDimension()));
         PolyType ilvector(dcrtParams->GetParams()[i]);
 
-        ilvector.SetValues(vals, Format::COEFFICIENT); // the random values are set in coefficient format
+        // the tower takes over the sampled vector, which is written once by the generator
+        ilvector.SetValues(dug.GenerateVector(dcrtParams->GetRingDimension()), Format::COEFFICIENT); // the random values are set in coefficient format
         if (m_format == Format::EVALUATION) {  // if the input format is evaluation, then once random values are set in coefficient format, switch the format to achieve what the caller asked for.
             ilvector.SwitchFormat();
         }
-        m_vectors.push_back(ilvector);
+        m_vectors.push_back(std::move(ilvector));
     }
 }
 
 template<typename VecType>
-DCRTPolyImpl<VecType>::DCRTPolyImpl(const BugType& bug, const shared_ptr<DCRTPolyImpl::Params> dcrtParams, Format format)
+DCRTPolyImpl<VecType>::DCRTPolyImpl(const PRNGSeed &seed, const shared_ptr<DCRTPolyImpl::Params> dcrtParams, Format format)
 {
 
     m_format = format;
     m_params = dcrtParams;
 
     size_t numberOfTowers = dcrtParams->GetParams().size();
-    m_vectors.reserve(numberOfTowers);
-
-    PolyType ilvector(bug,dcrtParams->GetParams()[0],COEFFICIENT);
+    usint ringDimension = dcrtParams->GetRingDimension();
+    m_vectors.resize(numberOfTowers);
 
+    // the towers use independent streams, so they can be expanded in parallel
+#pragma omp parallel for if(numberOfTowers > 1 && !omp_in_parallel())
     for (usint i = 0; i < numberOfTowers; i++) {
+        const NativeInteger &modulus = dcrtParams->GetParams()[i]->GetModulus();
+        NativeVector values(ringDimension, modulus);
+        ChaCha20Engine engine(seed, i);
+        engine.FillUniform(values.GetData(), ringDimension, modulus.ConvertToInt());
 
-        if (i > 0)
-            ilvector.SwitchModulus(dcrtParams->GetParams()[i]->GetModulus(),dcrtParams->GetParams()[i]->GetRootOfUnity());
-
-        auto newVector = ilvector;
-        if (m_format == Format::EVALUATION) {  // if the input format is evaluation, then once random values are set in coefficient format, switch the format to achieve what the caller asked for.
-            newVector.SwitchFormat();
-        }
-        m_vectors.push_back(newVector);
+        PolyType ilvector(dcrtParams->GetParams()[i]);
+        ilvector.SetValues(std::move(values), format);
+        m_vectors[i] = std::move(ilvector);
     }
 }
 
 template<typename VecType>
-DCRTPolyImpl<VecType>::DCRTPolyImpl(const TugType& tug, const shared_ptr<DCRTPolyImpl::Params> dcrtParams, Format format)
+DCRTPolyImpl<VecType>::DCRTPolyImpl(const BugType& bug, const shared_ptr<DCRTPolyImpl::Params> dcrtParams, Format format)
 {
 
     m_format = format;
     m_params = dcrtParams;
 
-    size_t numberOfTowers = dcrtParams->GetParams().size();
-    m_vectors.reserve(numberOfTowers);
+    //bug generating random values, once for all the towers
+    std::shared_ptr<int32_t> bugValues = bug.GenerateIntVector(dcrtParams->GetRingDimension());
+    SetSmallValues(bugValues.get());
+}
 
-    //tug generating random values
-    std::shared_ptr<int32_t> tugValues = tug.GenerateIntVector(dcrtParams->GetRingDimension());
+template<typename VecType>
+DCRTPolyImpl<VecType>::DCRTPolyImpl(const TugType& tug, const shared_ptr<DCRTPolyImpl::Params> dcrtParams, Format format)
+{
 
-    for (usint i = 0; i < numberOfTowers; i++) {
+    m_format = format;
+    m_params = dcrtParams;
 
-        NativeVector ilTugValues(dcrtParams->GetRingDimension(), dcrtParams->GetParams()[i]->GetModulus());
+    //tug generating random values
+    std::shared_ptr<int32_t> tugValues = tug.GenerateIntVector(dcrtParams->GetRingDimension());
+    SetSmallValues(tugValues.get());
+}
 
-        for(usint j = 0; j < dcrtParams->GetRingDimension(); j++) {
-            uint64_t    entry;
-            // if the random generated value is less than zero, then multiply it by (-1) and subtract the modulus of the current tower to set the coefficient
-            int64_t k = (tugValues.get())[j];
-            if(k < 0) {
-                k *= (-1);
-                entry = (uint64_t)dcrtParams->GetParams()[i]->GetModulus().ConvertToInt() - (uint64_t)k;
-            }
-            //if greater than or equal to zero, set it the value generated
-            else {
-                entry = k;
-            }
-            ilTugValues.at(j)=entry;
-        }
+template<typename VecType>
+DCRTPolyImpl<VecType>::DCRTPolyImpl(const CbgType& cbg, const shared_ptr<DCRTPolyImpl::Params> dcrtParams, Format format)
+{
 
-        PolyType ilvector(dcrtParams->GetParams()[i]);
-        ilvector.SetValues(ilTugValues, Format::COEFFICIENT); // the random values are set in coefficient format
-        if(m_format == Format::EVALUATION) {  // if the input format is evaluation, then once random values are set in coefficient format, switch the format to achieve what the caller asked for.
-            ilvector.SwitchFormat();
-        }
-        m_vectors.push_back(ilvector);
-    }
+    m_format = format;
+    m_params = dcrtParams;
 
+    //cbg generating random values, once for all the towers
+    std::shared_ptr<int32_t> cbgValues = cbg.GenerateIntVector(dcrtParams->GetRingDimension());
+    SetSmallValues(cbgValues.get());
 }
 
 /*Move constructor*/
 template<typename VecType>
-DCRTPolyImpl<VecType>::DCRTPolyImpl(const DCRTPolyImpl &&element)
+DCRTPolyImpl<VecType>::DCRTPolyImpl(DCRTPolyImpl &&element) noexcept
+    : m_params(std::move(element.m_params)), m_vectors(std::move(element.m_vectors)), m_format(element.m_format)
 {
-    m_format = element.m_format;
-    m_vectors = std::move(element.m_vectors);
-    m_params = std::move(element.m_params);
 }
 
 template<typename VecType>
@@ -345,7 +338,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::CloneParametersOnly() const
 {
 
     DCRTPolyImpl res(this->m_params, this->m_format);
-    return std::move(res);
+    return res;
 }
 
 template<typename VecType>
@@ -364,7 +357,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::CloneWithNoise(const DiscreteGaussi
 
     res = element;
 
-    return std::move(res);
+    return res;
 }
 
 // DESTRUCTORS
@@ -434,7 +427,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::BaseDecompose(usint ba
         DEBUG(i );
     DEBUG("</BaseDecompose.result>" );
 
-    return std::move(result);
+    return result;
 }
 
 template<typename VecType>
@@ -468,9 +461,8 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
             for ( usint k=0; k<m_vectors.size(); k++ ){
                 PolyType temp(input.m_vectors[i]);
                 if (i!=k) {
+                    // switched to evaluation representation below, in a single batch
                     temp.SwitchModulus(input.m_vectors[k].GetModulus(),input.m_vectors[k].GetRootOfUnity());
-                    // Switch to evaluation representation
-                    temp.SwitchFormat();
                 	currentDCRTPoly.m_vectors[k] = temp;
                 }
                 // saves an extra NTT
@@ -501,8 +493,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
                     currentDCRTPoly.m_vectors[k] = temp;
                 }
 
-                currentDCRTPoly.SwitchFormat();
-
+                // switched to evaluation representation below, in a single batch
                 result[j + i*nWindows] = std::move(currentDCRTPoly);
 
             }
@@ -510,7 +501,23 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
         }
     }
 
-    return std::move(result);
+    // all the towers of all the digits are transformed together
+    NTTBatch batch;
+    if (baseBits == 0) {
+        for (usint i = 0; i < m_vectors.size(); i++)
+            for (usint k = 0; k < m_vectors.size(); k++)
+                if (i != k)
+                    batch.Add(&result[i].m_vectors[k]);
+    }
+    else {
+        // towers with smaller moduli may have fewer digits, leaving some entries empty
+        for (usint i = 0; i < result.size(); i++)
+            if (result[i].m_vectors.size() > 0)
+                batch.Add(&result[i]);
+    }
+    batch.Run();
+
+    return result;
 }
 
 template<typename VecType>
@@ -562,7 +569,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::PowersOfBase(usint bas
         result.push_back( x );
     }
 
-    return std::move(result);
+    return result;
 }
 
 /*VECTOR OPERATIONS*/
@@ -575,7 +582,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::MultiplicativeInverse() const
     for (usint i = 0; i < m_vectors.size(); i++) {
         tmp.m_vectors[i] = m_vectors[i].MultiplicativeInverse();
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -586,7 +593,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ModByTwo() const
     for (usint i = 0; i < m_vectors.size(); i++) {
         tmp.m_vectors[i] = m_vectors[i].ModByTwo();
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -600,7 +607,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Plus(const DCRTPolyImpl &element) c
     for (usint i = 0; i < tmp.m_vectors.size(); i++) {
         tmp.m_vectors[i] += element.GetElementAtIndex (i);
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -613,7 +620,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Negate() const
         tmp.m_vectors.push_back(std::move(this->m_vectors.at(i).Negate()));
     }
 
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -627,7 +634,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Minus(const DCRTPolyImpl &element)
     for (usint i = 0; i < tmp.m_vectors.size(); i++) {
         tmp.m_vectors[i] -= element.GetElementAtIndex (i);
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -661,6 +668,100 @@ const DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator*=(const DCRTPolyImp
 
 }
 
+template<typename VecType>
+const DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::AddMulInPlace(const DCRTPolyImpl &a, const DCRTPolyImpl &b)
+{
+    if( m_vectors.size() != a.m_vectors.size() || m_vectors.size() != b.m_vectors.size() ) {
+        throw std::logic_error("tower size mismatch; cannot multiply and accumulate");
+    }
+
+#pragma omp parallel for
+    for (usint i = 0; i < m_vectors.size(); i++) {
+        m_vectors[i].AddMulInPlace(a.m_vectors[i], b.m_vectors[i]);
+    }
+    return *this;
+}
+
+template<typename VecType>
+const DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::SubMulInPlace(const DCRTPolyImpl &a, const DCRTPolyImpl &b)
+{
+    if( m_vectors.size() != a.m_vectors.size() || m_vectors.size() != b.m_vectors.size() ) {
+        throw std::logic_error("tower size mismatch; cannot multiply and subtract");
+    }
+
+#pragma omp parallel for
+    for (usint i = 0; i < m_vectors.size(); i++) {
+        m_vectors[i].SubMulInPlace(a.m_vectors[i], b.m_vectors[i]);
+    }
+    return *this;
+}
+
+template<typename VecType>
+const DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::AddInnerProductInPlace(
+    const std::vector<std::pair<const DCRTPolyImpl*, const DCRTPolyImpl*>> &terms)
+{
+    for (usint k = 0; k < terms.size(); k++) {
+        if( m_vectors.size() != terms[k].first->m_vectors.size() || m_vectors.size() != terms[k].second->m_vectors.size() ) {
+            throw std::logic_error("tower size mismatch; cannot compute inner product");
+        }
+    }
+
+#pragma omp parallel for
+    for (usint i = 0; i < m_vectors.size(); i++) {
+        std::vector<std::pair<const PolyType*, const PolyType*>> towers(terms.size());
+        for (usint k = 0; k < terms.size(); k++)
+            towers[k] = std::make_pair(&terms[k].first->m_vectors[i], &terms[k].second->m_vectors[i]);
+        m_vectors[i].AddInnerProductInPlace(towers);
+    }
+    return *this;
+}
+
+template<typename VecType>
+std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::TensorProduct(
+    const std::vector<DCRTPolyImpl> &a, const std::vector<DCRTPolyImpl> &b)
+{
+    if( a.empty() || b.empty() ) {
+        throw std::logic_error("cannot compute the tensor product of empty vectors");
+    }
+
+    const shared_ptr<Params> params = a[0].m_params;
+    usint nTowers = a[0].m_vectors.size();
+    for (const std::vector<DCRTPolyImpl> *v : { &a, &b }) {
+        for (usint i = 0; i < v->size(); i++) {
+            if( (*v)[i].m_vectors.size() != nTowers ) {
+                throw std::logic_error("tower size mismatch; cannot compute tensor product");
+            }
+            if( (*v)[i].m_format != EVALUATION ) {
+                throw std::logic_error("tensor product requires elements in EVALUATION format");
+            }
+        }
+    }
+
+    size_t size = a.size() + b.size() - 1;
+
+    // the towers of the outputs are left unallocated; each is allocated by its inner product
+    std::vector<DCRTPolyImpl> c;
+    c.reserve(size);
+    for (usint k = 0; k < size; k++)
+        c.push_back(DCRTPolyImpl(params, EVALUATION, false));
+
+#pragma omp parallel for schedule(dynamic)
+    for (usint t = 0; t < size*nTowers; t++) {
+        usint k = t / nTowers;
+        usint i = t % nTowers;
+
+        size_t jFirst = (k < b.size()) ? 0 : k - b.size() + 1;
+        size_t jLast = (k < a.size()) ? k : a.size() - 1;
+
+        std::vector<std::pair<const PolyType*, const PolyType*>> towers;
+        towers.reserve(jLast - jFirst + 1);
+        for (size_t j = jFirst; j <= jLast; j++)
+            towers.push_back(std::make_pair(&a[j].m_vectors[i], &b[k-j].m_vectors[i]));
+        c[k].m_vectors[i].AddInnerProductInPlace(towers);
+    }
+    return c;
+}
+
 template<typename VecType>
 bool DCRTPolyImpl<VecType>::operator==(const DCRTPolyImpl &rhs) const
 {
@@ -695,7 +796,7 @@ const DCRTPolyImpl<VecType> & DCRTPolyImpl<VecType>::operator=(const DCRTPolyImp
 }
 
 template<typename VecType>
-const DCRTPolyImpl<VecType> & DCRTPolyImpl<VecType>::operator=(DCRTPolyImpl&& rhs)
+const DCRTPolyImpl<VecType> & DCRTPolyImpl<VecType>::operator=(DCRTPolyImpl&& rhs) noexcept
 {
     if (this != &rhs) {
         m_vectors = std::move(rhs.m_vectors);
@@ -851,7 +952,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Plus(const Integer &element) const
     for (usint i = 0; i < tmp.m_vectors.size(); i++) {
         tmp.m_vectors[i] += element.ConvertToInt();
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -862,7 +963,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Minus(const Integer &element) const
     for (usint i = 0; i < tmp.m_vectors.size(); i++) {
         tmp.m_vectors[i] -= element.ConvertToInt();
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -878,7 +979,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(const DCRTPolyImpl & element)
         //ModMul multiplies and performs a mod operation on the results. The mod is the modulus of each tower.
         tmp.m_vectors[i] *= element.m_vectors[i];
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -890,7 +991,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(const Integer &element) const
     for (usint i = 0; i < m_vectors.size(); i++) {
         tmp.m_vectors[i] = tmp.m_vectors[i] * element.ConvertToInt(); // (element % Integer((*m_params)[i]->GetModulus().ConvertToInt())).ConvertToInt();
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -903,7 +1004,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(
     for (usint i = 0; i < m_vectors.size(); i++) {
         tmp.m_vectors[i] *= element[i]; // (element % Integer((*m_params)[i]->GetModulus().ConvertToInt())).ConvertToInt();
     }
-    return std::move(tmp);
+    return tmp;
 }
 
 template<typename VecType>
@@ -1206,7 +1307,7 @@ typename DCRTPolyImpl<VecType>::PolyLargeType DCRTPolyImpl<VecType>::CRTInterpol
 
     DEBUG("answer: " << polynomialReconstructed);
 
-    return std::move( polynomialReconstructed );
+    return polynomialReconstructed;
 }
 
 /*
@@ -1304,7 +1405,7 @@ typename DCRTPolyImpl<VecType>::PolyLargeType DCRTPolyImpl<VecType>::CRTInterpol
 
 	DEBUG("answer: " << polynomialReconstructed);
 
-	return std::move( polynomialReconstructed );
+	return polynomialReconstructed;
 }
 
 
@@ -1426,7 +1527,7 @@ DCRTPolyImpl<VecType>::ScaleAndRound(const NativeInteger &p,
     PolyType result( shared_ptr<typename PolyType::Params>( new typename PolyType::Params(GetCyclotomicOrder(), p.ConvertToInt(), 1) ) );
     result.SetValues(coefficients,COEFFICIENT);
 
-    return std::move(result);
+    return result;
 
 }
 
@@ -1509,7 +1610,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::SwitchCRTBasis(
 
     }
 
-    return std::move(ans);
+    return ans;
 
 }
 
@@ -1522,7 +1623,8 @@ template<typename VecType>
 void DCRTPolyImpl<VecType>::ExpandCRTBasis(const shared_ptr<DCRTPolyImpl::Params> paramsExpanded,
         const shared_ptr<DCRTPolyImpl::Params> params, const std::vector<NativeInteger> &qInvModqi,
         const std::vector<std::vector<NativeInteger>> &qDivqiModsi, const std::vector<NativeInteger> &qModsi,
-        const std::vector<DoubleNativeInteger> &siModulimu, const std::vector<NativeInteger> &qInvModqiPrecon) {
+        const std::vector<DoubleNativeInteger> &siModulimu, const std::vector<NativeInteger> &qInvModqiPrecon,
+        NTTBatch *batch) {
 
     std::vector<PolyType> polyInNTT;
 
@@ -1539,25 +1641,29 @@ void DCRTPolyImpl<VecType>::ExpandCRTBasis(const shared_ptr<DCRTPolyImpl::Params
 
     m_vectors.resize(newSize);
 
-#pragma omp parallel for
+    NTTBatch localBatch;
+    if (batch == NULL)
+        batch = &localBatch;
+
     // populate the towers corresponding to CRT basis S and convert them to evaluation representation
     for (size_t i = 0; i < polyWithSwitchedCRTBasis.m_vectors.size(); i++ ) {
-        m_vectors[size + i] = polyWithSwitchedCRTBasis.GetElementAtIndex(i);
-        m_vectors[size + i].SwitchFormat();
+        m_vectors[size + i] = std::move(polyWithSwitchedCRTBasis.m_vectors[i]);
+        batch->Add(&m_vectors[size + i]);
     }
 
     if (polyInNTT.size() > 0) // if the input polynomial was in evaluation representation, use the towers for Q from it
     {
         for (size_t i = 0; i < size; i++ )
-            m_vectors[i] = polyInNTT[i];
+            m_vectors[i] = std::move(polyInNTT[i]);
     }
     else
     { // else call NTT for the towers for Q
-#pragma omp parallel for
         for (size_t i = 0; i <size; i++ )
-            m_vectors[i].SwitchFormat();
+            batch->Add(&m_vectors[i]);
     }
 
+    localBatch.Run();
+
     m_format = EVALUATION;
 
     m_params = paramsExpanded;
@@ -1627,7 +1733,7 @@ DCRTPolyImpl<VecType>::ScaleAndRound(
     PolyType result( shared_ptr<typename PolyType::Params>( new typename PolyType::Params(GetCyclotomicOrder(), t.ConvertToInt(), 1) ) );
     result.SetValues(coefficients,COEFFICIENT);
 
-    return std::move(result);
+    return result;
 }
 
 //Source: Jean-Claude Bajard and Julien Eynard and Anwar Hasan and Vincent Zucca. A Full RNS Variant of FV like Somewhat Homomorphic Encryption Schemes. Cryptology ePrint Archive: Report 2016/510. (https://eprint.iacr.org/2016/510)
@@ -2081,22 +2187,51 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
             }
         }
 
-        return std::move(ans);
+        return ans;
 }
 
 /*Switch format calls IlVector2n's switchformat*/
 template<typename VecType>
 void DCRTPolyImpl<VecType>::SwitchFormat() {
-    if (m_format == COEFFICIENT) {
-        m_format = EVALUATION;
-    } else {
-        m_format = COEFFICIENT;
-    }
+    NTTBatch batch;
+    batch.Add(this);
+    batch.Run();
+}
 
-#pragma omp parallel for
-    for (usint i = 0; i < m_vectors.size(); i++) {
-        m_vectors[i].SwitchFormat();
+template<typename VecType>
+void DCRTPolyImpl<VecType>::SwitchFormat(const std::vector<DCRTPolyType*> &elements) {
+    NTTBatch batch;
+    for (usint i = 0; i < elements.size(); i++)
+        batch.Add(elements[i]);
+    batch.Run();
+}
+
+template<typename VecType>
+void DCRTPolyImpl<VecType>::NTTBatch::Add(DCRTPolyType *element) {
+    m_elements.push_back(element);
+    for (usint i = 0; i < element->m_vectors.size(); i++)
+        m_towers.push_back(&element->m_vectors[i]);
+}
+
+template<typename VecType>
+void DCRTPolyImpl<VecType>::NTTBatch::Add(PolyType *tower) {
+    m_towers.push_back(tower);
+}
+
+template<typename VecType>
+void DCRTPolyImpl<VecType>::NTTBatch::Run() {
+    for (usint i = 0; i < m_elements.size(); i++)
+        m_elements[i]->m_format = (m_elements[i]->m_format == COEFFICIENT) ? EVALUATION : COEFFICIENT;
+
+    // all the towers have the same cost, but dynamic scheduling keeps threads busy when
+    // the number of towers is not a multiple of the number of threads
+#pragma omp parallel for schedule(dynamic) if(m_towers.size() > 1 && !omp_in_parallel())
+    for (usint i = 0; i < m_towers.size(); i++) {
+        m_towers[i]->SwitchFormat();
     }
+
+    m_towers.clear();
+    m_elements.clear();
 }
 
 #ifdef OUT
@@ -2223,6 +2358,41 @@ bool DCRTPolyImpl<VecType>::Deserialize(const Serialized& serObj) {
     return ret;
 }
 
+// the towers share the parameters of the element, so only their values are written
+template<typename VecType>
+void DCRTPolyImpl<VecType>::SerializeBinary(BinaryWriter &writer) const {
+    m_params->SerializeBinary(writer);
+    writer.WriteU8(m_format);
+    writer.WriteU32(m_vectors.size());
+
+    for (size_t i = 0; i < m_vectors.size(); i++)
+        m_vectors[i].SerializeBinaryValues(writer);
+}
+
+template<typename VecType>
+void DCRTPolyImpl<VecType>::DeserializeBinary(BinaryReader &reader) {
+    shared_ptr<DCRTPolyImpl::Params> params(new DCRTPolyImpl::Params());
+    params->DeserializeBinary(reader);
+
+    uint8_t format = reader.ReadU8();
+    if (format != EVALUATION && format != COEFFICIENT)
+        PALISADE_THROW(deserialize_error, "DCRTPolyImpl::DeserializeBinary found an invalid format");
+
+    usint towers = reader.ReadU32();
+    if (towers != 0 && towers != params->GetParams().size())
+        PALISADE_THROW(deserialize_error, "DCRTPolyImpl::DeserializeBinary found a wrong number of towers");
+
+    m_params = params;
+    m_format = Format(format);
+    m_vectors.clear();
+    m_vectors.reserve(towers);
+    for (usint i = 0; i < towers; i++) {
+        PolyType tower(params->GetParams()[i], m_format, false);
+        tower.DeserializeBinaryValues(reader);
+        m_vectors.push_back(std::move(tower));
+    }
+}
+
 
 template<typename VecType>
 std::ostream& operator<<(std::ostream &os, const DCRTPolyImpl<VecType> & p) {
@@ -68,6 +68,7 @@ public:
 	typedef DiscreteUniformGeneratorImpl<NativeVector> DugType;
 	typedef TernaryUniformGeneratorImpl<NativeVector> TugType;
 	typedef BinaryUniformGeneratorImpl<NativeVector> BugType;
+	typedef CenteredBinomialGeneratorImpl<NativeVector> CbgType;
 
 	// this class contains an array of these:
 	using PolyType = PolyImpl<NativeVector>;
@@ -79,6 +80,48 @@ public:
 		return "DCRTPolyImpl";
 	}
 
+	/**
+	* @brief Batch of number theoretic transforms of individual towers, possibly belonging to
+	* many polynomials (for instance all the towers of all the elements of a ciphertext).
+	* The queued transforms are scheduled across the threads as a single parallel loop, so
+	* the threads are used even when a polynomial has fewer towers than there are threads.
+	* When the batch is run from inside a parallel region, it runs in the calling thread.
+	*/
+	class NTTBatch
+	{
+	public:
+		/**
+		* Queues the format switch of all the towers of a polynomial. The format of the
+		* polynomial itself is switched by Run(). The polynomial must not be resized or
+		* destroyed before the batch is run.
+		*
+		* @param element the polynomial to switch.
+		*/
+		void Add(DCRTPolyType *element);
+
+		/**
+		* Queues the format switch of a single tower. The caller is responsible for the
+		* format of the polynomial the tower belongs to.
+		*
+		* @param tower the tower to switch.
+		*/
+		void Add(PolyType *tower);
+
+		/**
+		* @return the number of queued tower transforms.
+		*/
+		size_t Size() const { return m_towers.size(); }
+
+		/**
+		* Runs all the queued transforms and empties the batch.
+		*/
+		void Run();
+
+	private:
+		std::vector<PolyType*> m_towers;
+		std::vector<DCRTPolyType*> m_elements;
+	};
+
 	// CONSTRUCTORS
 
 	/**
@@ -109,7 +152,7 @@ public:
 	DCRTPolyImpl(const DggType &dgg, const shared_ptr<Params> params, Format format = EVALUATION);
 
 	/**
-	* @brief Constructor based on binary distribution generator. This is not implemented. Will throw a logic_error.
+	* @brief Constructor based on binary distribution generator.
 	*
 	* @param &bug the input binary uniform generator. The bug will be the seed to populate the towers of the DCRTPoly with random numbers.
 	* @param params parameter set required for DCRTPoly.
@@ -126,6 +169,15 @@ public:
 	*/
 	DCRTPolyImpl(const TugType &tug, const shared_ptr<Params> params, Format format = EVALUATION);
 
+	/**
+	* @brief Constructor based on centered binomial distribution generator.
+	*
+	* @param &cbg the input centered binomial generator. One vector of samples is drawn and reduced into every tower.
+	* @param params parameter set required for DCRTPoly.
+	* @param format the input format fixed to EVALUATION. Format is a enum type that indicates if the polynomial is in Evaluation representation or Coefficient representation. It is defined in inttypes.h.
+	*/
+	DCRTPolyImpl(const CbgType &cbg, const shared_ptr<Params> params, Format format = EVALUATION);
+
 	/**
 	* @brief Constructor based on discrete uniform generator.
 	*
@@ -135,6 +187,16 @@ public:
 	*/
 	DCRTPolyImpl(DugType &dug, const shared_ptr<Params> params, Format format = EVALUATION);
 
+	/**
+	* @brief Constructor of a uniformly random element expanded from a seed. Tower i is expanded from
+	* the seed with ChaCha20 using i as the nonce, directly in the requested format.
+	*
+	* @param &seed the seed.
+	* @param params the input params.
+	* @param format the format of the element.
+	*/
+	DCRTPolyImpl(const PRNGSeed &seed, const shared_ptr<Params> params, Format format = EVALUATION);
+
 	/**
 	* @brief Construct using a single Poly. The Poly is copied into every tower. Each tower will be reduced to it's corresponding modulus  via GetModuli(at tower index). The format is derived from the passed in Poly.
 	*
@@ -212,9 +274,9 @@ public:
 	/**
 	* @brief Move constructor.
 	*
-	* @param &&element DCRTPoly to move from
+	* @param &&element DCRTPoly to move from; it is left without towers
 	*/
-	DCRTPolyImpl(const DCRTPolyType &&element);
+	DCRTPolyImpl(DCRTPolyType &&element) noexcept;
 
 	//CLONE OPERATIONS
 	/**
@@ -222,7 +284,7 @@ public:
 	 * @return new Element
 	 */
 	DCRTPolyType Clone() const {
-		return std::move(DCRTPolyImpl(*this));
+		return DCRTPolyImpl(*this);
 	}
 
 	/**
@@ -230,7 +292,7 @@ public:
 	 * @return new Element
 	 */
 	DCRTPolyType CloneEmpty() const {
-		return std::move( DCRTPolyImpl() );
+		return DCRTPolyImpl();
 	}
 
 	/**
@@ -403,10 +465,10 @@ public:
 	/**
 	* @brief Move Assignment Operator.
 	*
-	* @param &rhs the copied element.
+	* @param &&rhs the element to move from; it is left without towers
 	* @return the resulting element.
 	*/
-	const DCRTPolyType& operator=(DCRTPolyType &&rhs);
+	const DCRTPolyType& operator=(DCRTPolyType &&rhs) noexcept;
 
 	/**
 	* @brief Initalizer list
@@ -630,6 +692,46 @@ public:
 	*/
 	const DCRTPolyType& operator*=(const DCRTPolyType &element);
 
+	/**
+	* @brief Fused multiply-accumulate over all towers: this += a*b, without a temporary element.
+	*
+	* @param &a is the first element to multiply.
+	* @param &b is the second element to multiply.
+	* @return is the result of the operation.
+	*/
+	const DCRTPolyType& AddMulInPlace(const DCRTPolyType &a, const DCRTPolyType &b);
+
+	/**
+	* @brief Fused multiply-subtract over all towers: this -= a*b, without a temporary element.
+	*
+	* @param &a is the first element to multiply.
+	* @param &b is the second element to multiply.
+	* @return is the result of the operation.
+	*/
+	const DCRTPolyType& SubMulInPlace(const DCRTPolyType &a, const DCRTPolyType &b);
+
+	/**
+	* @brief Accumulates an inner product over all towers: this += sum_k terms[k].first * terms[k].second.
+	* The modular reductions are delayed, so each tower is reduced about once per coefficient
+	* rather than once per product.
+	*
+	* @param &terms are the pairs of elements to multiply.
+	* @return is the result of the operation.
+	*/
+	const DCRTPolyType& AddInnerProductInPlace(const std::vector<std::pair<const DCRTPolyType*, const DCRTPolyType*>> &terms);
+
+	/**
+	* @brief Tensor product of two vectors of elements, seen as polynomials with element coefficients:
+	* c[k] = sum_{i+j=k} a[i]*b[j]. Each tower of each output is an inner product with delayed modular
+	* reductions, and all of them are computed in a single parallel loop, so the threads are used
+	* even when the elements have few towers.
+	*
+	* @param &a is the first vector, in EVALUATION format.
+	* @param &b is the second vector, in EVALUATION format, with the parameters of the first one.
+	* @return the a.size()+b.size()-1 elements of the product.
+	*/
+	static std::vector<DCRTPolyType> TensorProduct(const std::vector<DCRTPolyType> &a, const std::vector<DCRTPolyType> &b);
+
 	/**
 	 * @brief Get value of element at index i.
 	 *
@@ -801,11 +903,14 @@ public:
 	* @param &qModsi a vector of precomputed integer factors q mod si for all si
 	* @param &siModulimu Barrett modulo reduction precomputations for si's
 	* @param &qInvModqiPrecon NTL precomputations for (q/qi)^{-1} mod q
+	* @param *batch if not NULL, the transforms to evaluation representation are queued in
+	* this batch instead of being run; the polynomial can only be used after batch->Run()
 	*/
 	void ExpandCRTBasis(const shared_ptr<Params> paramsQS, const shared_ptr<Params> params,
 			const std::vector<NativeInteger> &qInvModqi,
 			const std::vector<std::vector<NativeInteger>> &qDivqiModsi, const std::vector<NativeInteger> &qModsi,
-			const std::vector<DoubleNativeInteger> &siModulimu, const std::vector<NativeInteger> &qInvModqiPrecon);
+			const std::vector<DoubleNativeInteger> &siModulimu, const std::vector<NativeInteger> &qInvModqiPrecon,
+			NTTBatch *batch = NULL);
 
 	/**
 	 * @brief Computes Round(t/q*x) mod t for fast rounding in RNS
@@ -937,6 +1042,14 @@ public:
 	*/
 	void SwitchFormat();
 
+	/**
+	* @brief Convert several polynomials from Coefficient to CRT or vice versa; the transforms
+	* of all their towers are run as a single batch (see NTTBatch).
+	*
+	* @param &elements the polynomials to convert; each one switches from its own format.
+	*/
+	static void SwitchFormat(const std::vector<DCRTPolyType*> &elements);
+
 	/**
 	* @brief Switch modulus and adjust the values
 	*
@@ -991,6 +1104,10 @@ public:
 	*/
 	bool Deserialize(const Serialized& serObj);
 
+	void SerializeBinary(BinaryWriter &writer) const;
+
+	void DeserializeBinary(BinaryReader &reader);
+
 	/**
 	 * @brief ostream operator
 	 * @param os the input preceding output stream
@@ -1086,6 +1203,13 @@ public:
 	}
 
 private:
+
+	/**
+	 * @brief Sets every tower to the same vector of small signed integers, reduced by the modulus of the tower.
+	 *
+	 * @param values the integers, one per coefficient.
+	 */
+	void SetSmallValues(const int32_t *values);
 	
 	shared_ptr<Params> m_params;
 
@@ -224,7 +224,7 @@ namespace lbcrypto {
 
 		std::normal_distribution<> d(0, sigma);
 
-		std::mt19937 &g = PseudoRandomNumberGenerator::GetPRNG();
+		PRNGEngine &g = PseudoRandomNumberGenerator::GetPRNG();
 
 		std::vector<double> z(k);
 
@@ -25,6 +25,7 @@
  */
 #include "ildcrtparams.h"
 #include "../utils/serializablehelper.h"
+#include "../utils/exception.h"
 
 
 namespace lbcrypto
@@ -101,5 +102,38 @@ ILDCRTParams<IntType>::Deserialize(const Serialized& serObj)
 	return true;
 }
 
+template<typename IntType>
+void
+ILDCRTParams<IntType>::SerializeBinary(BinaryWriter &writer) const
+{
+	writer.WriteU32(m_parms.size());
+	for( size_t i = 0; i < m_parms.size(); i++ )
+		m_parms[i]->SerializeBinary(writer);
+	writer.WriteString(originalModulus.ToString());
+}
+
+template<typename IntType>
+void
+ILDCRTParams<IntType>::DeserializeBinary(BinaryReader &reader)
+{
+	usint towers = reader.ReadU32();
+	if( towers == 0 )
+		PALISADE_THROW(deserialize_error, "ILDCRTParams::DeserializeBinary found no towers");
+
+	m_parms.clear();
+	for( usint i = 0; i < towers; i++ ) {
+		std::shared_ptr<ILNativeParams> parms(new ILNativeParams());
+		parms->DeserializeBinary(reader);
+		m_parms.push_back(parms);
+	}
+	originalModulus = IntType(reader.ReadString());
+
+	this->cyclotomicOrder = this->m_parms[0]->GetCyclotomicOrder();
+	this->ringDimension = this->m_parms[0]->GetRingDimension();
+	this->isPowerOfTwo = this->ringDimension == this->cyclotomicOrder / 2;
+
+	RecalculateModulus();
+}
+
 
 }
@@ -247,6 +247,18 @@ public:
 
 	bool Deserialize(const Serialized& serObj);
 
+	/**
+	 * @brief Writes the object in the compact binary format
+	 * @param writer the binary object being written
+	 */
+	void SerializeBinary(BinaryWriter &writer) const;
+
+	/**
+	 * @brief Populates the object from the compact binary format
+	 * @param reader the binary object being read
+	 */
+	void DeserializeBinary(BinaryReader &reader);
+
 	/**
 	 * @brief Equality operator checks if the ElemParams are the same.
 	 *
@@ -32,6 +32,7 @@
 #include "../math/nbtheory.h"
 #include "../math/discretegaussiangenerator.h"
 #include "../encoding/encodingparams.h"
+#include "../utils/binaryserialization.h"
 
 namespace lbcrypto
 {
@@ -423,6 +424,22 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Writes the element in the compact binary format: its parameters, its format and
+	 * its values bit-packed to the bit length of the modulus.
+	 *
+	 * @param writer the binary object being written.
+	 */
+	virtual void SerializeBinary(BinaryWriter &writer) const = 0;
+
+	/**
+	 * @brief Populates the element from the compact binary format.
+	 *
+	 * @param reader the binary object being read.
+	 * @throws deserialize_error if the element is malformed.
+	 */
+	virtual void DeserializeBinary(BinaryReader &reader) = 0;
+
 };
 
 } // namespace lbcrypto ends
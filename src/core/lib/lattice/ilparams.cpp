@@ -109,9 +109,52 @@ bool ILParamsImpl<IntType>::Deserialize(const Serialized& serObj)
 	this->rootOfUnity = RootOfUnity;
 	this->bigCiphertextModulus = BigCtModulus;
 	this->bigRootOfUnity = BigRootOfUnity;
+	ResetNTTTables();
 
 	return true;
 }
 
+// the integers of the parameters are written as strings, except native ones
+template<typename IntType>
+static void WriteParamsInteger(BinaryWriter &writer, const IntType &value) {
+	writer.WriteString(value.ToString());
+}
+
+inline void WriteParamsInteger(BinaryWriter &writer, const NativeInteger &value) {
+	writer.WriteU64(value.ConvertToInt());
+}
+
+template<typename IntType>
+static void ReadParamsInteger(BinaryReader &reader, IntType *value) {
+	*value = IntType(reader.ReadString());
+}
+
+inline void ReadParamsInteger(BinaryReader &reader, NativeInteger *value) {
+	*value = NativeInteger(reader.ReadU64());
+}
+
+template<typename IntType>
+void ILParamsImpl<IntType>::SerializeBinary(BinaryWriter &writer) const
+{
+	writer.WriteU32(this->cyclotomicOrder);
+	writer.WriteU32(this->ringDimension);
+	WriteParamsInteger(writer, this->ciphertextModulus);
+	WriteParamsInteger(writer, this->rootOfUnity);
+	WriteParamsInteger(writer, this->bigCiphertextModulus);
+	WriteParamsInteger(writer, this->bigRootOfUnity);
+}
+
+template<typename IntType>
+void ILParamsImpl<IntType>::DeserializeBinary(BinaryReader &reader)
+{
+	this->cyclotomicOrder = reader.ReadU32();
+	this->ringDimension = reader.ReadU32();
+	this->isPowerOfTwo = this->ringDimension == this->cyclotomicOrder / 2;
+	ReadParamsInteger(reader, &this->ciphertextModulus);
+	ReadParamsInteger(reader, &this->rootOfUnity);
+	ReadParamsInteger(reader, &this->bigCiphertextModulus);
+	ReadParamsInteger(reader, &this->bigRootOfUnity);
+	ResetNTTTables();
+}
 
 } // namespace lbcrypto ends
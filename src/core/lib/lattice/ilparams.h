@@ -30,7 +30,11 @@
 #include "../lattice/elemparams.h"
 #include "../math/backend.h"
 #include "../utils/inttypes.h"
+#include "../utils/binaryserialization.h"
 #include "../math/nbtheory.h"
+#include "../math/transfrm.h"
+#include <atomic>
+#include <mutex>
 
 namespace lbcrypto
 {
@@ -45,6 +49,7 @@ class ILParamsImpl : public ElemParams<IntType>
 {
 public:
 	typedef IntType Integer;
+	typedef typename VectorTypeOf<IntType>::type Vector;
 
 	/**
 	 * Constructor that initializes nothing.
@@ -92,6 +97,7 @@ public:
 	 */
 	const ILParamsImpl& operator=(const ILParamsImpl &rhs) {
 		ElemParams<IntType>::operator=(rhs);
+		ResetNTTTables();
 		return *this;
 	}
 
@@ -120,7 +126,40 @@ public:
 		return ElemParams<IntType>::operator==(rhs);
 	}
 
+	/**
+	 * @brief Returns the twiddle factor tables of the NTT for these parameters.
+	 * The tables are fetched from the ChineseRemainderTransformFTT registry on first use and
+	 * then kept here, so later transforms need no lookup at all.
+	 *
+	 * @return the NTT tables.
+	 */
+	const NTTTables<Vector>& GetNTTTables() const {
+		const NTTTables<Vector> *tables = m_nttTablesPtr.load(std::memory_order_acquire);
+		if (tables == NULL) {
+			std::lock_guard<std::mutex> lock(m_nttTablesMutex);
+			if (m_nttTables == nullptr) {
+				m_nttTables = ChineseRemainderTransformFTT<Vector>::GetNTTTables(this->rootOfUnity,
+						this->cyclotomicOrder, this->ciphertextModulus);
+				m_nttTablesPtr.store(m_nttTables.get(), std::memory_order_release);
+			}
+			tables = m_nttTables.get();
+		}
+		return *tables;
+	}
+
 private:
+	// drops the cached tables after the parameters change
+	void ResetNTTTables() {
+		std::lock_guard<std::mutex> lock(m_nttTablesMutex);
+		m_nttTablesPtr.store(NULL, std::memory_order_release);
+		m_nttTables.reset();
+	}
+
+	mutable std::shared_ptr<const NTTTables<Vector>> m_nttTables;
+	mutable std::atomic<const NTTTables<Vector>*> m_nttTablesPtr{NULL};
+	mutable std::mutex m_nttTablesMutex;
+
+
 	std::ostream& doprint(std::ostream& out) const {
 		out << "ILParams ";
 		ElemParams<IntType>::doprint(out);
@@ -142,6 +181,18 @@ public:
 	 * @return true on success
 	 */
 	bool Deserialize(const Serialized& serObj);
+
+	/**
+	 * @brief Writes the object in the compact binary format
+	 * @param writer the binary object being written
+	 */
+	void SerializeBinary(BinaryWriter &writer) const;
+
+	/**
+	 * @brief Populates the object from the compact binary format
+	 * @param reader the binary object being read
+	 */
+	void DeserializeBinary(BinaryReader &reader);
 };
 
 
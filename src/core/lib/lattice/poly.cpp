@@ -116,6 +116,20 @@ PolyImpl<VecType>::PolyImpl( DiscreteUniformGeneratorImpl<VecType> &dug, const s
 
 }
 
+template<typename VecType>
+PolyImpl<VecType>::PolyImpl(const PRNGSeed &seed, const shared_ptr<PolyImpl::Params> params, Format format)
+{
+
+	m_params = params;
+
+	ChaCha20Engine engine(seed);
+	DugType dug;
+	dug.SetModulus(params->GetModulus());
+	m_values = make_unique<VecType>(dug.GenerateVector(params->GetRingDimension(), engine));
+	m_format = format;
+
+}
+
 template<typename VecType>
 PolyImpl<VecType>::PolyImpl(const BinaryUniformGeneratorImpl<VecType> &bug, const shared_ptr<PolyImpl::Params> params, Format format)
 {
@@ -148,6 +162,21 @@ PolyImpl<VecType>::PolyImpl(const TernaryUniformGeneratorImpl<VecType> &tug, con
 
 }
 
+template<typename VecType>
+PolyImpl<VecType>::PolyImpl(const CenteredBinomialGeneratorImpl<VecType> &cbg, const shared_ptr<PolyImpl::Params> params, Format format)
+{
+
+	m_params = params;
+
+	usint vectorSize = params->GetRingDimension();
+	m_values = make_unique<VecType>(cbg.GenerateVector(vectorSize, params->GetModulus()));
+	m_format = COEFFICIENT;
+
+	if (format == EVALUATION)
+		this->SwitchFormat();
+
+}
+
 template<typename VecType>
 PolyImpl<VecType>::PolyImpl(const PolyImpl &element, shared_ptr<PolyImpl::Params>) : m_format(element.m_format), m_params(element.m_params)
 {
@@ -192,23 +221,9 @@ PolyImpl<VecType>::PolyImpl(
 
 //this is the move
 template<typename VecType>
-PolyImpl<VecType>::PolyImpl(PolyImpl &&element, shared_ptr<PolyImpl::Params>) : m_format(element.m_format), m_params(element.m_params)
-//m_values(element.m_values) //note this becomes move below
+PolyImpl<VecType>::PolyImpl(PolyImpl &&element, shared_ptr<PolyImpl::Params>) noexcept
+	: m_values(std::move(element.m_values)), m_format(element.m_format), m_params(element.m_params)
 {
-	bool dbg_flag = false;
-	if (!IsEmpty()){
-		DEBUG("in ctor && m_values was "<<*m_values);
-	}else{
-		DEBUG("in ctor && m_values was empty");
-	}
-	if (!element.IsEmpty()) {
-		m_values = std::move(element.m_values);
-		DEBUG("in ctor && m_values was "<<*m_values);
-
-	} else{
-		DEBUG("in ctor && m_values remains empty");
-		m_values = nullptr;
-	}
 }
 
 template<typename VecType>
@@ -403,7 +418,7 @@ const PolyImpl<VecType>& PolyImpl<VecType>::operator=(std::initializer_list<std:
 
 
 template<typename VecType>
-const PolyImpl<VecType>& PolyImpl<VecType>::operator=(PolyImpl &&rhs)
+const PolyImpl<VecType>& PolyImpl<VecType>::operator=(PolyImpl &&rhs) noexcept
 {
 
 	if (this != &rhs) {
@@ -509,6 +524,19 @@ void PolyImpl<VecType>::SetValues(const VecType& values, Format format)
 	m_format = format;
 }
 
+template<typename VecType>
+void PolyImpl<VecType>::SetValues(VecType&& values, Format format)
+{
+	if (m_params->GetRootOfUnity() == Integer(0)){
+		PALISADE_THROW(type_error, "Polynomial has a 0 root of unity");
+	}
+	if (m_params->GetRingDimension() != values.GetLength() || m_params->GetModulus() != values.GetModulus()) {
+		PALISADE_THROW(type_error, "Parameter mismatch on SetValues for Polynomial");
+	}
+	m_values = make_unique<VecType>(std::move(values));
+	m_format = format;
+}
+
 template<typename VecType>
 void PolyImpl<VecType>::SetValuesToZero()
 {
@@ -535,7 +563,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Plus(const Integer &element) const
 		tmp.SetValues( GetValues().ModAddAtIndex(0, element), this->m_format );
 	else
 		tmp.SetValues( GetValues().ModAdd(element), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -543,7 +571,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Minus(const Integer &element) const
 {
 	PolyImpl<VecType> tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().ModSub(element), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -551,7 +579,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Times(const Integer &element) const
 {
 	PolyImpl<VecType> tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().ModMul(element), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -559,7 +587,7 @@ PolyImpl<VecType> PolyImpl<VecType>::MultiplyAndRound(const Integer &p, const In
 {
 	PolyImpl<VecType> tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().MultiplyAndRound(p, q), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -567,7 +595,7 @@ PolyImpl<VecType> PolyImpl<VecType>::DivideAndRound(const Integer &q) const
 {
 	PolyImpl<VecType> tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().DivideAndRound(q), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -578,7 +606,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Negate() const
 
 	PolyImpl<VecType> tmp( *this );
 	*tmp.m_values = m_values->ModMul(this->m_params->GetModulus() - Integer(1));
-	return std::move( tmp );
+	return tmp;
 }
 
 // VECTOR OPERATIONS
@@ -588,7 +616,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Plus(const PolyImpl &element) const
 {
 	PolyImpl tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().ModAdd(*element.m_values), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -596,7 +624,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Minus(const PolyImpl &element) const
 {
 	PolyImpl<VecType> tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().ModSub(*element.m_values), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -610,7 +638,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Times(const PolyImpl &element) const
 
 	PolyImpl<VecType> tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().ModMul(*element.m_values), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 // TODO: check if the parms tests here should be done in regular op as well as op=? or in neither place?
@@ -669,6 +697,68 @@ const PolyImpl<VecType>& PolyImpl<VecType>::operator*=(const PolyImpl &element)
 	return *this;
 }
 
+template<typename VecType>
+void PolyImpl<VecType>::CheckFusedOperand(const PolyImpl &element, const char *name) const
+{
+	if (m_format != Format::EVALUATION || element.m_format != Format::EVALUATION)
+		throw std::logic_error(std::string(name) + " for PolyImpl is supported only in EVALUATION format.\n");
+
+	if (!(*this->m_params == *element.m_params))
+		throw std::logic_error(std::string(name) + " called on PolyImpl's with different params.");
+}
+
+template<typename VecType>
+const PolyImpl<VecType>& PolyImpl<VecType>::AddMulInPlace(const PolyImpl &a, const PolyImpl &b)
+{
+	CheckFusedOperand(a, "AddMulInPlace");
+	CheckFusedOperand(b, "AddMulInPlace");
+
+	if (m_values == nullptr) {
+		// act as tho this is 0
+		m_values = make_unique<VecType>(m_params->GetRingDimension(), m_params->GetModulus());
+	}
+
+	m_values->AddMulInPlace(*a.m_values, *b.m_values);
+
+	return *this;
+}
+
+template<typename VecType>
+const PolyImpl<VecType>& PolyImpl<VecType>::SubMulInPlace(const PolyImpl &a, const PolyImpl &b)
+{
+	CheckFusedOperand(a, "SubMulInPlace");
+	CheckFusedOperand(b, "SubMulInPlace");
+
+	if (m_values == nullptr) {
+		// act as tho this is 0
+		m_values = make_unique<VecType>(m_params->GetRingDimension(), m_params->GetModulus());
+	}
+
+	m_values->SubMulInPlace(*a.m_values, *b.m_values);
+
+	return *this;
+}
+
+template<typename VecType>
+const PolyImpl<VecType>& PolyImpl<VecType>::AddInnerProductInPlace(const std::vector<std::pair<const PolyImpl*, const PolyImpl*>> &terms)
+{
+	std::vector<std::pair<const VecType*, const VecType*>> vectors(terms.size());
+	for (size_t k = 0; k < terms.size(); k++) {
+		CheckFusedOperand(*terms[k].first, "AddInnerProductInPlace");
+		CheckFusedOperand(*terms[k].second, "AddInnerProductInPlace");
+		vectors[k] = std::make_pair(terms[k].first->m_values.get(), terms[k].second->m_values.get());
+	}
+
+	if (m_values == nullptr) {
+		// act as tho this is 0
+		m_values = make_unique<VecType>(m_params->GetRingDimension(), m_params->GetModulus());
+	}
+
+	m_values->AddInnerProductInPlace(vectors);
+
+	return *this;
+}
+
 template<typename VecType>
 void PolyImpl<VecType>::AddILElementOne()
 {
@@ -778,7 +868,7 @@ PolyImpl<VecType> PolyImpl<VecType>::MultiplicativeInverse() const
 	PolyImpl tmp = CloneParametersOnly();
 	if (InverseExists()) {
 		tmp.SetValues( GetValues().ModInverse(), this->m_format );
-		return std::move( tmp );
+		return tmp;
 	} else {
 		throw std::logic_error("PolyImpl has no inverse\n");
 	}
@@ -789,7 +879,7 @@ PolyImpl<VecType> PolyImpl<VecType>::ModByTwo() const
 {
 	PolyImpl tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().ModByTwo(), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -797,7 +887,7 @@ PolyImpl<VecType> PolyImpl<VecType>::Mod(const Integer & modulus) const
 {
 	PolyImpl tmp = CloneParametersOnly();
 	tmp.SetValues( GetValues().Mod(modulus), this->m_format );
-	return std::move( tmp );
+	return tmp;
 }
 
 template<typename VecType>
@@ -825,24 +915,20 @@ void PolyImpl<VecType>::SwitchFormat()
 		return;
 	}
 
-	VecType newValues(m_params->GetCyclotomicOrder()/ 2);
-
 	if (m_format == COEFFICIENT) {
 		m_format = EVALUATION;
 
 		DEBUG("transform to evaluation m_values was"<< *m_values);
 
-		ChineseRemainderTransformFTT<VecType>::ForwardTransform(*m_values, m_params->GetRootOfUnity(), m_params->GetCyclotomicOrder(), &newValues);
-		DEBUG("m_values now "<< newValues);
+		ChineseRemainderTransformFTT<VecType>::ForwardTransformInPlace(m_values.get(), m_params->GetNTTTables());
+		DEBUG("m_values now "<< *m_values);
 	} else {
 		m_format = COEFFICIENT;
 		DEBUG("transform to coefficient m_values was"<< *m_values);
 
-		ChineseRemainderTransformFTT<VecType>::InverseTransform(*m_values, m_params->GetRootOfUnity(), m_params->GetCyclotomicOrder(), &newValues);
-		DEBUG("m_values now "<< newValues);
+		ChineseRemainderTransformFTT<VecType>::InverseTransformInPlace(m_values.get(), m_params->GetNTTTables());
+		DEBUG("m_values now "<< *m_values);
 	}
-
-	*m_values = newValues;
 }
 
 template<typename VecType>
@@ -1031,7 +1117,7 @@ std::vector<PolyImpl<VecType>> PolyImpl<VecType>::BaseDecompose(usint baseBits,
 	}
 	DEBUG("</result>" );
 
-	return std::move(result);
+	return result;
 }
 
 // Generate a vector of PolyImpl's as {x, base*x, base^2*x, ..., base^{\lfloor {\log q/base} \rfloor}*x, where x is the current PolyImpl object;
@@ -1058,7 +1144,7 @@ std::vector<PolyImpl<VecType>> PolyImpl<VecType>::PowersOfBase(usint baseBits) c
 		result.push_back(pI*(*this));
 	}
 
-	return std::move(result);
+	return result;
 
 }
 
@@ -1076,7 +1162,7 @@ PolyImpl<VecType>::DecryptionCRTInterpolate(PlaintextModulus ptm) const {
 		interp[i] = smaller[i].ConvertToInt();
 	}
 
-	return std::move( interp );
+	return interp;
 }
 
 // JSON FACILITY - Serialize Operation
@@ -1150,4 +1236,101 @@ bool PolyImpl<VecType>::Deserialize(const Serialized& serObj) {
 	return true;
 }
 
+// values modulo q are packed to ceil(log2 q) bits
+template<typename IntType>
+static usint PackedBits(const IntType &modulus) {
+	return (modulus - IntType(1)).GetMSB();
+}
+
+// arbitrary precision values are packed 32 bits at a time, low bits first
+template<typename VecType>
+static void WritePackedValues(BinaryWriter &writer, const VecType &values, usint bits) {
+	typedef typename VecType::Integer IntType;
+	const IntType chunkModulus(uint64_t(1) << 32);
+
+	for (usint i = 0; i < values.GetLength(); i++) {
+		IntType value(values[i]);
+		for (usint bit = 0; bit < bits; bit += 32) {
+			writer.WriteBits(value.Mod(chunkModulus).ConvertToInt(), std::min<usint>(32, bits - bit));
+			value >>= 32;
+		}
+		if (value != IntType(0))
+			PALISADE_THROW(serialize_error, "Value does not fit in " + std::to_string(bits) + " bits");
+	}
+	writer.FlushBits();
+}
+
+inline void WritePackedValues(BinaryWriter &writer, const NativeVector &values, usint bits) {
+	writer.WritePacked(values.GetData(), values.GetLength(), bits);
+}
+
+template<typename VecType>
+static void ReadPackedValues(BinaryReader &reader, VecType *values, usint bits) {
+	typedef typename VecType::Integer IntType;
+
+	for (usint i = 0; i < values->GetLength(); i++) {
+		IntType value(0);
+		for (usint bit = 0; bit < bits; bit += 32)
+			value += IntType(reader.ReadBits(std::min<usint>(32, bits - bit))) << bit;
+		if (value >= values->GetModulus())
+			PALISADE_THROW(deserialize_error, "Value is not reduced modulo the modulus");
+		(*values)[i] = value;
+	}
+	reader.FlushBits();
+}
+
+inline void ReadPackedValues(BinaryReader &reader, NativeVector *values, usint bits) {
+	uint64_t *data = values->GetData();
+	reader.ReadPacked(data, values->GetLength(), bits);
+
+	const uint64_t modulus = values->GetModulus().ConvertToInt();
+	bool reduced = true;
+	for (usint i = 0; i < values->GetLength(); i++)
+		reduced &= data[i] < modulus;
+	if (!reduced)
+		PALISADE_THROW(deserialize_error, "Value is not reduced modulo the modulus");
+}
+
+template<typename VecType>
+void PolyImpl<VecType>::SerializeBinary(BinaryWriter &writer) const {
+	m_params->SerializeBinary(writer);
+	SerializeBinaryValues(writer);
+}
+
+template<typename VecType>
+void PolyImpl<VecType>::DeserializeBinary(BinaryReader &reader) {
+	shared_ptr<PolyImpl::Params> params(new PolyImpl::Params());
+	params->DeserializeBinary(reader);
+	m_params = params;
+	DeserializeBinaryValues(reader);
+}
+
+template<typename VecType>
+void PolyImpl<VecType>::SerializeBinaryValues(BinaryWriter &writer) const {
+	writer.WriteU8(m_format);
+	writer.WriteU8(m_values != nullptr);
+	if (m_values == nullptr)
+		return;
+
+	if (m_values->GetLength() != m_params->GetRingDimension() || m_values->GetModulus() != m_params->GetModulus())
+		PALISADE_THROW(serialize_error, "PolyImpl::SerializeBinary values do not match the parameters");
+	WritePackedValues(writer, *m_values, PackedBits(m_params->GetModulus()));
+}
+
+template<typename VecType>
+void PolyImpl<VecType>::DeserializeBinaryValues(BinaryReader &reader) {
+	uint8_t format = reader.ReadU8();
+	if (format != EVALUATION && format != COEFFICIENT)
+		PALISADE_THROW(deserialize_error, "PolyImpl::DeserializeBinary found an invalid format");
+	m_format = Format(format);
+
+	if (reader.ReadU8() == 0) {
+		m_values.reset();
+		return;
+	}
+
+	m_values = make_unique<VecType>(m_params->GetRingDimension(), m_params->GetModulus());
+	ReadPackedValues(reader, m_values.get(), PackedBits(m_params->GetModulus()));
+}
+
 } // namespace lbcrypto ends
@@ -68,6 +68,7 @@ public:
 	typedef DiscreteUniformGeneratorImpl<VecType> DugType;
 	typedef TernaryUniformGeneratorImpl<VecType> TugType;
 	typedef BinaryUniformGeneratorImpl<VecType> BugType;
+	typedef CenteredBinomialGeneratorImpl<VecType> CbgType;
 	typedef PolyImpl<NativeVector> PolyNative;
 	typedef PolyImpl<VecType> PolyLargeType;
 
@@ -129,6 +130,15 @@ public:
 	 */
 	PolyImpl(const TugType &tug, const shared_ptr<Params> params, Format format = EVALUATION);
 
+	/**
+	 * @brief Construct with a vector from a given generator
+	 *
+	 * @param &cbg the input Centered Binomial Generator.
+	 * @param &params the input params.
+	 * @param format - EVALUATION or COEFFICIENT
+	 */
+	PolyImpl(const CbgType &cbg, const shared_ptr<Params> params, Format format = EVALUATION);
+
 	/**
 	 * @brief Construct with a vector from a given generator
 	 *
@@ -138,6 +148,17 @@ public:
 	 */
 	PolyImpl( DugType &dug, const shared_ptr<Params> params, Format format = EVALUATION);
 
+	/**
+	 * @brief Construct a uniformly random element expanded from a seed with ChaCha20.
+	 * The same seed and parameters always give the same element. As a uniform element is
+	 * also uniform in the other format, the values are sampled directly in the requested format.
+	 *
+	 * @param &seed the seed.
+	 * @param &params the input params.
+	 * @param format - EVALUATION or COEFFICIENT
+	 */
+	PolyImpl(const PRNGSeed &seed, const shared_ptr<Params> params, Format format = EVALUATION);
+
 	/**
 	 * @brief Create lambda that allocates a zeroed element for the case when it is called from a templated class
 	 * @param params the params to use.
@@ -200,17 +221,17 @@ public:
 	/**
 	 * @brief Move constructor.
 	 *
-	 * @param &&element the copied element.
+	 * @param &&element the element to move from; it keeps its parameters but loses its values.
 	 * @param parms ILParams instance that is is passed.
 	 */
-	PolyImpl(PolyType &&element, shared_ptr<Params> parms = 0);
+	PolyImpl(PolyType &&element, shared_ptr<Params> parms = 0) noexcept;
 
 	/**
 	 * @brief Clone the object by making a copy of it and returning the copy
 	 * @return new Element
 	 */
 	PolyType Clone() const {
-		return std::move(PolyImpl(*this));
+		return PolyImpl(*this);
 	}
 
 	/**
@@ -218,7 +239,7 @@ public:
 	 * @return new Element
 	 */
 	PolyType CloneEmpty() const {
-		return std::move( PolyImpl() );
+		return PolyImpl();
 	}
 
 	/**
@@ -256,7 +277,7 @@ public:
 	 * @param &rhs the PolyImpl to be copied.
 	 * @return the resulting PolyImpl.
 	 */
-	const PolyType& operator=(PolyType &&rhs);
+	const PolyType& operator=(PolyType &&rhs) noexcept;
 
 	/**
 	 * @brief Initalizer list
@@ -398,6 +419,14 @@ public:
 	 */
 	void SetValues(const VecType& values, Format format);
 
+	/**
+	 * @brief Set method of the values, taking over the storage of the vector.
+	 *
+	 * @param values is the set of values of the vector.
+	 * @param format is the format, either COEFFICIENT or EVALUATION.
+	 */
+	void SetValues(VecType&& values, Format format);
+
 	/**
 	 * @brief Sets all values of element to zero.
 	 */
@@ -524,6 +553,36 @@ public:
 	 */
 	const PolyImpl& operator*=(const PolyImpl &element);
 
+	/**
+	 * @brief Fused multiply-accumulate: this += a*b, without a temporary element.
+	 * All three elements must be in EVALUATION format.
+	 *
+	 * @param &a is the first element to multiply.
+	 * @param &b is the second element to multiply.
+	 * @return is the result of the operation.
+	 */
+	const PolyImpl& AddMulInPlace(const PolyImpl &a, const PolyImpl &b);
+
+	/**
+	 * @brief Fused multiply-subtract: this -= a*b, without a temporary element.
+	 * All three elements must be in EVALUATION format.
+	 *
+	 * @param &a is the first element to multiply.
+	 * @param &b is the second element to multiply.
+	 * @return is the result of the operation.
+	 */
+	const PolyImpl& SubMulInPlace(const PolyImpl &a, const PolyImpl &b);
+
+	/**
+	 * @brief Accumulates an inner product: this += sum_k terms[k].first * terms[k].second,
+	 * delaying the modular reductions where the vector backend supports it.
+	 * All the elements must be in EVALUATION format.
+	 *
+	 * @param &terms are the pairs of elements to multiply.
+	 * @return is the result of the operation.
+	 */
+	const PolyImpl& AddInnerProductInPlace(const std::vector<std::pair<const PolyImpl*, const PolyImpl*>> &terms);
+
 	/**
 	 * @brief Equality operator compares this element to the input element.
 	 *
@@ -729,6 +788,27 @@ public:
 	 */
 	bool Deserialize(const Serialized& serObj);
 
+	void SerializeBinary(BinaryWriter &writer) const;
+
+	void DeserializeBinary(BinaryReader &reader);
+
+	/**
+	 * @brief Writes only the format and the values of the element in the compact binary format,
+	 * for elements whose parameters are written elsewhere (the towers of a DCRTPoly).
+	 *
+	 * @param writer the binary object being written.
+	 */
+	void SerializeBinaryValues(BinaryWriter &writer) const;
+
+	/**
+	 * @brief Populates the format and the values of the element from the compact binary format;
+	 * the parameters must be set already.
+	 *
+	 * @param reader the binary object being read.
+	 * @throws deserialize_error if the values are malformed.
+	 */
+	void DeserializeBinaryValues(BinaryReader &reader);
+
 	/**
 	 * @brief ostream operator
 	 * @param os the input preceding output stream
@@ -832,6 +912,9 @@ private:
 	shared_ptr<Params> m_params;
 
 	void ArbitrarySwitchFormat();
+
+	// checks that an operand of the fused operations is compatible with this element
+	void CheckFusedOperand(const PolyImpl &element, const char *name) const;
 };
 
 template<>
@@ -188,6 +188,15 @@ namespace lbcrypto {
 	using BigVector = M6Vector;
 
 #endif
+
+	/**
+	 * @brief Maps the integer type of each known math backend to its vector type.
+	 */
+	template<typename IntType> struct VectorTypeOf;
+	template<> struct VectorTypeOf<M2Integer> { typedef M2Vector type; };
+	template<> struct VectorTypeOf<M4Integer> { typedef M4Vector type; };
+	template<> struct VectorTypeOf<M6Integer> { typedef M6Vector type; };
+	template<> struct VectorTypeOf<NativeInteger> { typedef NativeVector type; };
 }
 
 #endif
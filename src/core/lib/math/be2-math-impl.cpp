@@ -29,6 +29,7 @@
 
 #include "math/binaryuniformgenerator.cpp"
 #include "math/ternaryuniformgenerator.cpp"
+#include "math/centeredbinomialgenerator.cpp"
 #include "math/discreteuniformgenerator.cpp"
 #include "math/discretegaussiangenerator.cpp"
 #include "math/nbtheory.cpp"
@@ -39,7 +40,10 @@ namespace lbcrypto {
 template class DiscreteGaussianGeneratorImpl<M2Vector>;
 template class BinaryUniformGeneratorImpl<M2Vector>;
 template class TernaryUniformGeneratorImpl<M2Vector>;
+template class CenteredBinomialGeneratorImpl<M2Vector>;
 template class DiscreteUniformGeneratorImpl<M2Vector>;
+template class NumberTheoreticTransform<M2Vector>;
+template class NTTTables<M2Vector>;
 template class ChineseRemainderTransformFTT<M2Vector>;
 template class ChineseRemainderTransformArb<M2Vector>;
 
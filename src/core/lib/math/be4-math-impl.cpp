@@ -30,6 +30,7 @@
 
 #include "math/binaryuniformgenerator.cpp"
 #include "math/ternaryuniformgenerator.cpp"
+#include "math/centeredbinomialgenerator.cpp"
 #include "math/discreteuniformgenerator.cpp"
 #include "math/discretegaussiangenerator.cpp"
 #include "math/nbtheory.cpp"
@@ -41,7 +42,10 @@ namespace lbcrypto {
 template class DiscreteGaussianGeneratorImpl<M4Vector>;
 template class BinaryUniformGeneratorImpl<M4Vector>;
 template class TernaryUniformGeneratorImpl<M4Vector>;
+template class CenteredBinomialGeneratorImpl<M4Vector>;
 template class DiscreteUniformGeneratorImpl<M4Vector>;
+template class NumberTheoreticTransform<M4Vector>;
+template class NTTTables<M4Vector>;
 template class ChineseRemainderTransformFTT<M4Vector>;
 template class ChineseRemainderTransformArb<M4Vector>;
 
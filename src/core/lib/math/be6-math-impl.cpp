@@ -30,6 +30,7 @@
 
 #include "math/binaryuniformgenerator.cpp"
 #include "math/ternaryuniformgenerator.cpp"
+#include "math/centeredbinomialgenerator.cpp"
 #include "math/discreteuniformgenerator.cpp"
 #include "math/discretegaussiangenerator.cpp"
 #include "math/nbtheory.cpp"
@@ -41,7 +42,10 @@ namespace lbcrypto {
 template class DiscreteGaussianGeneratorImpl<M6Vector>;
 template class BinaryUniformGeneratorImpl<M6Vector>;
 template class TernaryUniformGeneratorImpl<M6Vector>;
+template class CenteredBinomialGeneratorImpl<M6Vector>;
 template class DiscreteUniformGeneratorImpl<M6Vector>;
+template class NumberTheoreticTransform<M6Vector>;
+template class NTTTables<M6Vector>;
 template class ChineseRemainderTransformFTT<M6Vector>;
 template class ChineseRemainderTransformArb<M6Vector>;
 
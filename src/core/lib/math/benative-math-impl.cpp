@@ -30,6 +30,7 @@
 
 #include "math/binaryuniformgenerator.cpp"
 #include "math/ternaryuniformgenerator.cpp"
+#include "math/centeredbinomialgenerator.cpp"
 #include "math/discreteuniformgenerator.cpp"
 #include "math/discretegaussiangenerator.cpp"
 #include "math/nbtheory.cpp"
@@ -41,7 +42,10 @@ namespace lbcrypto {
 template class DiscreteGaussianGeneratorImpl<NativeVector>;
 template class BinaryUniformGeneratorImpl<NativeVector>;
 template class TernaryUniformGeneratorImpl<NativeVector>;
+template class CenteredBinomialGeneratorImpl<NativeVector>;
 template class DiscreteUniformGeneratorImpl<NativeVector>;
+template class NumberTheoreticTransform<NativeVector>;
+template class NTTTables<NativeVector>;
 template class ChineseRemainderTransformFTT<NativeVector>;
 template class ChineseRemainderTransformArb<NativeVector>;
 
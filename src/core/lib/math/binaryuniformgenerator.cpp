@@ -26,6 +26,7 @@
  */
 #include "binaryuniformgenerator.h"
 #include <random>
+#include <vector>
 
 namespace lbcrypto {
 
@@ -42,10 +43,28 @@ VecType BinaryUniformGeneratorImpl<VecType>::GenerateVector (const usint size, c
 	VecType v(size);
 	v.SetModulus(modulus);
 
+	std::vector<uint64_t> words((size + 63) / 64);
+	PseudoRandomNumberGenerator::GetPRNG().Fill(words.data(), words.size());
+
 	for (usint i = 0; i < size; i++) {
-	  v.at(i)= GenerateInteger();
+	  v[i] = typename VecType::Integer((words[i >> 6] >> (i & 63)) & 1);
 	}
 	return v;
 }
 
+template<typename VecType>
+std::shared_ptr<int32_t> BinaryUniformGeneratorImpl<VecType>::GenerateIntVector (usint size) const {
+
+	std::shared_ptr<int32_t> ans( new int32_t[size], std::default_delete<int32_t[]>() );
+	int32_t *out = ans.get();
+
+	std::vector<uint64_t> words((size + 63) / 64);
+	PseudoRandomNumberGenerator::GetPRNG().Fill(words.data(), words.size());
+
+	for (usint i = 0; i < size; i++)
+		out[i] = (int32_t)((words[i >> 6] >> (i & 63)) & 1);
+
+	return ans;
+}
+
 } // namespace lbcrypto
@@ -29,6 +29,7 @@
 #define LBCRYPTO_MATH_BINARYUNIFORMGENERATOR_H_
 
 #include "distributiongenerator.h"
+#include <memory>
 #include <random>
 
 namespace lbcrypto {
@@ -40,6 +41,9 @@ typedef BinaryUniformGeneratorImpl<BigVector> BinaryUniformGenerator;
 
 /**
 * @brief A generator of the Binary Uniform Distribution.
+*
+* Vectors are cut from random words one bit at a time (64 coefficients per word); the words
+* of a vector are drawn from the PRNG in one block.
 */
 template<typename VecType>
 class BinaryUniformGeneratorImpl : public DistributionGenerator<VecType> {
@@ -63,6 +67,13 @@ public:
 	*/
 	VecType GenerateVector(const usint size, const typename VecType::Integer &modulus) const;
 
+	/**
+	* @brief      Returns a generated vector of integers.
+	* @param size The number of values to return.
+	* @return     A pointer to an array of integer values generated with the distribution.
+	*/
+	std::shared_ptr<int32_t> GenerateIntVector(usint size) const;
+
 private:
 	static std::bernoulli_distribution m_distribution;
 
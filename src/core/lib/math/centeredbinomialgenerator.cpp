@@ -0,0 +1,111 @@
+/*
+ * @file centeredbinomialgenerator.cpp This code provides generation of a centered binomial distribution of small integers.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+ 
+#include "centeredbinomialgenerator.h"
+#include "../utils/exception.h"
+#include <cmath>
+#include <vector>
+
+namespace lbcrypto {
+
+/**
+ * Number of set bits of a word, with bitwise operations only.
+ */
+static inline uint32_t HammingWeight(uint64_t x) {
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (uint32_t)((x * 0x0101010101010101ULL) >> 56);
+}
+
+template<typename VecType>
+void CenteredBinomialGeneratorImpl<VecType>::SetEta(usint eta) {
+	if (eta == 0 || eta > CBD_MAX_ETA)
+		throw std::logic_error("CenteredBinomialGenerator: eta must be between 1 and " + std::to_string(CBD_MAX_ETA));
+	m_eta = eta;
+}
+
+template<typename VecType>
+usint CenteredBinomialGeneratorImpl<VecType>::EtaForStd(double std) {
+	double eta = std::round(2 * std * std);
+	if (eta < 1)
+		return 1;
+	// clamping would silently draw less noise than configured
+	if (eta > CBD_MAX_ETA)
+		PALISADE_THROW(config_error, "CenteredBinomialGenerator: the standard deviation " + std::to_string(std) +
+				" needs eta = " + std::to_string((usint)eta) + " > " + std::to_string(CBD_MAX_ETA));
+	return (usint)eta;
+}
+
+template<typename VecType>
+std::shared_ptr<int32_t> CenteredBinomialGeneratorImpl<VecType>::GenerateIntVector (usint size) const {
+
+	std::shared_ptr<int32_t> ans( new int32_t[size], std::default_delete<int32_t[]>() );
+	int32_t *out = ans.get();
+
+	const usint bits = 2 * m_eta;
+	const usint perWord = 64 / bits;
+	const uint64_t mask = (m_eta == 32) ? 0xFFFFFFFFULL : (((uint64_t)1 << m_eta) - 1);
+
+	// all the random bits of the vector are drawn in one block
+	std::vector<uint64_t> words((size + perWord - 1) / perWord);
+	PseudoRandomNumberGenerator::GetPRNG().Fill(words.data(), words.size());
+
+	usint i = 0;
+	for (usint w = 0; w < words.size(); w++) {
+		uint64_t word = words[w];
+		for (usint s = 0; s < perWord && i < size; s++, i++) {
+			int32_t a = HammingWeight(word & mask);
+			int32_t b = HammingWeight((word >> m_eta) & mask);
+			out[i] = a - b;
+			// bits = 64 only when perWord = 1, so the shift is never by 64
+			word >>= (bits % 64);
+		}
+	}
+
+	return ans;
+}
+
+template<typename VecType>
+VecType CenteredBinomialGeneratorImpl<VecType>::GenerateVector (usint size, const typename VecType::Integer &modulus) const {
+
+	std::shared_ptr<int32_t> values = GenerateIntVector(size);
+
+	VecType v(size);
+	v.SetModulus(modulus);
+
+	for (usint i = 0; i < size; i++) {
+		int32_t x = (values.get())[i];
+		if (x < 0)
+			v[i] = modulus - typename VecType::Integer(-x);
+		else
+			v[i] = typename VecType::Integer(x);
+	}
+
+	return v;
+}
+
+} // namespace lbcrypto
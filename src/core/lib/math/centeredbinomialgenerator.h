@@ -0,0 +1,105 @@
+/**
+ * @file centeredbinomialgenerator.h This code provides generation of a centered binomial distribution of small integers.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef LBCRYPTO_MATH_CENTEREDBINOMIALGENERATOR_H_
+#define LBCRYPTO_MATH_CENTEREDBINOMIALGENERATOR_H_
+
+#include "distributiongenerator.h"
+#include <memory>
+
+namespace lbcrypto {
+
+template<typename VecType>
+class CenteredBinomialGeneratorImpl;
+
+typedef CenteredBinomialGeneratorImpl<BigVector> CenteredBinomialGenerator;
+
+const usint CBD_MAX_ETA = 32;	//!< @brief Largest parameter eta of the centered binomial distribution.
+
+/**
+* @brief A generator of the centered binomial distribution.
+*
+* A sample is the difference of the Hamming weights of two independent uniform eta-bit words,
+* so it lies in [-eta,eta], has mean 0 and variance eta/2. The samples of a vector are cut from
+* one block of random words, 64/(2*eta) samples per word, and the Hamming weights are computed
+* with bitwise operations only; the running time does not depend on the samples.
+*
+* With eta = round(2*sigma^2), the distribution is used instead of a discrete Gaussian of
+* standard deviation sigma, as in NewHope and Kyber.
+*/
+template<typename VecType>
+class CenteredBinomialGeneratorImpl : public DistributionGenerator<VecType> {
+
+public:
+	/**
+	* @brief Basic constructor for Centered Binomial Generator.
+	* @param eta the parameter of the distribution, from 1 to CBD_MAX_ETA.
+	*/
+	CenteredBinomialGeneratorImpl (usint eta = 1) : DistributionGenerator<VecType>() { SetEta(eta); }
+	virtual ~CenteredBinomialGeneratorImpl() {}
+
+	/**
+	* @brief  Returns the parameter of the distribution.
+	* @return the parameter eta.
+	*/
+	usint GetEta() const { return m_eta; }
+
+	/**
+	* @brief  Sets the parameter of the distribution.
+	* @param eta the parameter, from 1 to CBD_MAX_ETA.
+	*/
+	void SetEta(usint eta);
+
+	/**
+	* @brief  Returns the parameter for which the distribution has (about) the variance of a discrete Gaussian.
+	* @param std the standard deviation of the discrete Gaussian.
+	* @return round(2*std^2), at least 1.
+	* @throws config_error if round(2*std^2) > CBD_MAX_ETA, i.e. std > 4.
+	*/
+	static usint EtaForStd(double std);
+
+	/**
+	* @brief  Generates a vector of random values within the centered binomial distribution.
+	* @param size length of the vector.
+	* @param modulus the modulus applied to all values of the vector.
+	* @return A vector of random values within the centered binomial distribution.
+	*/
+	VecType GenerateVector (usint size, const typename VecType::Integer &modulus) const;
+
+	/**
+	* @brief      Returns a generated vector of integers.
+	* @param size The number of values to return.
+	* @return     A pointer to an array of integer values generated with the distribution.
+	*/
+	std::shared_ptr<int32_t> GenerateIntVector (usint size) const;
+
+private:
+	usint m_eta;
+};
+
+} // namespace lbcrypto
+
+#endif // LBCRYPTO_MATH_CENTEREDBINOMIALGENERATOR_H_
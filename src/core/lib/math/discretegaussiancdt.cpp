@@ -0,0 +1,163 @@
+/*
+ * @file discretegaussiancdt.cpp This code provides a table-based sampler for discrete Gaussians of small fixed deviation.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "discretegaussiancdt.h"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+// the AVX2 code is compiled with a per-function target attribute and chosen at runtime
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CDT_X86 1
+#endif
+
+namespace lbcrypto {
+
+/**
+ * Turns one batch of uniform words into samples. Bit 0 of a word is the sign and the
+ * other 63 bits are compared with every entry of the table; (u - t) >> 63 is 1 exactly
+ * when u < t, as both are below 2^63. The loops have a fixed trip count so that they are
+ * vectorized; compiled once per instruction set by the wrappers below.
+ */
+static inline __attribute__((always_inline)) void CDTBatch(const uint64_t *table, size_t tableSize,
+		const uint64_t *words, int32_t *out) {
+	const size_t batch = DiscreteGaussianCDT::BATCH_SIZE;
+	uint64_t u[batch];
+	uint64_t below[batch];
+
+	for (size_t i = 0; i < batch; i++) {
+		u[i] = words[i] >> 1;
+		below[i] = 0;
+	}
+
+	for (size_t k = 0; k < tableSize; k++) {
+		uint64_t t = table[k];
+		for (size_t i = 0; i < batch; i++)
+			below[i] += (u[i] - t) >> 63;
+	}
+
+	for (size_t i = 0; i < batch; i++) {
+		uint32_t magnitude = (uint32_t)(tableSize - below[i]);
+		uint32_t negative = -(uint32_t)(words[i] & 1);
+		// conditional negation without a branch
+		out[i] = (int32_t)((magnitude ^ negative) - negative);
+	}
+}
+
+static void CDTBatchPortable(const uint64_t *table, size_t tableSize, const uint64_t *words, int32_t *out) {
+	CDTBatch(table, tableSize, words, out);
+}
+
+#ifdef CDT_X86
+__attribute__((target("avx2")))
+static void CDTBatchAVX2(const uint64_t *table, size_t tableSize, const uint64_t *words, int32_t *out) {
+	CDTBatch(table, tableSize, words, out);
+}
+#endif
+
+static bool SupportsAVX2() {
+#ifdef CDT_X86
+	return __builtin_cpu_supports("avx2");
+#else
+	return false;
+#endif
+}
+
+static std::atomic<bool>& UseAVX2() {
+	static std::atomic<bool> useAVX2(SupportsAVX2());
+	return useAVX2;
+}
+
+bool DiscreteGaussianCDT::SetAVX2(bool avx2) {
+	bool supported = SupportsAVX2();
+	UseAVX2().store(avx2 && supported);
+	return avx2 && supported;
+}
+
+bool DiscreteGaussianCDT::GetAVX2() {
+	return UseAVX2().load();
+}
+
+DiscreteGaussianCDT::DiscreteGaussianCDT(double std) : m_std(std) {
+	if (!(std > 0) || std > CDT_MAX_STD)
+		throw std::logic_error("DiscreteGaussianCDT: the standard deviation must be in (0, CDT_MAX_STD]");
+
+	// probabilities of the magnitudes 0, 1, 2, ... up to far beyond the 2^-64 cut-off
+	long double variance = (long double)std * std;
+	size_t last = (size_t)std::ceil(std * 12) + 1;
+	std::vector<long double> weight(last + 1);
+	long double sum = 0;
+	for (size_t k = 0; k <= last; k++) {
+		weight[k] = std::exp(-(long double)(k * k) / (2 * variance)) * (k == 0 ? 1 : 2);
+		sum += weight[k];
+	}
+
+	// tail[k] = Pr(|x| > k), summed from the small end for accuracy
+	std::vector<long double> tail(last + 1);
+	long double acc = 0;
+	for (size_t k = last + 1; k-- > 0;) {
+		tail[k] = acc / sum;
+		acc += weight[k];
+	}
+
+	const long double scale = 9223372036854775808.0L;	// 2^63
+	for (size_t k = 0; k <= last; k++) {
+		uint64_t rest = (uint64_t)std::llround(tail[k] * scale);
+		if (rest == 0)
+			break;
+		m_table.push_back(((uint64_t)1 << 63) - rest);
+	}
+}
+
+void DiscreteGaussianCDT::Generate(int32_t *out, size_t size, PRNGEngine &g) const {
+	if (m_table.empty())
+		throw std::logic_error("DiscreteGaussianCDT: Generate called on an empty sampler");
+
+#ifdef CDT_X86
+	bool avx2 = UseAVX2().load(std::memory_order_relaxed);
+#endif
+	uint64_t words[BATCH_SIZE] = {};
+	int32_t samples[BATCH_SIZE];
+
+	for (size_t done = 0; done < size; done += BATCH_SIZE) {
+		size_t n = (size - done < BATCH_SIZE) ? size - done : BATCH_SIZE;
+		bool whole = (n == BATCH_SIZE);
+		g.Fill(words, n);
+		// whole batches are written in place; the last one goes through a buffer
+		int32_t *dest = whole ? out + done : samples;
+#ifdef CDT_X86
+		if (avx2)
+			CDTBatchAVX2(m_table.data(), m_table.size(), words, dest);
+		else
+#endif
+			CDTBatchPortable(m_table.data(), m_table.size(), words, dest);
+		if (!whole)
+			for (size_t i = 0; i < n; i++)
+				out[done + i] = samples[i];
+	}
+}
+
+} // namespace lbcrypto
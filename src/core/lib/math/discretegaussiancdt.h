@@ -0,0 +1,113 @@
+/**
+ * @file discretegaussiancdt.h This code provides a table-based sampler for discrete Gaussians of small fixed deviation.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef LBCRYPTO_MATH_DISCRETEGAUSSIANCDT_H_
+#define LBCRYPTO_MATH_DISCRETEGAUSSIANCDT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "prng.h"
+
+namespace lbcrypto {
+
+const double CDT_MAX_STD = 16;	//!< @brief Largest standard deviation sampled with the cumulative distribution table.
+
+/**
+ * @brief Cumulative distribution table (CDT) sampler for a discrete Gaussian centered at 0.
+ *
+ * The magnitude of a sample is the number of table entries that a uniform 63-bit word is not
+ * below, and its sign is one more random bit. The table holds 2^63*Pr(|x| <= k) rounded to
+ * integers and stops where the remaining tail is below 2^-64, so no sample is lost to a
+ * cut-off at double precision.
+ *
+ * Every sample reads the whole table with the same operations, whatever its value, so the
+ * running time does not depend on the samples. Samples are produced in batches: the comparisons
+ * of one table entry against a block of uniform words are vector operations (using AVX2 when
+ * the CPU supports it).
+ */
+class DiscreteGaussianCDT {
+public:
+	/**
+	 * Creates an empty sampler; Generate may not be called on it.
+	 */
+	DiscreteGaussianCDT() : m_std(0) {}
+
+	/**
+	 * Builds the table for a standard deviation.
+	 *
+	 * @param std the standard deviation, positive and at most CDT_MAX_STD.
+	 */
+	explicit DiscreteGaussianCDT(double std);
+
+	/**
+	 * @return the standard deviation of the sampler, 0 for an empty one.
+	 */
+	double GetStd() const { return m_std; }
+
+	/**
+	 * @return whether the sampler has a table.
+	 */
+	bool IsEmpty() const { return m_table.empty(); }
+
+	/**
+	 * @return the largest magnitude the sampler can output.
+	 */
+	int32_t GetBound() const { return (int32_t)m_table.size(); }
+
+	/**
+	 * Generates samples in bulk.
+	 *
+	 * @param out the buffer for the samples.
+	 * @param size the number of samples.
+	 * @param g the engine providing the uniform words.
+	 */
+	void Generate(int32_t *out, size_t size, PRNGEngine &g) const;
+
+	/**
+	 * Selects the vectorized (AVX2) or the portable implementation of the table comparisons.
+	 * Requests for AVX2 on CPUs without it are ignored. This is mostly useful for testing.
+	 *
+	 * @param avx2 true to use AVX2.
+	 * @return whether AVX2 is used.
+	 */
+	static bool SetAVX2(bool avx2);
+
+	/**
+	 * @return whether the AVX2 implementation is used.
+	 */
+	static bool GetAVX2();
+
+	static const size_t BATCH_SIZE = 256;	//!< @brief samples compared against the table at a time
+
+private:
+	double m_std;
+	std::vector<uint64_t> m_table;
+};
+
+} // namespace lbcrypto
+
+#endif // LBCRYPTO_MATH_DISCRETEGAUSSIANCDT_H_
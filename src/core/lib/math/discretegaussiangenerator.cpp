@@ -50,6 +50,10 @@ namespace lbcrypto {
 		if(peikert){
 			Initialize();
 		}
+		if (m_std > 0 && m_std <= CDT_MAX_STD)
+			m_cdt = DiscreteGaussianCDT(m_std);
+		else
+			m_cdt = DiscreteGaussianCDT();
 	}
 
 	template<typename VecType>
@@ -129,10 +133,16 @@ namespace lbcrypto {
     std::shared_ptr<int32_t> ans( new int32_t[size], std::default_delete<int[]>() );
 		usint val = 0;
 		double seed;
-    if(peikert){
-    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    if(!m_cdt.IsEmpty()){
+		m_cdt.Generate(ans.get(), size, PseudoRandomNumberGenerator::GetPRNG());
+    }
+    else if(peikert){
+		// the uniform deviates of the whole vector are drawn from the PRNG in one block
+		std::vector<uint64_t> words(size);
+		PseudoRandomNumberGenerator::GetPRNG().Fill(words.data(), size);
 		for (usint i = 0; i < size; i++) {
-			seed = distribution(PseudoRandomNumberGenerator::GetPRNG()) - 0.5; //we need to use the binary uniform generator rather than regular continuous distribution; see DG14 for details
+			// 53 random bits give a uniform double in [0,1)
+			seed = (words[i] >> 11) * (1.0 / 9007199254740992.0) - 0.5; //we need to use the binary uniform generator rather than regular continuous distribution; see DG14 for details
 			if (std::abs(seed) <= m_a / 2) {
 				val = 0;
 			}
@@ -322,7 +332,7 @@ namespace lbcrypto {
 		std::uniform_int_distribution<int32_t> uniform_sign(0, 1);
 		std::uniform_int_distribution<int64_t> uniform_j(0, ceil(stddev)-1);
 
-		std::mt19937 &g = PseudoRandomNumberGenerator::GetPRNG();
+		PRNGEngine &g = PseudoRandomNumberGenerator::GetPRNG();
 
 		bool flagSuccess = false;
 		int32_t k;
@@ -367,12 +377,12 @@ namespace lbcrypto {
 	}
 	
 	template<typename VecType>
-	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmP(std::mt19937 &g, int n){
+	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmP(PRNGEngine &g, int n){
 		while (n-- && AlgorithmH(g)){}; return n < 0;
 	}
 
 	template<typename VecType>
-	int32_t DiscreteGaussianGeneratorImpl<VecType>::AlgorithmG(std::mt19937 &g)
+	int32_t DiscreteGaussianGeneratorImpl<VecType>::AlgorithmG(PRNGEngine &g)
 	{
 		int n = 0; while (AlgorithmH(g)) ++n; return n;
 	}
@@ -380,7 +390,7 @@ namespace lbcrypto {
 	// Use single floating-point precision in most cases; if a situation w/ not enough precision is encountered,
 	// call the double-precision algorithm
 	template<typename VecType>
-	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmH(std::mt19937 &g){
+	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmH(PRNGEngine &g){
 		
 		std::uniform_real_distribution<float> dist(0,1);
 		float h_a, h_b;
@@ -410,7 +420,7 @@ namespace lbcrypto {
 	}
 
 	template<typename VecType>
-	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmHDouble(std::mt19937 &g) {
+	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmHDouble(PRNGEngine &g) {
 	
 		std::uniform_real_distribution<double> dist(0, 1);
 		double h_a, h_b;
@@ -428,7 +438,7 @@ namespace lbcrypto {
 	}
 
 	template<typename VecType>
-	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmB(std::mt19937 &g, int32_t k, double x) {
+	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmB(PRNGEngine &g, int32_t k, double x) {
 
 		std::uniform_real_distribution<float> dist(0.0, 1.0);
 
@@ -462,7 +472,7 @@ namespace lbcrypto {
 	}
 
 	template<typename VecType>
-	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmBDouble(std::mt19937 &g, int32_t k, double x) {
+	bool DiscreteGaussianGeneratorImpl<VecType>::AlgorithmBDouble(PRNGEngine &g, int32_t k, double x) {
 		std::uniform_real_distribution<double> dist(0.0, 1.0);
 
 		double y = x;
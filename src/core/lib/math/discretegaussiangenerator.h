@@ -40,7 +40,10 @@
  * Final sampling method defined in this class is the Peikert's inversion method discussed in section 4.1 of https://eprint.iacr.org/2010/088.pdf and
  * summarized in section 3.2.2 of https://link.springer.com/content/pdf/10.1007%2Fs00200-014-0218-3.pdf. It requires CDF tables of probabilities centered around
  * single center to be kept, which are precalculated in constructor. The method is not prone to timing attacks but it is usable for single center, single deviation only.
- * It should be also noted that the memory requirement grows with the standard deviation, therefore it is advised to use it with smaller deviations.   */
+ * It should be also noted that the memory requirement grows with the standard deviation, therefore it is advised to use it with smaller deviations.
+ *
+ * For vectors of samples with a standard deviation up to CDT_MAX_STD (such as the deviation of about 3.2 used for RLWE errors), the inversion is done
+ * with the integer cumulative distribution table of DiscreteGaussianCDT instead: the samples are generated in batches, with a constant-time scan of the table. */
 
 #ifndef LBCRYPTO_MATH_DISCRETEGAUSSIANGENERATOR_H_
 #define LBCRYPTO_MATH_DISCRETEGAUSSIANGENERATOR_H_
@@ -53,6 +56,7 @@
 
 #include "backend.h"
 #include "distributiongenerator.h"
+#include "discretegaussiancdt.h"
 
 namespace lbcrypto {
 
@@ -108,7 +112,8 @@ public:
 	int32_t GenerateInt () const;
 
 	/**
-	* @brief      Returns a generated integer vector. Uses Peikert's inversion method.
+	* @brief      Returns a generated integer vector. Uses the CDT sampler for standard deviations up to CDT_MAX_STD
+	*             and Peikert's inversion method above.
 	* @param size The number of values to return.
 	* @return     A pointer to an array of integer values generated with the distribution.
 	*/
@@ -178,29 +183,29 @@ private:
 
 	/**
 	* @brief Subroutine used by Karney's Method to accept an integer with probability exp(-n/2).
-	* @param g Mersenne Twister Engine used for deviates
+	* @param g engine used for deviates
 	* @param n Number to test with exp(-n/2) probability
 	* @return Accept/Reject result
 	*/
-	static bool AlgorithmP(std::mt19937 &g, int32_t n);
+	static bool AlgorithmP(PRNGEngine &g, int32_t n);
 	/**
 	* @brief Subroutine used by Karney's Method to generate an integer with probability exp(-k/2)(1 - exp(-1/2)).
-	* @param g Mersenne Twister Engine used for deviates
+	* @param g engine used for deviates
 	* @return Random number k
 	*/
-	static int32_t AlgorithmG(std::mt19937 &g);
+	static int32_t AlgorithmG(PRNGEngine &g);
 	/**
 	* @brief Generates a Bernoulli random value H which is true with probability exp(-1/2).
-	* @param g Mersenne Twister Engine used for uniform deviates
+	* @param g engine used for uniform deviates
 	* @return Bernoulli random value H
 	*/
-	static bool AlgorithmH(std::mt19937 &g);
+	static bool AlgorithmH(PRNGEngine &g);
 	/**
 	* @brief Generates a Bernoulli random value H which is true with probability exp(-1/2). Uses double precision.
-	* @param g Mersenne Twister Engine used for uniform deviates
+	* @param g engine used for uniform deviates
 	* @return Bernoulli random value H
 	*/
-	static bool AlgorithmHDouble(std::mt19937 &g);
+	static bool AlgorithmHDouble(PRNGEngine &g);
 	/**
 	* @brief Bernoulli trial with probability exp(-x(2k + x)/(2k + 2)).
 	* @param g Mersenne Twister Engine used for uniform deviates
@@ -208,7 +213,7 @@ private:
 	* @param x Deviate x used for calculations
 	* @return Whether the number of runs are even or not
 	*/
-	static bool AlgorithmB(std::mt19937 &g, int32_t k, double x);
+	static bool AlgorithmB(PRNGEngine &g, int32_t k, double x);
 	/**
 	* @brief Bernoulli trial with probability exp(-x(2k + x)/(2k + 2)). Uses double precision.
 	* @param g Mersenne Twister Engine used for uniform deviates
@@ -216,7 +221,7 @@ private:
 	* @param x Deviate x used for calculations
 	* @return Whether the number of runs are even or not
 	*/
-	static bool AlgorithmBDouble(std::mt19937 &g, int32_t k, double x);
+	static bool AlgorithmBDouble(PRNGEngine &g, int32_t k, double x);
 
 
 	// Gyana to add precomputation methods and data members
@@ -230,6 +235,11 @@ private:
 	*/
 	double m_std;
  bool peikert=false;
+
+	/**
+	* The table-based sampler used for vectors, empty when the deviation is above CDT_MAX_STD.
+	*/
+	DiscreteGaussianCDT m_cdt;
 	
 };
 
@@ -57,6 +57,11 @@ void DiscreteUniformGeneratorImpl<VecType>::SetModulus (const typename VecType::
 
 template<typename VecType>
 typename VecType::Integer DiscreteUniformGeneratorImpl<VecType>::GenerateInteger () const {
+	return GenerateInteger(PseudoRandomNumberGenerator::GetPRNG());
+}
+
+template<typename VecType>
+typename VecType::Integer DiscreteUniformGeneratorImpl<VecType>::GenerateInteger (PRNGEngine &engine) const {
 
 	// result is initialized to 0
 	typename VecType::Integer result;
@@ -78,7 +83,7 @@ typename VecType::Integer DiscreteUniformGeneratorImpl<VecType>::GenerateInteger
 		// Generate random uint32_t "limbs" of the BigInteger
 		for (usint i = 0; i < m_chunksPerValue; i++) {
 			//Generate an unsigned long integer
-			value = m_distribution(PseudoRandomNumberGenerator::GetPRNG());
+			value = m_distribution(engine);
 			// converts value to IntType
 			temp = value;
 			//Move it to the appropriate chunk of the big integer
@@ -99,7 +104,7 @@ typename VecType::Integer DiscreteUniformGeneratorImpl<VecType>::GenerateInteger
 			// built-in generator for the most significant chunk of the multiprecision number
 			std::uniform_int_distribution<uint32_t>  distribution = std::uniform_int_distribution<uint32_t>(CHUNK_MIN, bound);
 
-			value = distribution(PseudoRandomNumberGenerator::GetPRNG());
+			value = distribution(engine);
 			// converts value to IntType
 			temp = value;
 			//Move it to the appropriate chunk of the big integer
@@ -115,16 +120,47 @@ typename VecType::Integer DiscreteUniformGeneratorImpl<VecType>::GenerateInteger
 	return result;
 }
 
+/**
+ * Sets v[0..size) to words uniformly distributed in [0,modulus), generated in bulk.
+ * Generic version, going through a buffer of words.
+ */
+template<typename VecType>
+inline void FillUniformWords(VecType &v, usint size, uint64_t modulus, PRNGEngine &engine) {
+	std::vector<uint64_t> words(size);
+	engine.FillUniform(words.data(), size, modulus);
+	for (usint i = 0; i < size; i++)
+		v[i] = typename VecType::Integer(words[i]);
+}
+
+/**
+ * NativeVector version: the words are generated directly into the payload of the vector.
+ */
+inline void FillUniformWords(NativeVector &v, usint size, uint64_t modulus, PRNGEngine &engine) {
+	engine.FillUniform(v.GetData(), size, modulus);
+}
+
 template<typename VecType>
 VecType DiscreteUniformGeneratorImpl<VecType>::GenerateVector(const usint size) const {
+	return GenerateVector(size, PseudoRandomNumberGenerator::GetPRNG());
+}
+
+template<typename VecType>
+VecType DiscreteUniformGeneratorImpl<VecType>::GenerateVector(const usint size, PRNGEngine &engine) const {
 
 	VecType v(size,m_modulus);
 
-	for (usint i = 0; i < size; i++) {
-	  typename VecType::Integer temp(this->GenerateInteger());
-	  v.at(i)= temp;
+	usint modulusWidth = m_modulus.GetMSB();
+
+	if (modulusWidth > 64 || modulusWidth == 0) {
+		for (usint i = 0; i < size; i++) {
+		  typename VecType::Integer temp(this->GenerateInteger(engine));
+		  v.at(i)= temp;
+		}
+		return v;
 	}
 
+	FillUniformWords(v, size, m_modulus.ConvertToInt(), engine);
+
 	return v;
 
 }
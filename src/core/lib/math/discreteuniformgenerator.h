@@ -65,10 +65,26 @@ public:
 	typename VecType::Integer GenerateInteger () const;
 
 	/**
-	* @brief Generates a vector of random integers using GenerateInteger()
+	* @brief Generates a random integer based on the modulus set for the Discrete Uniform Generator object,
+	* using the random words of a given engine.
+	* @param engine the engine.
+	*/
+	typename VecType::Integer GenerateInteger (PRNGEngine &engine) const;
+
+	/**
+	* @brief Generates a vector of random integers. For moduli of at most 64 bits, the random words
+	* for the whole vector are drawn from the PRNG in one block; larger moduli use GenerateInteger().
 	*/
 	VecType GenerateVector (const usint size) const;
 
+	/**
+	* @brief Generates a vector of random integers using the random words of a given engine, so the
+	* vector is determined by the state of the engine (for instance the seed of a ChaCha20Engine).
+	* @param size the length of the vector.
+	* @param engine the engine.
+	*/
+	VecType GenerateVector (const usint size, PRNGEngine &engine) const;
+
 private:
 	// discrete uniform generator relies on the built-in C++ generator for 32-bit unsigned integers
 	// the constants below set the parameters specific to 32-bit chunk configuration
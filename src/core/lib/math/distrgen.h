@@ -37,5 +37,6 @@
 #include "discreteuniformgenerator.h"
 #include "binaryuniformgenerator.h"
 #include "ternaryuniformgenerator.h"
+#include "centeredbinomialgenerator.h"
 
 #endif // LBCRYPTO_MATH_DISTRGEN_H_
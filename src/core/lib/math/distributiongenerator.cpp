@@ -25,13 +25,41 @@
  */
  
 #include "distributiongenerator.h"
+#include <iostream>
 #include <random>
 #include "backend.h"
 
 namespace lbcrypto {
 
-std::once_flag PseudoRandomNumberGenerator::m_flag;
+std::atomic<int> PseudoRandomNumberGenerator::m_type(PRNG_CHACHA20);
 
-std::shared_ptr<std::mt19937> PseudoRandomNumberGenerator::m_prng = nullptr;
+thread_local PRNGEngine *PseudoRandomNumberGenerator::m_engine = nullptr;
+
+thread_local int PseudoRandomNumberGenerator::m_engineType = PRNG_CHACHA20;
+
+PRNGEngine &PseudoRandomNumberGenerator::CreateEngine() {
+	// owns the engine of the thread, which is released when the thread exits
+	static thread_local std::unique_ptr<PRNGEngine> engine;
+
+	int type = m_type.load(std::memory_order_relaxed);
+#if defined(FIXED_SEED)
+	//TP: Need reproducibility to debug NTL.
+	std::cerr << "**FOR DEBUGGING ONLY!!!!  Using fixed initializer for PRNG. Use a single thread only!" << std::endl;
+	const uint32_t key[8] = { 1, 0, 0, 0, 0, 0, 0, 0 };
+	if (type == PRNG_MT19937)
+		engine.reset(new MT19937Engine(1));
+	else
+		engine.reset(new ChaCha20Engine(key));
+#else
+	if (type == PRNG_MT19937)
+		engine.reset(new MT19937Engine());
+	else
+		engine.reset(new ChaCha20Engine());
+#endif
+
+	m_engine = engine.get();
+	m_engineType = type;
+	return *m_engine;
+}
 
 } // namespace lbcrypto
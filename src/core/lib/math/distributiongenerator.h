@@ -34,12 +34,11 @@
     #define thread_local __thread
 #endif
 
-#include <chrono>
+#include <atomic>
 #include <memory>
-#include <mutex>
 #include <random>
-#include <thread>
 #include "backend.h"
+#include "prng.h"
 
 //#define FIXED_SEED // if defined, then uses a fixed seed number for reproducible results during debug. Use only one OMP thread to ensure reproducibility
 
@@ -49,44 +48,48 @@ namespace lbcrypto {
 * @brief Abstract class describing generator requirements.
 *
 * The Distribution Generator defines the methods that must be implemented by a real generator.
-* It also holds the single PRNG, which should be called by all child class when generating a random number is required.
+* It also holds the PRNG, which should be called by all child class when generating a random number is required.
 *
+* Every thread has its own engine, created the first time the thread asks for it. The type of
+* engine can be changed at runtime; the engine of each thread is replaced the next time the thread
+* asks for it.
 */
 
 class PseudoRandomNumberGenerator {
 public:
-	static std::mt19937 &GetPRNG () {
-		std::call_once(m_flag, [] () {
-			std::random_device rd;
-#if defined(FIXED_SEED)
-			//TP: Need reproducibility to debug NTL.
-			std::cerr << "**FOR DEBUGGING ONLY!!!!  Using fixed initializer for PRNG. Use a single thread only!" << std::endl;
-			std::mt19937 *gen;
-			gen = new std::mt19937(1);
-			gen->seed(1);
-			m_prng.reset(gen);
-
-#else			
-			//m_prng.reset(new std::mt19937(rd()));
-			m_prng.reset(new std::mt19937(std::chrono::high_resolution_clock::now().time_since_epoch().count()+std::hash<std::thread::id>{}(std::this_thread::get_id())));
-#endif		
+	/**
+	 * Returns the engine of the calling thread.
+	 *
+	 * @return the engine.
+	 */
+	static PRNGEngine &GetPRNG () {
+		if (m_engine == nullptr || m_engineType != m_type.load(std::memory_order_relaxed))
+			return CreateEngine();
+		return *m_engine;
+	}
 
-		});
+	/**
+	 * Selects the engine used by all the threads. Defaults to PRNG_CHACHA20.
+	 *
+	 * @param type the type of engine.
+	 */
+	static void SetEngineType(PRNGEngineType type) {
+		m_type.store(type, std::memory_order_relaxed);
+	}
 
-		return *m_prng;
+	/**
+	 * @return the type of engine used by all the threads.
+	 */
+	static PRNGEngineType GetEngineType() {
+		return (PRNGEngineType)m_type.load(std::memory_order_relaxed);
 	}
 
 private:
-	static std::once_flag 					m_flag;
-#if !defined(FIXED_SEED)
-	// avoid contention on m_flag 
-	#pragma omp threadprivate(m_flag)
-#endif
-	static std::shared_ptr<std::mt19937> 	m_prng;
-#if !defined(FIXED_SEED)
-	// avoid contention on m_prng 
-        #pragma omp threadprivate(m_prng)
-#endif
+	static PRNGEngine &CreateEngine();
+
+	static std::atomic<int>				m_type;
+	static thread_local PRNGEngine		*m_engine;
+	static thread_local int				m_engineType;
 };
 
 // Base class for Distribution Generator by type
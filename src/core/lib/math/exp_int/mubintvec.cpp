@@ -421,7 +421,7 @@ namespace exp_int {
 
 		mubintvec ans(*this);
 		ans.ModEq(modulus);
-		return std::move(ans);
+		return ans;
   }
 
   template<class ubint_el_t>
@@ -451,7 +451,7 @@ namespace exp_int {
 
 	  mubintvec ans(*this);
 	  ans.ModByTwoEq();
-	  return std::move(ans);
+	  return ans;
   }
 
   template<class ubint_el_t>
@@ -486,7 +486,7 @@ namespace exp_int {
     }
     mubintvec ans(*this);
     ans.m_data[i].ModAddEq(b, this->m_modulus);
-    return std::move(ans);
+    return ans;
   }
 
   // method to add scalar to vector
@@ -496,7 +496,7 @@ namespace exp_int {
 	  for(usint i=0;i<this->m_data.size();i++){
 		  ans.m_data[i].ModAddEq(b, ans.m_modulus);
 	  }
-	  return std::move(ans);
+	  return ans;
   }
     
   // method to add scalar to vector
@@ -516,7 +516,7 @@ namespace exp_int {
       for(usint i=0;i<this->m_data.size();i++){
         ans.m_data[i].ModSubEq(b, ans.m_modulus);
       }
-      return std::move(ans);
+      return ans;
     }
 
     template<class ubint_el_t>
@@ -535,7 +535,7 @@ namespace exp_int {
       for(usint i=0;i<this->m_data.size();i++){
         ans.m_data[i].ModMulEq(b, ans.m_modulus);
       }
-      return std::move(ans);
+      return ans;
   #else
 
       mubintvec ans(*this);
@@ -583,7 +583,7 @@ template<class ubint_el_t>
     for(usint i=0;i<this->m_data.size();i++){
       ans.m_data[i] = ans.m_data[i].ModExp(b, ans.m_modulus);
     }
-    return std::move(ans);
+    return ans;
   }
 
 
@@ -594,7 +594,7 @@ template<class ubint_el_t>
     for(usint i=0;i<this->m_data.size();i++){
       ans.m_data[i] = ans.m_data[i].ModInverse(this->m_modulus);
     }
-    return std::move(ans);
+    return ans;
 
 }
 
@@ -604,7 +604,7 @@ template<class ubint_el_t>
   mubintvec<ubint_el_t> mubintvec<ubint_el_t>::Exp(const ubint_el_t &b) const{ //overload of ModExp()
     mubintvec ans(*this);
     ans = ans.ModExp(b);
-    return std::move(ans);
+    return ans;
   }
 
   // vector elementwise add
@@ -620,7 +620,7 @@ template<class ubint_el_t>
 		  for(usint i=0;i<ans.m_data.size();i++){
 			  ans.m_data[i] = ans.m_data[i].ModAdd(b.m_data[i], ans.m_modulus);
 		  }
-		  return std::move(ans);
+		  return ans;
 	  }
   }
 
@@ -652,7 +652,7 @@ template<class ubint_el_t>
 		  for(usint i=0;i<ans.m_data.size();i++){
 			  ans.m_data[i] = ans.m_data[i].ModSub(b.m_data[i],ans.m_modulus);
 		  }
-		  return std::move(ans);
+		  return ans;
 	  }
   }
 
@@ -686,7 +686,7 @@ template<class ubint_el_t>
       for(usint i=0;i<ans.m_data.size();i++){
         ans.m_data[i].ModMulEq(b.m_data[i],ans.m_modulus);
       }
-      return std::move(ans);
+      return ans;
     }
 
 #else // bartett way
@@ -750,7 +750,7 @@ template<class ubint_el_t>
 		  else
 			  ans.m_data[i] = ans.m_data[i].MultiplyAndRound(p, q).Mod(this->m_modulus);
 	  }
-	    return std::move(ans);
+	    return ans;
   }
 
   template<class ubint_el_t>
@@ -765,7 +765,7 @@ template<class ubint_el_t>
 		  else
 			  ans.m_data[i] = ans.m_data[i].DivideAndRound(q);
 	  }
-	    return std::move(ans);
+	    return ans;
   }
 
   //Gets the ind
@@ -776,7 +776,7 @@ template<class ubint_el_t>
       ans.m_data[i] = ubint_el_t(ans.m_data[i].GetDigitAtIndexForBase(index,base));
     }
 
-    return std::move(ans);
+    return ans;
   }
 
 
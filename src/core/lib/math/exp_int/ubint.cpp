@@ -850,7 +850,7 @@ ubint<limb_t> ubint<limb_t>::Minus(const ubint& b) const{
 	//return 0 if b is higher than *this as there is no support for negative number
 	if(!(*this>b)){
 		DEBUG("in Sub, b > a return zero");
-		return std::move(ubint(0));
+		return ubint(0);
 	}
 	size_t cntr=0,current=0;
 
@@ -907,7 +907,7 @@ ubint<limb_t> ubint<limb_t>::Minus(const ubint& b) const{
 	DEBUG("result msb now "<<result.m_MSB);
 	//return the result
 	DEBUG ("Returning");
-	return std::move(result);
+	return result;
 
 }
 
@@ -1006,7 +1006,7 @@ ubint<limb_t> ubint<limb_t>::Times(const ubint& b) const{
 		return ubint(*this);
 
 	if(this->m_MSB==1)
-		return std::move(ubint(b)); //todo check this? don't think standard move is what we want.
+		return ubint(b);
 
 	//position of B in the array where the multiplication should start
 	//limb_t ceilLimb = b.m_value.size();
@@ -1650,13 +1650,13 @@ ubint<limb_t> ubint<limb_t>::DividedBy(const ubint& b) const{
 		throw std::logic_error("DividedBy() Divisor is zero");
 
 	if(b.m_MSB>this->m_MSB)
-		return std::move(ubint(0)); // Kurt and Yuriy want this.
+		return ubint(0); // Kurt and Yuriy want this.
 
 	if(this->m_state==GARBAGE)
 		throw std::logic_error("DividedBy() Dividend uninitialised");
 
 	else if(b==*this)
-		return std::move(ubint(1));
+		return ubint(1);
 
 	ubint ans;
 	int f;
@@ -1850,11 +1850,11 @@ ubint<limb_t> ubint<limb_t>::Mod(const ubint& modulus) const{
 
 	//return the same value if value is less than modulus
 	if (this->m_MSB < modulus.m_MSB){
-		return std::move(ubint(*this));
+		return ubint(*this);
 	}
 	if ((this->m_MSB == modulus.m_MSB)&&(*this<modulus)){
 		DEBUG("this< modulus");
-		return std::move(ubint(*this));
+		return ubint(*this);
 	}
 
 	//use simple masking operation if modulus is 2
@@ -2044,7 +2044,7 @@ ubint<limb_t> ubint<limb_t>::ModBarrett(const ubint& modulus, const ubint& mu) c
 	return(ans);
 #else
 	if(*this<modulus){
-		return std::move(ubint(*this));
+		return ubint(*this);
 	}
 	ubint z(*this);
 	ubint q(*this);
@@ -29,6 +29,8 @@
 #define LBCRYPTO_MATH_INTERFACE_H
 
 #include "utils/inttypes.h"
+#include <utility>
+#include <vector>
 
 namespace lbcrypto {
 
@@ -642,6 +644,44 @@ namespace lbcrypto {
 		inline friend T operator*(const T& a, const T& b) { return a.ModMul(b); }
 		inline friend const T& operator*=(T& a, const T& b) { return a.ModMulEq(b); }
 
+		/**
+		 * Fused vector modulus multiply-accumulate: this += a*b.
+		 * Backends may override this with a single-pass version; the default
+		 * goes through a temporary product.
+		 *
+		 * @param &a is the first vector to multiply.
+		 * @param &b is the second vector to multiply.
+		 * @return this
+		 */
+		const T& AddMulInPlace(const T &a, const T &b) {
+			return static_cast<T*>(this)->ModAddEq(a.ModMul(b));
+		}
+
+		/**
+		 * Fused vector modulus multiply-subtract: this -= a*b.
+		 * Backends may override this with a single-pass version.
+		 *
+		 * @param &a is the first vector to multiply.
+		 * @param &b is the second vector to multiply.
+		 * @return this
+		 */
+		const T& SubMulInPlace(const T &a, const T &b) {
+			return static_cast<T*>(this)->ModSubEq(a.ModMul(b));
+		}
+
+		/**
+		 * Accumulates an inner product: this += sum_k terms[k].first * terms[k].second.
+		 * Backends may override this to delay the modular reductions.
+		 *
+		 * @param &terms are the pairs of vectors to multiply.
+		 * @return this
+		 */
+		const T& AddInnerProductInPlace(const std::vector<std::pair<const T*, const T*>> &terms) {
+			for (size_t k = 0; k < terms.size(); k++)
+				static_cast<T*>(this)->AddMulInPlace(*terms[k].first, *terms[k].second);
+			return *static_cast<T*>(this);
+		}
+
 		/**
 		 * Vector Modulus operator.
 		 *
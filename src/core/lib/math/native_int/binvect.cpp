@@ -90,9 +90,8 @@ NativeVector<IntegerType>::NativeVector(const NativeVector &bigVector){
 }
 
 template<class IntegerType>
-NativeVector<IntegerType>::NativeVector(NativeVector &&bigVector){
-	m_data = std::move(bigVector.m_data);
-	m_modulus = bigVector.m_modulus;
+NativeVector<IntegerType>::NativeVector(NativeVector &&bigVector) noexcept
+	: m_data(std::move(bigVector.m_data)), m_modulus(bigVector.m_modulus) {
 }
 
 //ASSIGNMENT OPERATOR
@@ -150,7 +149,7 @@ const NativeVector<IntegerType>& NativeVector<IntegerType>::operator=(std::initi
 }
 
 template<class IntegerType>
-NativeVector<IntegerType>& NativeVector<IntegerType>::operator=(NativeVector &&rhs){
+NativeVector<IntegerType>& NativeVector<IntegerType>::operator=(NativeVector &&rhs) noexcept {
 
 	if(this!=&rhs){
 		m_data = std::move(rhs.m_data);
@@ -602,6 +601,107 @@ const NativeVector<IntegerType>& NativeVector<IntegerType>::ModMulEq(const Nativ
 	return *this;
 }
 
+template<class IntegerType>
+const NativeVector<IntegerType>& NativeVector<IntegerType>::AddMulInPlace(const NativeVector &a, const NativeVector &b) {
+
+	if((this->m_data.size()!=a.m_data.size()) || (this->m_data.size()!=b.m_data.size())
+			|| this->m_modulus!=a.m_modulus || this->m_modulus!=b.m_modulus ){
+        throw std::logic_error("AddMulInPlace called on NativeVector's with different parameters.");
+	}
+
+	IntegerType modulus = this->m_modulus;
+
+	if (modulus.GetMSB() < NTL_SP_NBITS + 1)
+	{
+		for(usint i=0;i<this->m_data.size();i++)
+			this->m_data[i].ModAddFastOptimizedEq(a.m_data[i].ModMulFastOptimized(b.m_data[i],modulus),modulus);
+	}
+	else
+	{
+		uint64_t *data = GetData();
+		const uint64_t *aData = a.GetData();
+		const uint64_t *bData = b.GetData();
+		uint64_t q = modulus.ConvertToInt();
+		// a*b + c < q^2 <= 2^128, so a single reduction is enough
+		for(usint i=0;i<this->m_data.size();i++)
+			data[i] = (uint64_t)(((unsigned __int128)aData[i]*bData[i] + data[i]) % q);
+	}
+
+	return *this;
+}
+
+template<class IntegerType>
+const NativeVector<IntegerType>& NativeVector<IntegerType>::SubMulInPlace(const NativeVector &a, const NativeVector &b) {
+
+	if((this->m_data.size()!=a.m_data.size()) || (this->m_data.size()!=b.m_data.size())
+			|| this->m_modulus!=a.m_modulus || this->m_modulus!=b.m_modulus ){
+        throw std::logic_error("SubMulInPlace called on NativeVector's with different parameters.");
+	}
+
+	IntegerType modulus = this->m_modulus;
+
+	if (modulus.GetMSB() < NTL_SP_NBITS + 1)
+	{
+		for(usint i=0;i<this->m_data.size();i++)
+			this->m_data[i].ModSubFastEq(a.m_data[i].ModMulFastOptimized(b.m_data[i],modulus),modulus);
+	}
+	else
+	{
+		for(usint i=0;i<this->m_data.size();i++)
+			this->m_data[i].ModSubFastEq(a.m_data[i].ModMulFast(b.m_data[i],modulus),modulus);
+	}
+
+	return *this;
+}
+
+template<class IntegerType>
+const NativeVector<IntegerType>& NativeVector<IntegerType>::AddInnerProductInPlace(
+		const std::vector<std::pair<const NativeVector*, const NativeVector*>> &terms) {
+
+	for(usint k=0;k<terms.size();k++){
+		const NativeVector &a = *terms[k].first;
+		const NativeVector &b = *terms[k].second;
+		if((this->m_data.size()!=a.m_data.size()) || (this->m_data.size()!=b.m_data.size())
+				|| this->m_modulus!=a.m_modulus || this->m_modulus!=b.m_modulus ){
+	        throw std::logic_error("AddInnerProductInPlace called on NativeVector's with different parameters.");
+		}
+	}
+
+	if(terms.size() == 0)
+		return *this;
+
+	uint64_t q = this->m_modulus.ConvertToInt();
+	usint qBits = this->m_modulus.GetMSB();
+
+	// with q < 2^qBits, c + lazy*(q-1)^2 < 2^128 as long as lazy < 2^(128-2*qBits)
+	usint lazyBits = 128 - 2*qBits;
+	if (lazyBits > 31)
+		lazyBits = 31;
+	usint lazy = (lazyBits == 0) ? 1 : ((usint)1 << lazyBits) - 1;
+
+	std::vector<const uint64_t*> aData(terms.size()), bData(terms.size());
+	for(usint k=0;k<terms.size();k++){
+		aData[k] = terms[k].first->GetData();
+		bData[k] = terms[k].second->GetData();
+	}
+
+	uint64_t *data = GetData();
+	for(usint i=0;i<this->m_data.size();i++){
+		unsigned __int128 acc = data[i];
+		usint pending = 0;
+		for(usint k=0;k<terms.size();k++){
+			acc += (unsigned __int128)aData[k][i]*bData[k][i];
+			if (++pending == lazy) {
+				acc %= q;
+				pending = 0;
+			}
+		}
+		data[i] = (uint64_t)(acc % q);
+	}
+
+	return *this;
+}
+
 template<class IntegerType>
 NativeVector<IntegerType> NativeVector<IntegerType>::MultWithOutMod(const NativeVector &b) const {
 
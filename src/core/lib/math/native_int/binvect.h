@@ -37,21 +37,7 @@
 #include "../../utils/serializable.h"
 #include "../../utils/inttypes.h"
 
-
-#include "../../utils/blockAllocator/xvector.h"
-
-//the following should be set to 1 in order to have native vector use block allocations
-//then determine if you want dynamic or static allocations by settingdefining STAIC_POOLS on line 24 of
-// xallocator.cpp
-#define BLOCK_VECTOR_ALLOCATION 0 //set to 1 to use block allocations
-
-
-#include "../../utils/blockAllocator/xvector.h"
-
-//the following should be set to 1 in order to have native vector use block allocations
-//then determine if you want dynamic or static allocations by settingdefining STAIC_POOLS on line 24 of
-// xallocator.cpp
-#define BLOCK_VECTOR_ALLOCATION 0 //set to 1 to use block allocations
+#include "../native_int/nativealloc.h"
 
 /**
  * @namespace native_int
@@ -62,54 +48,6 @@ namespace native_int {
 /**
  * @brief The class for representing vectors of native integers.
  */
-
- #if 0 // allocator that reports bytes used.
-template <class Tp>
-struct NAlloc {
-    typedef Tp value_type;
-    NAlloc() = default;
-    template <class T> NAlloc(const NAlloc<T>&) {}
-    Tp* allocate(std::size_t n) {
-        n *= sizeof(Tp);
-        return static_cast<Tp*>(::operator new(n));
-    }
-    void deallocate(Tp* p, std::size_t n) {
-        std::cout << "deallocating " << n*sizeof*p << " bytes\n";
-        ::operator delete(p);
-    }
-};
-template <class T, class U>
-bool operator==(const NAlloc<T>&, const NAlloc<U>&) { return true; }
-template <class T, class U>
-bool operator!=(const NAlloc<T>&, const NAlloc<U>&) { return false; }
-#endif 
-
-
-
- #if 0 // allocator that reports bytes used.
-template <class Tp>
-struct NAlloc {
-    typedef Tp value_type;
-    NAlloc() = default;
-    template <class T> NAlloc(const NAlloc<T>&) {}
-    Tp* allocate(std::size_t n) {
-        n *= sizeof(Tp);
-        std::cout << "allocating   " << n << " bytes\n";
-        return static_cast<Tp*>(::operator new(n));
-    }
-    void deallocate(Tp* p, std::size_t n) {
-        std::cout << "deallocating " << n*sizeof*p << " bytes\n";
-        ::operator delete(p);
-    }
-};
-template <class T, class U>
-bool operator==(const NAlloc<T>&, const NAlloc<U>&) { return true; }
-template <class T, class U>
-bool operator!=(const NAlloc<T>&, const NAlloc<U>&) { return false; }
-#endif 
-
-
-
 template <class IntegerType>
 class NativeVector : public lbcrypto::BigVectorInterface<NativeVector<IntegerType>,IntegerType>, public lbcrypto::Serializable
 {
@@ -177,7 +115,7 @@ class NativeVector : public lbcrypto::BigVectorInterface<NativeVector<IntegerTyp
 	 *
 	 * @param &&bigVector is the native vector to be moved.
 	 */
-	NativeVector(NativeVector &&bigVector);//move copy constructor
+	NativeVector(NativeVector &&bigVector) noexcept;//move copy constructor
 
 	/**
 	* Assignment operator to assign value from rhs
@@ -193,7 +131,7 @@ class NativeVector : public lbcrypto::BigVectorInterface<NativeVector<IntegerTyp
 	* @param &&rhs is the native vector to be moved.
 	* @return moved NativeVector object
 	*/
-	NativeVector&  operator=(NativeVector &&rhs);
+	NativeVector&  operator=(NativeVector &&rhs) noexcept;
 
 	/**
 	* Initializer list for NativeVector.
@@ -295,6 +233,22 @@ class NativeVector : public lbcrypto::BigVectorInterface<NativeVector<IntegerTyp
 	IntegerType& operator[](size_t idx) { return (this->m_data[idx]); }
 	const IntegerType& operator[](size_t idx) const { return (this->m_data[idx]); }
 
+	/**
+	 * Gives raw access to the values of the vector as a contiguous array of uint64_t,
+	 * aligned on NATIVE_VECTOR_ALIGNMENT bytes. The pointer is invalidated by any
+	 * operation that changes the length of the vector.
+	 *
+	 * @return pointer to the first value; NULL for an empty vector.
+	 */
+	uint64_t* GetData() {
+		static_assert(sizeof(IntegerType) == sizeof(uint64_t), "native integers must wrap a single uint64_t");
+		return reinterpret_cast<uint64_t*>(this->m_data.data());
+	}
+	const uint64_t* GetData() const {
+		static_assert(sizeof(IntegerType) == sizeof(uint64_t), "native integers must wrap a single uint64_t");
+		return reinterpret_cast<const uint64_t*>(this->m_data.data());
+	}
+
 	/**
 	 * Sets the vector modulus.
 	 *
@@ -487,6 +441,36 @@ class NativeVector : public lbcrypto::BigVectorInterface<NativeVector<IntegerTyp
 	 */
 	const NativeVector& ModMulEq(const NativeVector &b);
 
+	/**
+	 * Fused vector modulus multiply-accumulate: this += a*b, in a single pass
+	 * and without a temporary vector.
+	 *
+	 * @param &a is the first vector to multiply.
+	 * @param &b is the second vector to multiply.
+	 * @return this
+	 */
+	const NativeVector& AddMulInPlace(const NativeVector &a, const NativeVector &b);
+
+	/**
+	 * Fused vector modulus multiply-subtract: this -= a*b, in a single pass
+	 * and without a temporary vector.
+	 *
+	 * @param &a is the first vector to multiply.
+	 * @param &b is the second vector to multiply.
+	 * @return this
+	 */
+	const NativeVector& SubMulInPlace(const NativeVector &a, const NativeVector &b);
+
+	/**
+	 * Accumulates an inner product: this += sum_k terms[k].first * terms[k].second.
+	 * The products are accumulated in 128 bits and reduced only when the
+	 * accumulator could overflow, i.e. usually once per entry.
+	 *
+	 * @param &terms are the pairs of vectors to multiply.
+	 * @return this
+	 */
+	const NativeVector& AddInnerProductInPlace(const std::vector<std::pair<const NativeVector*, const NativeVector*>> &terms);
+
 	/**
 	 * Vector multiplication without applying the modulus operation.
 	 *
@@ -541,13 +525,8 @@ class NativeVector : public lbcrypto::BigVectorInterface<NativeVector<IntegerTyp
 	bool Deserialize(const lbcrypto::Serialized& serObj);
 
 private:
-	//m_data is a pointer to the vector
-
-#if BLOCK_VECTOR_ALLOCATION != 1
-	std::vector<IntegerType> m_data;
-#else
-	xvector<IntegerType> m_data;
-#endif
+	//m_data holds the values; its payload is aligned on NATIVE_VECTOR_ALIGNMENT bytes
+	std::vector<IntegerType, NativeVectorAllocator<IntegerType>> m_data;
 	//m_modulus stores the internal modulus of the vector.
 	IntegerType m_modulus = 0;
 
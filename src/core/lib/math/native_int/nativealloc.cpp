@@ -0,0 +1,164 @@
+/**
+ * @file nativealloc.cpp This file contains the memory allocation of native vectors.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "../native_int/nativealloc.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "../../utils/inttypes.h"
+#include "../../utils/blockAllocator/xallocator.h"
+
+namespace native_int
+{
+
+/*
+ * Every block starts with the raw memory obtained from the backend; the aligned payload
+ * is preceded by a header recording where the raw memory starts, how large it is and
+ * which backend it came from.
+ */
+struct BlockHeader {
+	void *base;
+	size_t rawSize;
+	int type;
+};
+
+// thread pool size classes are the powers of two from 2^MIN_CLASS_BITS to 2^MAX_CLASS_BITS bytes;
+// larger blocks always go to the heap
+static const usint MIN_CLASS_BITS = 8;
+static const usint MAX_CLASS_BITS = 26;
+static const size_t MAX_CACHED_BLOCKS = 64;	// per size class and thread
+
+struct ThreadPool {
+	std::vector<void*> m_free[MAX_CLASS_BITS + 1];
+
+	void Release() {
+		for (usint i = 0; i <= MAX_CLASS_BITS; i++) {
+			for (size_t j = 0; j < m_free[i].size(); j++)
+				std::free(m_free[i][j]);
+			m_free[i].clear();
+		}
+	}
+
+	~ThreadPool() { Release(); }
+};
+
+static ThreadPool& LocalPool() {
+	static thread_local ThreadPool pool;
+	return pool;
+}
+
+static std::atomic<int>& ActiveAllocator() {
+	static std::atomic<int> type(NATIVE_ALLOCATOR_HEAP);
+	return type;
+}
+
+NativeAllocatorType NativeVectorMemory::GetAllocator() {
+	return (NativeAllocatorType)ActiveAllocator().load(std::memory_order_relaxed);
+}
+
+void NativeVectorMemory::SetAllocator(NativeAllocatorType type) {
+	ActiveAllocator().store(type, std::memory_order_relaxed);
+}
+
+// smallest size class holding rawSize bytes, or 0 if the block is too large for the pools
+static usint SizeClass(size_t rawSize) {
+	usint bits = MIN_CLASS_BITS;
+	while (bits <= MAX_CLASS_BITS && ((size_t)1 << bits) < rawSize)
+		bits++;
+	return bits <= MAX_CLASS_BITS ? bits : 0;
+}
+
+void* NativeVectorMemory::Allocate(size_t bytes) {
+	if (bytes == 0)
+		return NULL;
+
+	int type = GetAllocator();
+	size_t rawSize = bytes + sizeof(BlockHeader) + NATIVE_VECTOR_ALIGNMENT - 1;
+	void *base = NULL;
+
+	if (type == NATIVE_ALLOCATOR_THREAD_POOL) {
+		usint sizeClass = SizeClass(rawSize);
+		if (sizeClass == 0)
+			type = NATIVE_ALLOCATOR_HEAP;
+		else {
+			rawSize = (size_t)1 << sizeClass;
+			std::vector<void*> &cached = LocalPool().m_free[sizeClass];
+			if (!cached.empty()) {
+				base = cached.back();
+				cached.pop_back();
+			}
+			else
+				base = std::malloc(rawSize);
+		}
+	}
+
+	if (type == NATIVE_ALLOCATOR_BLOCK)
+		base = xmalloc(rawSize);
+	else if (type == NATIVE_ALLOCATOR_HEAP)
+		base = std::malloc(rawSize);
+
+	if (base == NULL)
+		return NULL;
+
+	uintptr_t payload = ((uintptr_t)base + sizeof(BlockHeader) + NATIVE_VECTOR_ALIGNMENT - 1) & ~(uintptr_t)(NATIVE_VECTOR_ALIGNMENT - 1);
+	BlockHeader *header = (BlockHeader *)payload - 1;
+	header->base = base;
+	header->rawSize = rawSize;
+	header->type = type;
+	return (void *)payload;
+}
+
+void NativeVectorMemory::Deallocate(void *ptr) {
+	if (ptr == NULL)
+		return;
+
+	const BlockHeader *header = (const BlockHeader *)ptr - 1;
+	void *base = header->base;
+
+	switch (header->type) {
+	case NATIVE_ALLOCATOR_THREAD_POOL: {
+		std::vector<void*> &cached = LocalPool().m_free[SizeClass(header->rawSize)];
+		if (cached.size() < MAX_CACHED_BLOCKS)
+			cached.push_back(base);
+		else
+			std::free(base);
+		break;
+	}
+	case NATIVE_ALLOCATOR_BLOCK:
+		xfree(base);
+		break;
+	default:
+		std::free(base);
+		break;
+	}
+}
+
+void NativeVectorMemory::ReleaseThreadPool() {
+	LocalPool().Release();
+}
+
+} // namespace native_int ends
@@ -0,0 +1,132 @@
+/**
+ * @file nativealloc.h This file contains the memory allocation of native vectors.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * This file contains the allocator used for the payload of native vectors. All the
+ * payloads are aligned on 64-byte boundaries (a cache line, and the width of an
+ * AVX-512 register); the memory itself comes from a backend selected at runtime.
+ */
+
+#ifndef LBCRYPTO_MATH_NATIVE_NATIVEALLOC_H
+#define LBCRYPTO_MATH_NATIVE_NATIVEALLOC_H
+
+#include <cstddef>
+#include <new>
+
+/**
+ * @namespace native_int
+ * The namespace of native_int
+ */
+namespace native_int {
+
+const size_t NATIVE_VECTOR_ALIGNMENT = 64;	//!< @brief Alignment (in bytes) of the payload of native vectors.
+
+/**
+ * @brief Backends the payload of native vectors can be allocated from.
+ */
+enum NativeAllocatorType {
+	NATIVE_ALLOCATOR_HEAP,			//!< @brief the C heap
+	NATIVE_ALLOCATOR_THREAD_POOL,	//!< @brief per-thread pools of recycled heap blocks, in power-of-two size classes
+	NATIVE_ALLOCATOR_BLOCK			//!< @brief the fixed block allocator of utils/blockAllocator
+};
+
+/**
+ * @brief Memory management for the payload of native vectors.
+ *
+ * Every block records the backend it was allocated from, so blocks can be released
+ * after the backend has been switched, and from any thread.
+ */
+class NativeVectorMemory
+{
+public:
+	/**
+	 * Returns the backend used for new allocations. Defaults to the heap.
+	 *
+	 * @return the active backend.
+	 */
+	static NativeAllocatorType GetAllocator();
+
+	/**
+	 * Selects the backend used for new allocations.
+	 *
+	 * @param type the backend.
+	 */
+	static void SetAllocator(NativeAllocatorType type);
+
+	/**
+	 * Allocates a block aligned on NATIVE_VECTOR_ALIGNMENT bytes.
+	 *
+	 * @param bytes the size of the block.
+	 * @return the block; NULL if bytes is 0.
+	 */
+	static void* Allocate(size_t bytes);
+
+	/**
+	 * Releases a block returned by Allocate.
+	 *
+	 * @param ptr the block; NULL is ignored.
+	 */
+	static void Deallocate(void *ptr);
+
+	/**
+	 * Returns the blocks cached by the thread pool of the calling thread to the heap.
+	 * This also happens automatically when the thread exits.
+	 */
+	static void ReleaseThreadPool();
+};
+
+/**
+ * @brief Standard allocator over NativeVectorMemory, used as the allocator of the
+ * storage of native vectors.
+ */
+template <class Tp>
+struct NativeVectorAllocator {
+	typedef Tp value_type;
+
+	NativeVectorAllocator() {}
+	template <class T> NativeVectorAllocator(const NativeVectorAllocator<T>&) {}
+
+	template <class T> struct rebind { typedef NativeVectorAllocator<T> other; };
+
+	Tp* allocate(std::size_t n) {
+		void *ptr = NativeVectorMemory::Allocate(n * sizeof(Tp));
+		if (ptr == NULL && n != 0)
+			throw std::bad_alloc();
+		return static_cast<Tp*>(ptr);
+	}
+
+	void deallocate(Tp* p, std::size_t) {
+		NativeVectorMemory::Deallocate(p);
+	}
+};
+
+template <class T, class U>
+bool operator==(const NativeVectorAllocator<T>&, const NativeVectorAllocator<U>&) { return true; }
+template <class T, class U>
+bool operator!=(const NativeVectorAllocator<T>&, const NativeVectorAllocator<U>&) { return false; }
+
+} // namespace native_int ends
+
+#endif
@@ -0,0 +1,647 @@
+/**
+ * @file nttkernels.cpp This file contains the butterfly kernels used by the native NTT.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "../native_int/nttkernels.h"
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+// the vectorized kernels are compiled with per-function target attributes, so the
+// library itself does not need to be built with -mavx2/-mavx512f; the instruction
+// set is chosen at runtime
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NTT_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace native_int
+{
+
+static std::atomic<int>& ActiveISA() {
+	static std::atomic<int> isa(NTTKernels::GetSupportedISA());
+	return isa;
+}
+
+NTTKernelISA NTTKernels::GetSupportedISA() {
+#ifdef NTT_KERNELS_X86
+	static const NTTKernelISA supported = [](){
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+			if (__builtin_cpu_supports("avx512ifma"))
+				return NTT_KERNEL_AVX512IFMA;
+			return NTT_KERNEL_AVX512;
+		}
+		if (__builtin_cpu_supports("avx2"))
+			return NTT_KERNEL_AVX2;
+		return NTT_KERNEL_SCALAR;
+	}();
+	return supported;
+#else
+	return NTT_KERNEL_SCALAR;
+#endif
+}
+
+NTTKernelISA NTTKernels::GetISA() {
+	return (NTTKernelISA)ActiveISA().load(std::memory_order_relaxed);
+}
+
+NTTKernelISA NTTKernels::SetISA(NTTKernelISA isa) {
+	NTTKernelISA supported = GetSupportedISA();
+	if (isa > supported)
+		isa = supported;
+	ActiveISA().store(isa, std::memory_order_relaxed);
+	return isa;
+}
+
+std::string NTTKernels::GetISAName(NTTKernelISA isa) {
+	switch (isa) {
+	case NTT_KERNEL_AVX2:
+		return "AVX2";
+	case NTT_KERNEL_AVX512:
+		return "AVX-512";
+	case NTT_KERNEL_AVX512IFMA:
+		return "AVX-512 IFMA";
+	default:
+		return "scalar";
+	}
+}
+
+/*
+ * All kernels use Harvey's lazy butterflies: the coefficients stay in [0,4q) between
+ * stages and the Shoup products are left in [0,2q), so every butterfly needs a single
+ * conditional subtraction. This requires 4q < 2^64, i.e. moduli of at most 62 bits.
+ *
+ * The last stage is fused with the final work on the coefficients: either the reduction
+ * to [0,q), or for the inverse negacyclic transform the multiplication by n^{-1}*psi^{-j},
+ * so that no separate pass over the data is needed.
+ *
+ * Each kernel is written once in terms of the ring dimension n and the butterfly half-size h,
+ * which are given either at run time (Size) or at compile time (FixedSize). The ring dimensions
+ * 2^10 to 2^17 are dispatched to instantiations with fixed sizes, where every stage has constant
+ * loop bounds and strides that the compiler can unroll and hoist.
+ */
+
+struct Size {
+	explicit Size(usint v) : value(v) {}
+	usint Value() const { return value; }
+	usint value;
+};
+
+template<usint V>
+struct FixedSize {
+	static constexpr usint Value() { return V; }
+};
+
+const usint NTT_MIN_FIXED_LOGN = 10;
+const usint NTT_MAX_FIXED_LOGN = 17;
+
+/*
+ * Scalar kernel
+ */
+
+// lazy Shoup modular multiplication; returns a value congruent to x*w mod q in [0,2q) for any x < 2^64, w < q
+static inline uint64_t MulModShoupLazy(uint64_t x, uint64_t w, uint64_t wPrecon, uint64_t q) {
+	uint64_t qhat = (uint64_t)(((unsigned __int128)x * wPrecon) >> 64);
+	return x * w - qhat * q;
+}
+
+static inline uint64_t SubIfGreaterEqual(uint64_t x, uint64_t m) {
+	return x >= m ? x - m : x;
+}
+
+struct ScalarKernel {
+	static const usint WIDTH = 1;
+
+	template<typename Dim, typename Half>
+	static void Stage(uint64_t *a, Dim n, Half h, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+		const uint64_t twoq = q << 1;
+		const uint64_t *w = table + h.Value();
+		const uint64_t *wPrecon = preconTable + h.Value();
+		for (usint j = 0; j < n.Value(); j += 2*h.Value()) {
+			uint64_t *x = a + j;
+			uint64_t *y = x + h.Value();
+			for (usint i = 0; i < h.Value(); i++) {
+				uint64_t u = SubIfGreaterEqual(x[i], twoq);
+				uint64_t t = MulModShoupLazy(y[i], w[i], wPrecon[i], q);
+				x[i] = u + t;
+				y[i] = u - t + twoq;
+			}
+		}
+	}
+
+	// last stage (h = n/2) followed by the reduction to [0,q)
+	template<typename Dim>
+	static void LastStageReduce(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+		const uint64_t twoq = q << 1;
+		const usint h = n.Value() >> 1;
+		uint64_t *x = a;
+		uint64_t *y = a + h;
+		for (usint i = 0; i < h; i++) {
+			uint64_t u = SubIfGreaterEqual(x[i], twoq);
+			uint64_t t = MulModShoupLazy(y[i], table[h + i], preconTable[h + i], q);
+			x[i] = SubIfGreaterEqual(SubIfGreaterEqual(u + t, twoq), q);
+			y[i] = SubIfGreaterEqual(SubIfGreaterEqual(u - t + twoq, twoq), q);
+		}
+	}
+
+	// last stage (h = n/2) followed by the multiplication of coefficient j by scale[j]
+	template<typename Dim>
+	static void LastStageScale(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable,
+			const uint64_t *scale, const uint64_t *preconScale, uint64_t q) {
+		const uint64_t twoq = q << 1;
+		const usint h = n.Value() >> 1;
+		uint64_t *x = a;
+		uint64_t *y = a + h;
+		for (usint i = 0; i < h; i++) {
+			uint64_t u = SubIfGreaterEqual(x[i], twoq);
+			uint64_t t = MulModShoupLazy(y[i], table[h + i], preconTable[h + i], q);
+			x[i] = SubIfGreaterEqual(MulModShoupLazy(u + t, scale[i], preconScale[i], q), q);
+			y[i] = SubIfGreaterEqual(MulModShoupLazy(u - t + twoq, scale[h + i], preconScale[h + i], q), q);
+		}
+	}
+};
+
+// the n = 1 "transform": only the final reduction or scaling is left
+static void FinishSingle(uint64_t *a, const uint64_t *scale, const uint64_t *preconScale, uint64_t q) {
+	uint64_t u = SubIfGreaterEqual(a[0], q << 1);
+	if (scale != NULL)
+		u = MulModShoupLazy(u, scale[0], preconScale[0], q);
+	a[0] = SubIfGreaterEqual(u, q);
+}
+
+/*
+ * Bit-reversal permutations that feed the butterflies; j runs through the bit-reversed
+ * values of i. Both support out == in.
+ */
+
+static void BitReverse(uint64_t *out, const uint64_t *in, usint n) {
+	for (usint i = 0, j = 0; i < n; i++) {
+		if (out != in)
+			out[i] = in[j];
+		else if (i < j)
+			std::swap(out[i], out[j]);
+		usint bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j |= bit;
+	}
+}
+
+// bit-reversal permutation merged with the negacyclic twist: out[i] = in[j]*twist[j] for j = br(i)
+static void TwistBitReverse(uint64_t *out, const uint64_t *in, usint n, const uint64_t *twist, const uint64_t *preconTwist, uint64_t q) {
+	for (usint i = 0, j = 0; i < n; i++) {
+		if (out != in)
+			out[i] = MulModShoupLazy(in[j], twist[j], preconTwist[j], q);
+		else if (i < j) {
+			uint64_t xi = in[i];
+			out[i] = MulModShoupLazy(in[j], twist[j], preconTwist[j], q);
+			out[j] = MulModShoupLazy(xi, twist[i], preconTwist[i], q);
+		}
+		else if (i == j)
+			out[i] = MulModShoupLazy(in[i], twist[i], preconTwist[i], q);
+		usint bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j |= bit;
+	}
+}
+
+#ifdef NTT_KERNELS_X86
+
+/*
+ * AVX2 kernel: 4 butterflies per instruction. AVX2 has no 64x64-bit multiplication, so
+ * the products are assembled from 32x32-bit partial products. AVX2 only has signed
+ * 64-bit comparisons; flipping the sign bit of both operands turns them into unsigned ones.
+ */
+
+__attribute__((target("avx2")))
+static inline __m256i MulHi64AVX2(__m256i a, __m256i b) {
+	const __m256i lo32 = _mm256_set1_epi64x(0xFFFFFFFF);
+	__m256i aHi = _mm256_srli_epi64(a, 32);
+	__m256i bHi = _mm256_srli_epi64(b, 32);
+	__m256i ll = _mm256_mul_epu32(a, b);
+	__m256i lh = _mm256_mul_epu32(a, bHi);
+	__m256i hl = _mm256_mul_epu32(aHi, b);
+	__m256i hh = _mm256_mul_epu32(aHi, bHi);
+	__m256i mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_and_si256(lh, lo32));
+	mid = _mm256_add_epi64(mid, _mm256_and_si256(hl, lo32));
+	__m256i hi = _mm256_add_epi64(hh, _mm256_srli_epi64(lh, 32));
+	hi = _mm256_add_epi64(hi, _mm256_srli_epi64(hl, 32));
+	return _mm256_add_epi64(hi, _mm256_srli_epi64(mid, 32));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i MulLo64AVX2(__m256i a, __m256i b) {
+	__m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+			_mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+	return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i MulModShoupLazyAVX2(__m256i x, __m256i w, __m256i wPrecon, __m256i vq) {
+	__m256i qhat = MulHi64AVX2(x, wPrecon);
+	return _mm256_sub_epi64(MulLo64AVX2(x, w), MulLo64AVX2(qhat, vq));
+}
+
+// subtracts m from the lanes of x that are >= m; mMinusOneFlipped is (m-1) with the sign bit flipped
+__attribute__((target("avx2")))
+static inline __m256i SubIfGreaterEqualAVX2(__m256i x, __m256i m, __m256i mMinusOneFlipped) {
+	const __m256i sign = _mm256_set1_epi64x(1ULL << 63);
+	__m256i ge = _mm256_cmpgt_epi64(_mm256_xor_si256(x, sign), mMinusOneFlipped);
+	return _mm256_sub_epi64(x, _mm256_and_si256(ge, m));
+}
+
+struct AVX2Kernel {
+	static const usint WIDTH = 4;
+
+	template<typename Dim, typename Half>
+	__attribute__((target("avx2")))
+	static void Stage(uint64_t *a, Dim n, Half h, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+		if (h.Value() < WIDTH) {
+			ScalarKernel::Stage(a, n, h, table, preconTable, q);
+			return;
+		}
+		const __m256i vq = _mm256_set1_epi64x(q);
+		const __m256i vtwoq = _mm256_set1_epi64x(q << 1);
+		const __m256i vtwoqFlipped = _mm256_set1_epi64x(((q << 1) - 1) ^ (1ULL << 63));
+		for (usint j = 0; j < n.Value(); j += 2*h.Value()) {
+			uint64_t *x = a + j;
+			uint64_t *y = x + h.Value();
+			for (usint i = 0; i < h.Value(); i += WIDTH) {
+				__m256i w = _mm256_loadu_si256((const __m256i *)(table + h.Value() + i));
+				__m256i wPrecon = _mm256_loadu_si256((const __m256i *)(preconTable + h.Value() + i));
+				__m256i u = _mm256_loadu_si256((const __m256i *)(x + i));
+				__m256i v = _mm256_loadu_si256((const __m256i *)(y + i));
+
+				u = SubIfGreaterEqualAVX2(u, vtwoq, vtwoqFlipped);
+				__m256i t = MulModShoupLazyAVX2(v, w, wPrecon, vq);
+
+				_mm256_storeu_si256((__m256i *)(x + i), _mm256_add_epi64(u, t));
+				_mm256_storeu_si256((__m256i *)(y + i), _mm256_add_epi64(_mm256_sub_epi64(u, t), vtwoq));
+			}
+		}
+	}
+
+	template<typename Dim>
+	__attribute__((target("avx2")))
+	static void LastStageReduce(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+		const __m256i vq = _mm256_set1_epi64x(q);
+		const __m256i vtwoq = _mm256_set1_epi64x(q << 1);
+		const __m256i vqFlipped = _mm256_set1_epi64x((q - 1) ^ (1ULL << 63));
+		const __m256i vtwoqFlipped = _mm256_set1_epi64x(((q << 1) - 1) ^ (1ULL << 63));
+		const usint h = n.Value() >> 1;
+		uint64_t *x = a;
+		uint64_t *y = a + h;
+		for (usint i = 0; i < h; i += WIDTH) {
+			__m256i w = _mm256_loadu_si256((const __m256i *)(table + h + i));
+			__m256i wPrecon = _mm256_loadu_si256((const __m256i *)(preconTable + h + i));
+			__m256i u = _mm256_loadu_si256((const __m256i *)(x + i));
+			__m256i v = _mm256_loadu_si256((const __m256i *)(y + i));
+
+			u = SubIfGreaterEqualAVX2(u, vtwoq, vtwoqFlipped);
+			__m256i t = MulModShoupLazyAVX2(v, w, wPrecon, vq);
+			__m256i sum = _mm256_add_epi64(u, t);
+			__m256i diff = _mm256_add_epi64(_mm256_sub_epi64(u, t), vtwoq);
+			sum = SubIfGreaterEqualAVX2(SubIfGreaterEqualAVX2(sum, vtwoq, vtwoqFlipped), vq, vqFlipped);
+			diff = SubIfGreaterEqualAVX2(SubIfGreaterEqualAVX2(diff, vtwoq, vtwoqFlipped), vq, vqFlipped);
+
+			_mm256_storeu_si256((__m256i *)(x + i), sum);
+			_mm256_storeu_si256((__m256i *)(y + i), diff);
+		}
+	}
+
+	template<typename Dim>
+	__attribute__((target("avx2")))
+	static void LastStageScale(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable,
+			const uint64_t *scale, const uint64_t *preconScale, uint64_t q) {
+		const __m256i vq = _mm256_set1_epi64x(q);
+		const __m256i vtwoq = _mm256_set1_epi64x(q << 1);
+		const __m256i vqFlipped = _mm256_set1_epi64x((q - 1) ^ (1ULL << 63));
+		const __m256i vtwoqFlipped = _mm256_set1_epi64x(((q << 1) - 1) ^ (1ULL << 63));
+		const usint h = n.Value() >> 1;
+		uint64_t *x = a;
+		uint64_t *y = a + h;
+		for (usint i = 0; i < h; i += WIDTH) {
+			__m256i w = _mm256_loadu_si256((const __m256i *)(table + h + i));
+			__m256i wPrecon = _mm256_loadu_si256((const __m256i *)(preconTable + h + i));
+			__m256i u = _mm256_loadu_si256((const __m256i *)(x + i));
+			__m256i v = _mm256_loadu_si256((const __m256i *)(y + i));
+
+			u = SubIfGreaterEqualAVX2(u, vtwoq, vtwoqFlipped);
+			__m256i t = MulModShoupLazyAVX2(v, w, wPrecon, vq);
+			__m256i sum = _mm256_add_epi64(u, t);
+			__m256i diff = _mm256_add_epi64(_mm256_sub_epi64(u, t), vtwoq);
+			sum = MulModShoupLazyAVX2(sum, _mm256_loadu_si256((const __m256i *)(scale + i)),
+					_mm256_loadu_si256((const __m256i *)(preconScale + i)), vq);
+			diff = MulModShoupLazyAVX2(diff, _mm256_loadu_si256((const __m256i *)(scale + h + i)),
+					_mm256_loadu_si256((const __m256i *)(preconScale + h + i)), vq);
+
+			_mm256_storeu_si256((__m256i *)(x + i), SubIfGreaterEqualAVX2(sum, vq, vqFlipped));
+			_mm256_storeu_si256((__m256i *)(y + i), SubIfGreaterEqualAVX2(diff, vq, vqFlipped));
+		}
+	}
+};
+
+/*
+ * AVX-512 kernel: 8 butterflies per instruction. The high half of the Shoup product is
+ * still assembled from 32x32-bit partial products; the low halves use AVX512DQ.
+ * min(x, x-m) is the unsigned conditional subtraction of m.
+ *
+ * The AVX-512 IFMA kernel for moduli below 2^50 shares the butterflies: the 52-bit
+ * multiply-add instructions give both halves of the Shoup product directly, as all
+ * coefficients stay below 4q < 2^52. The 52-bit precomputation floor(w*2^52/q) is
+ * obtained from the 64-bit one by a shift.
+ *
+ * Shifts, minima and 32-bit multiplications use the zero-masked intrinsics with all lanes
+ * selected: the unmasked ones pass an undefined vector that gcc reports as uninitialized.
+ */
+
+static const __mmask8 AVX512_ALL_LANES = 0xFF;
+
+__attribute__((target("avx512f,avx512dq")))
+static inline __m512i MulHi64AVX512(__m512i a, __m512i b) {
+	const __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFF);
+	__m512i aHi = _mm512_maskz_srli_epi64(AVX512_ALL_LANES, a, 32);
+	__m512i bHi = _mm512_maskz_srli_epi64(AVX512_ALL_LANES, b, 32);
+	__m512i ll = _mm512_maskz_mul_epu32(AVX512_ALL_LANES, a, b);
+	__m512i lh = _mm512_maskz_mul_epu32(AVX512_ALL_LANES, a, bHi);
+	__m512i hl = _mm512_maskz_mul_epu32(AVX512_ALL_LANES, aHi, b);
+	__m512i hh = _mm512_maskz_mul_epu32(AVX512_ALL_LANES, aHi, bHi);
+	__m512i mid = _mm512_add_epi64(_mm512_maskz_srli_epi64(AVX512_ALL_LANES, ll, 32), _mm512_and_si512(lh, lo32));
+	mid = _mm512_add_epi64(mid, _mm512_and_si512(hl, lo32));
+	__m512i hi = _mm512_add_epi64(hh, _mm512_maskz_srli_epi64(AVX512_ALL_LANES, lh, 32));
+	hi = _mm512_add_epi64(hi, _mm512_maskz_srli_epi64(AVX512_ALL_LANES, hl, 32));
+	return _mm512_add_epi64(hi, _mm512_maskz_srli_epi64(AVX512_ALL_LANES, mid, 32));
+}
+
+__attribute__((target("avx512f,avx512dq")))
+static inline __m512i SubIfGreaterEqualAVX512(__m512i x, __m512i m) {
+	return _mm512_maskz_min_epu64(AVX512_ALL_LANES, x, _mm512_sub_epi64(x, m));
+}
+
+// lazy Shoup multiplication of the AVX-512 kernel
+struct MulAVX512 {
+	__attribute__((target("avx512f,avx512dq")))
+	static inline __m512i MulModShoupLazy(__m512i x, __m512i w, __m512i wPrecon, __m512i vq) {
+		__m512i qhat = MulHi64AVX512(x, wPrecon);
+		return _mm512_sub_epi64(_mm512_mullo_epi64(x, w), _mm512_mullo_epi64(qhat, vq));
+	}
+};
+
+// lazy Shoup multiplication of the AVX-512 IFMA kernel
+struct MulAVX512IFMA {
+	__attribute__((target("avx512f,avx512dq,avx512ifma")))
+	static inline __m512i MulModShoupLazy(__m512i x, __m512i w, __m512i wPrecon, __m512i vq) {
+		const __m512i zero = _mm512_setzero_si512();
+		const __m512i mask52 = _mm512_set1_epi64((1ULL << 52) - 1);
+		__m512i qhat = _mm512_madd52hi_epu64(zero, x, _mm512_maskz_srli_epi64(AVX512_ALL_LANES, wPrecon, 12));
+		__m512i r = _mm512_sub_epi64(_mm512_madd52lo_epu64(zero, x, w), _mm512_madd52lo_epu64(zero, qhat, vq));
+		return _mm512_and_si512(r, mask52);
+	}
+};
+
+// The kernels are written once for both multiplications: the target of a function cannot
+// depend on a template parameter, and the kernel without IFMA must not be compiled for IFMA
+#define NTT_AVX512_KERNEL(NAME, MUL, TARGET) \
+struct NAME { \
+	static const usint WIDTH = 8; \
+ \
+	template<typename Dim, typename Half> \
+	__attribute__((target(TARGET))) \
+	static void Stage(uint64_t *a, Dim n, Half h, const uint64_t *table, const uint64_t *preconTable, uint64_t q) { \
+		if (h.Value() < WIDTH) { \
+			ScalarKernel::Stage(a, n, h, table, preconTable, q); \
+			return; \
+		} \
+		const __m512i vq = _mm512_set1_epi64(q); \
+		const __m512i vtwoq = _mm512_set1_epi64(q << 1); \
+		for (usint j = 0; j < n.Value(); j += 2*h.Value()) { \
+			uint64_t *x = a + j; \
+			uint64_t *y = x + h.Value(); \
+			for (usint i = 0; i < h.Value(); i += WIDTH) { \
+				__m512i w = _mm512_loadu_si512((const void *)(table + h.Value() + i)); \
+				__m512i wPrecon = _mm512_loadu_si512((const void *)(preconTable + h.Value() + i)); \
+				__m512i u = _mm512_loadu_si512((const void *)(x + i)); \
+				__m512i v = _mm512_loadu_si512((const void *)(y + i)); \
+ \
+				u = SubIfGreaterEqualAVX512(u, vtwoq); \
+				__m512i t = MUL::MulModShoupLazy(v, w, wPrecon, vq); \
+ \
+				_mm512_storeu_si512((void *)(x + i), _mm512_add_epi64(u, t)); \
+				_mm512_storeu_si512((void *)(y + i), _mm512_add_epi64(_mm512_sub_epi64(u, t), vtwoq)); \
+			} \
+		} \
+	} \
+ \
+	template<typename Dim> \
+	__attribute__((target(TARGET))) \
+	static void LastStageReduce(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable, uint64_t q) { \
+		const __m512i vq = _mm512_set1_epi64(q); \
+		const __m512i vtwoq = _mm512_set1_epi64(q << 1); \
+		const usint h = n.Value() >> 1; \
+		uint64_t *x = a; \
+		uint64_t *y = a + h; \
+		for (usint i = 0; i < h; i += WIDTH) { \
+			__m512i w = _mm512_loadu_si512((const void *)(table + h + i)); \
+			__m512i wPrecon = _mm512_loadu_si512((const void *)(preconTable + h + i)); \
+			__m512i u = _mm512_loadu_si512((const void *)(x + i)); \
+			__m512i v = _mm512_loadu_si512((const void *)(y + i)); \
+ \
+			u = SubIfGreaterEqualAVX512(u, vtwoq); \
+			__m512i t = MUL::MulModShoupLazy(v, w, wPrecon, vq); \
+			__m512i sum = _mm512_add_epi64(u, t); \
+			__m512i diff = _mm512_add_epi64(_mm512_sub_epi64(u, t), vtwoq); \
+			sum = SubIfGreaterEqualAVX512(SubIfGreaterEqualAVX512(sum, vtwoq), vq); \
+			diff = SubIfGreaterEqualAVX512(SubIfGreaterEqualAVX512(diff, vtwoq), vq); \
+ \
+			_mm512_storeu_si512((void *)(x + i), sum); \
+			_mm512_storeu_si512((void *)(y + i), diff); \
+		} \
+	} \
+ \
+	template<typename Dim> \
+	__attribute__((target(TARGET))) \
+	static void LastStageScale(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable, \
+			const uint64_t *scale, const uint64_t *preconScale, uint64_t q) { \
+		const __m512i vq = _mm512_set1_epi64(q); \
+		const __m512i vtwoq = _mm512_set1_epi64(q << 1); \
+		const usint h = n.Value() >> 1; \
+		uint64_t *x = a; \
+		uint64_t *y = a + h; \
+		for (usint i = 0; i < h; i += WIDTH) { \
+			__m512i w = _mm512_loadu_si512((const void *)(table + h + i)); \
+			__m512i wPrecon = _mm512_loadu_si512((const void *)(preconTable + h + i)); \
+			__m512i u = _mm512_loadu_si512((const void *)(x + i)); \
+			__m512i v = _mm512_loadu_si512((const void *)(y + i)); \
+ \
+			u = SubIfGreaterEqualAVX512(u, vtwoq); \
+			__m512i t = MUL::MulModShoupLazy(v, w, wPrecon, vq); \
+			__m512i sum = _mm512_add_epi64(u, t); \
+			__m512i diff = _mm512_add_epi64(_mm512_sub_epi64(u, t), vtwoq); \
+			sum = MUL::MulModShoupLazy(sum, _mm512_loadu_si512((const void *)(scale + i)), \
+					_mm512_loadu_si512((const void *)(preconScale + i)), vq); \
+			diff = MUL::MulModShoupLazy(diff, _mm512_loadu_si512((const void *)(scale + h + i)), \
+					_mm512_loadu_si512((const void *)(preconScale + h + i)), vq); \
+ \
+			_mm512_storeu_si512((void *)(x + i), SubIfGreaterEqualAVX512(sum, vq)); \
+			_mm512_storeu_si512((void *)(y + i), SubIfGreaterEqualAVX512(diff, vq)); \
+		} \
+	} \
+};
+
+NTT_AVX512_KERNEL(AVX512Kernel, MulAVX512, "avx512f,avx512dq")
+NTT_AVX512_KERNEL(AVX512IFMAKernel, MulAVX512IFMA, "avx512f,avx512dq,avx512ifma")
+
+#undef NTT_AVX512_KERNEL
+
+#endif
+
+/*
+ * Drivers shared by all the kernels
+ */
+
+// stages h = H, 2H, ..., n/4 for a ring dimension known at compile time; the recursion
+// ends through the tag once 2H reaches n/2
+template<typename Kernel, usint N, usint H>
+static void FixedStages(uint64_t *, FixedSize<N>, FixedSize<H>, const uint64_t *, const uint64_t *, uint64_t, std::false_type) {
+}
+
+template<typename Kernel, usint N, usint H>
+static void FixedStages(uint64_t *a, FixedSize<N> n, FixedSize<H> h, const uint64_t *table, const uint64_t *preconTable,
+		uint64_t q, std::true_type) {
+	Kernel::Stage(a, n, h, table, preconTable, q);
+	FixedStages<Kernel>(a, n, FixedSize<2*H>(), table, preconTable, q, std::integral_constant<bool, (4*H < N)>());
+}
+
+// all the stages but the last one
+template<typename Kernel, usint N>
+static void Stages(uint64_t *a, FixedSize<N> n, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+	FixedStages<Kernel>(a, n, FixedSize<1>(), table, preconTable, q, std::integral_constant<bool, (2 < N)>());
+}
+
+template<typename Kernel>
+static void Stages(uint64_t *a, Size n, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+	for (usint h = 1; h < (n.Value() >> 1); h <<= 1)
+		Kernel::Stage(a, n, Size(h), table, preconTable, q);
+}
+
+template<typename Kernel, typename Dim>
+static void RunButterflies(uint64_t *a, Dim n, const uint64_t *table, const uint64_t *preconTable,
+		const uint64_t *scale, const uint64_t *preconScale, uint64_t q) {
+	if (n.Value() < 2) {
+		FinishSingle(a, scale, preconScale, q);
+		return;
+	}
+	// the last stage has n/2 butterflies, which must fill at least one vector
+	if (n.Value() < 2 * Kernel::WIDTH) {
+		RunButterflies<ScalarKernel>(a, Size(n.Value()), table, preconTable, scale, preconScale, q);
+		return;
+	}
+	Stages<Kernel>(a, n, table, preconTable, q);
+	if (scale == NULL)
+		Kernel::LastStageReduce(a, n, table, preconTable, q);
+	else
+		Kernel::LastStageScale(a, n, table, preconTable, scale, preconScale, q);
+}
+
+// dispatches the ring dimensions 2^10 to 2^17 to the kernels specialized for them
+template<typename Kernel>
+static void DispatchDimension(uint64_t *a, usint n, const uint64_t *table, const uint64_t *preconTable,
+		const uint64_t *scale, const uint64_t *preconScale, uint64_t q) {
+	static_assert(NTT_MIN_FIXED_LOGN == 10 && NTT_MAX_FIXED_LOGN == 17, "update the cases below");
+	switch (n) {
+	case 1 << 10:
+		RunButterflies<Kernel>(a, FixedSize<1 << 10>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 11:
+		RunButterflies<Kernel>(a, FixedSize<1 << 11>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 12:
+		RunButterflies<Kernel>(a, FixedSize<1 << 12>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 13:
+		RunButterflies<Kernel>(a, FixedSize<1 << 13>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 14:
+		RunButterflies<Kernel>(a, FixedSize<1 << 14>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 15:
+		RunButterflies<Kernel>(a, FixedSize<1 << 15>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 16:
+		RunButterflies<Kernel>(a, FixedSize<1 << 16>(), table, preconTable, scale, preconScale, q);
+		return;
+	case 1 << 17:
+		RunButterflies<Kernel>(a, FixedSize<1 << 17>(), table, preconTable, scale, preconScale, q);
+		return;
+	default:
+		RunButterflies<Kernel>(a, Size(n), table, preconTable, scale, preconScale, q);
+		return;
+	}
+}
+
+// runs the butterflies with the kernel of the active instruction set
+static void DispatchButterflies(uint64_t *a, usint n, const uint64_t *table, const uint64_t *preconTable,
+		const uint64_t *scale, const uint64_t *preconScale, uint64_t q) {
+#ifdef NTT_KERNELS_X86
+	switch (NTTKernels::GetISA()) {
+	case NTT_KERNEL_AVX512IFMA:
+		if (q < (1ULL << NTT_KERNEL_IFMA_MODULUS_BITS)) {
+			DispatchDimension<AVX512IFMAKernel>(a, n, table, preconTable, scale, preconScale, q);
+			return;
+		}
+		DispatchDimension<AVX512Kernel>(a, n, table, preconTable, scale, preconScale, q);
+		return;
+	case NTT_KERNEL_AVX512:
+		DispatchDimension<AVX512Kernel>(a, n, table, preconTable, scale, preconScale, q);
+		return;
+	case NTT_KERNEL_AVX2:
+		DispatchDimension<AVX2Kernel>(a, n, table, preconTable, scale, preconScale, q);
+		return;
+	default:
+		break;
+	}
+#endif
+	DispatchDimension<ScalarKernel>(a, n, table, preconTable, scale, preconScale, q);
+}
+
+void NTTKernels::Butterflies(uint64_t *a, usint n, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+	DispatchButterflies(a, n, table, preconTable, NULL, NULL, q);
+}
+
+void NTTKernels::ForwardNegacyclic(uint64_t *out, const uint64_t *in, usint n, const uint64_t *twistTable,
+		const uint64_t *preconTwistTable, const uint64_t *table, const uint64_t *preconTable, uint64_t q) {
+	TwistBitReverse(out, in, n, twistTable, preconTwistTable, q);
+	DispatchButterflies(out, n, table, preconTable, NULL, NULL, q);
+}
+
+void NTTKernels::InverseNegacyclic(uint64_t *out, const uint64_t *in, usint n, const uint64_t *table,
+		const uint64_t *preconTable, const uint64_t *scaleTable, const uint64_t *preconScaleTable, uint64_t q) {
+	BitReverse(out, in, n);
+	DispatchButterflies(out, n, table, preconTable, scaleTable, preconScaleTable, q);
+}
+
+} // namespace native_int ends
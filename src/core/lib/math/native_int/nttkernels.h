@@ -0,0 +1,172 @@
+/**
+ * @file nttkernels.h This file contains the butterfly kernels used by the native NTT.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * This file contains the butterfly kernels that operate directly on the uint64_t
+ * payload of native vectors. The kernels are selected at runtime according to the
+ * instruction set supported by the CPU (AVX-512, AVX2 or portable scalar code).
+ */
+
+#ifndef LBCRYPTO_MATH_NATIVE_NTTKERNELS_H
+#define LBCRYPTO_MATH_NATIVE_NTTKERNELS_H
+
+#include <cstdint>
+#include <string>
+#include "../../utils/inttypes.h"
+
+/**
+ * @namespace native_int
+ * The namespace of native_int
+ */
+namespace native_int {
+
+const usint NTT_KERNEL_MAX_MODULUS_BITS = 62;	//!< @brief Largest modulus (in bits) supported by the butterfly kernels.
+const usint NTT_KERNEL_IFMA_MODULUS_BITS = 50;	//!< @brief Largest modulus (in bits) for which the AVX-512 IFMA kernel is used.
+
+/**
+ * @brief Instruction sets the NTT butterfly kernels can be dispatched to.
+ * The values are ordered from the least to the most capable one.
+ */
+enum NTTKernelISA {
+	NTT_KERNEL_SCALAR,
+	NTT_KERNEL_AVX2,
+	NTT_KERNEL_AVX512,
+	NTT_KERNEL_AVX512IFMA
+};
+
+/**
+ * @brief Runtime-dispatched butterfly kernels for the native number theoretic transform.
+ *
+ * All kernels use Shoup's modular multiplication: every twiddle factor w comes with
+ * a precomputed value floor(w*2^64/q) (see ShoupPrecon). The twiddle factors are
+ * expected in "stage order": for every stage with butterfly half-size h (h = 1, 2, 4, ..., n/2)
+ * the h factors used by that stage are stored contiguously starting at index h, i.e.
+ * table[h+i] = omega_{2h}^i. Entry 0 is unused. A table built for ring dimension n can
+ * be used for any smaller power-of-two dimension.
+ *
+ * The ring dimensions 2^10 to 2^17 run kernels specialized for them at compile time;
+ * other dimensions run the same kernels with the dimension known only at run time.
+ */
+class NTTKernels
+{
+public:
+	/**
+	 * Returns the instruction set currently used by the kernels.
+	 * Defaults to the most capable one supported by the CPU.
+	 *
+	 * @return the active instruction set.
+	 */
+	static NTTKernelISA GetISA();
+
+	/**
+	 * Selects the instruction set used by the kernels. Requests for instruction sets
+	 * not supported by the CPU fall back to the most capable supported one.
+	 * This is mostly useful for testing and benchmarking.
+	 *
+	 * @param isa the requested instruction set.
+	 * @return the instruction set that was actually selected.
+	 */
+	static NTTKernelISA SetISA(NTTKernelISA isa);
+
+	/**
+	 * Returns the most capable instruction set supported by the CPU.
+	 *
+	 * @return the detected instruction set.
+	 */
+	static NTTKernelISA GetSupportedISA();
+
+	/**
+	 * Returns a printable name for an instruction set.
+	 *
+	 * @param isa the instruction set.
+	 * @return its name.
+	 */
+	static std::string GetISAName(NTTKernelISA isa);
+
+	/**
+	 * Computes the Shoup precomputation floor(w*2^64/q) for a multiplicand w < q.
+	 *
+	 * @param w the multiplicand.
+	 * @param q the modulus.
+	 * @return the precomputed factor.
+	 */
+	static uint64_t ShoupPrecon(uint64_t w, uint64_t q) {
+		return (uint64_t)((((unsigned __int128)w) << 64) / q);
+	}
+
+	/**
+	 * Runs all the butterfly stages of an iterative (decimation in time) transform
+	 * in place. The input is expected in bit-reversed order and the output is produced
+	 * in natural order. The butterflies use Harvey's lazy reduction: intermediate values
+	 * are kept in [0,4q) and the last stage reduces the output to [0,q).
+	 * Inputs may be anywhere in [0,4q).
+	 *
+	 * @param a the coefficients to transform.
+	 * @param n the length of the transform (a power of two).
+	 * @param table the twiddle factors in stage order.
+	 * @param preconTable the Shoup precomputations for table.
+	 * @param q the modulus, at most NTT_KERNEL_MAX_MODULUS_BITS bits.
+	 */
+	static void Butterflies(uint64_t *a, usint n, const uint64_t *table, const uint64_t *preconTable, uint64_t q);
+
+	/**
+	 * Forward negacyclic transform: out[k] = sum_j in[j]*psi^(j(2k+1)) mod q, where psi is
+	 * a primitive 2n-th root of unity. The multiplication by psi^j is merged into the
+	 * bit-reversal pass that feeds the butterflies, so the input is read exactly once.
+	 * out may be equal to in.
+	 *
+	 * @param out the output coefficients, in [0,q).
+	 * @param in the input coefficients, in [0,q).
+	 * @param n the length of the transform (a power of two).
+	 * @param twistTable the powers psi^j in natural order (at least n entries).
+	 * @param preconTwistTable the Shoup precomputations for twistTable.
+	 * @param table the twiddle factors (powers of psi^2) in stage order.
+	 * @param preconTable the Shoup precomputations for table.
+	 * @param q the modulus, at most NTT_KERNEL_MAX_MODULUS_BITS bits.
+	 */
+	static void ForwardNegacyclic(uint64_t *out, const uint64_t *in, usint n, const uint64_t *twistTable,
+			const uint64_t *preconTwistTable, const uint64_t *table, const uint64_t *preconTable, uint64_t q);
+
+	/**
+	 * Inverse negacyclic transform, the inverse of ForwardNegacyclic. The multiplication
+	 * of coefficient j by n^{-1}*psi^{-j} is merged into the last butterfly stage.
+	 * out may be equal to in.
+	 *
+	 * @param out the output coefficients, in [0,q).
+	 * @param in the input coefficients, in [0,q).
+	 * @param n the length of the transform (a power of two).
+	 * @param table the inverse twiddle factors (powers of psi^{-2}) in stage order.
+	 * @param preconTable the Shoup precomputations for table.
+	 * @param scaleTable the factors n^{-1}*psi^{-j} in natural order (exactly n entries).
+	 * @param preconScaleTable the Shoup precomputations for scaleTable.
+	 * @param q the modulus, at most NTT_KERNEL_MAX_MODULUS_BITS bits.
+	 */
+	static void InverseNegacyclic(uint64_t *out, const uint64_t *in, usint n, const uint64_t *table,
+			const uint64_t *preconTable, const uint64_t *scaleTable, const uint64_t *preconScaleTable, uint64_t q);
+};
+
+} // namespace native_int ends
+
+#endif
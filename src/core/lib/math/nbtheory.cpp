@@ -587,7 +587,7 @@ namespace lbcrypto {
 				result.push_back(i);
 		}
 
-		return std::move(result);
+		return result;
 	}
 
 	/* Calculate the remainder from polynomial division */
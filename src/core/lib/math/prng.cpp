@@ -0,0 +1,329 @@
+/*
+ * @file prng.cpp This code provides the pseudorandom number engines used by the distribution generators.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "prng.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+// the AVX2 code is compiled with per-function target attributes and chosen at runtime
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PRNG_X86 1
+#include <immintrin.h>
+#endif
+
+namespace lbcrypto {
+
+// eight 32-bit lanes; lane b works on block b of the group
+typedef uint32_t ChaChaLanes __attribute__((vector_size(32)));
+
+#define CHACHA_ROTATE(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define CHACHA_QUARTER_ROUND(a, b, c, d) \
+	a += b; d ^= a; d = CHACHA_ROTATE(d, 16); \
+	c += d; b ^= c; b = CHACHA_ROTATE(b, 12); \
+	a += b; d ^= a; d = CHACHA_ROTATE(d, 8); \
+	c += d; b ^= c; b = CHACHA_ROTATE(b, 7);
+
+/**
+ * Computes the blocks state[12..13], state[12..13]+1, ..., state[12..13]+7 and writes
+ * them one after the other (in the byte order of the reference implementation on
+ * little-endian machines). Compiled once per instruction set by the wrappers below.
+ */
+static inline __attribute__((always_inline)) void ChaChaBlocks(const uint32_t state[16], uint64_t *out) {
+	ChaChaLanes x[16], input[16];
+
+	for (int w = 0; w < 16; w++)
+		for (int b = 0; b < 8; b++)
+			input[w][b] = state[w];
+
+	// per-lane 64-bit block counters
+	for (int b = 0; b < 8; b++) {
+		uint64_t counter = ((uint64_t)state[13] << 32 | state[12]) + b;
+		input[12][b] = (uint32_t)counter;
+		input[13][b] = (uint32_t)(counter >> 32);
+	}
+
+	for (int w = 0; w < 16; w++)
+		x[w] = input[w];
+
+	for (int round = 0; round < 10; round++) {
+		CHACHA_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+		CHACHA_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+		CHACHA_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+		CHACHA_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+		CHACHA_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+		CHACHA_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+		CHACHA_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+		CHACHA_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+	}
+
+	for (int w = 0; w < 16; w++)
+		x[w] += input[w];
+
+	// transpose the lanes into consecutive blocks
+	for (int b = 0; b < 8; b++)
+		for (int w = 0; w < 8; w++)
+			out[b*8 + w] = (uint64_t)x[2*w][b] | ((uint64_t)x[2*w+1][b] << 32);
+}
+
+#undef CHACHA_QUARTER_ROUND
+#undef CHACHA_ROTATE
+
+static void ChaChaBlocksPortable(const uint32_t state[16], uint64_t *out) {
+	ChaChaBlocks(state, out);
+}
+
+#ifdef PRNG_X86
+__attribute__((target("avx2")))
+static void ChaChaBlocksAVX2(const uint32_t state[16], uint64_t *out) {
+	ChaChaBlocks(state, out);
+}
+#endif
+
+static bool SupportsAVX2() {
+#ifdef PRNG_X86
+	return __builtin_cpu_supports("avx2");
+#else
+	return false;
+#endif
+}
+
+static std::atomic<bool>& UseAVX2() {
+	static std::atomic<bool> useAVX2(SupportsAVX2());
+	return useAVX2;
+}
+
+/**
+ * Masks the words of buf and moves the ones below the modulus to the front,
+ * keeping their order.
+ *
+ * @return the number of words kept.
+ */
+static size_t CompactBelowPortable(uint64_t *buf, size_t count, uint64_t mask, uint64_t modulus) {
+	size_t kept = 0;
+	for (size_t i = 0; i < count; i++) {
+		uint64_t w = buf[i] & mask;
+		// kept <= i, so this never overwrites a word not read yet
+		buf[kept] = w;
+		kept += (w < modulus);
+	}
+	return kept;
+}
+
+#ifdef PRNG_X86
+/**
+ * Permutations of the 32-bit lanes of a 256-bit register that move the 64-bit
+ * lanes selected by a 4-bit mask to the front.
+ */
+struct CompactPermutations {
+	uint32_t index[16][8];
+
+	CompactPermutations() {
+		for (uint32_t bits = 0; bits < 16; bits++) {
+			uint32_t k = 0;
+			for (uint32_t lane = 0; lane < 4; lane++) {
+				if (bits & (1 << lane)) {
+					index[bits][2*k] = 2*lane;
+					index[bits][2*k+1] = 2*lane+1;
+					k++;
+				}
+			}
+			for (; k < 4; k++) {
+				index[bits][2*k] = 0;
+				index[bits][2*k+1] = 1;
+			}
+		}
+	}
+};
+
+static const CompactPermutations compactPermutations;
+
+/**
+ * AVX2 version of CompactBelowPortable: four words are masked and compared at a
+ * time, and the accepted ones are packed with a single permutation.
+ */
+__attribute__((target("avx2")))
+static size_t CompactBelowAVX2(uint64_t *buf, size_t count, uint64_t mask, uint64_t modulus) {
+	const uint64_t sign = (uint64_t)1 << 63;
+	const __m256i vmask = _mm256_set1_epi64x(mask);
+	const __m256i vsign = _mm256_set1_epi64x(sign);
+	// AVX2 only has a signed comparison: w < q iff (w^sign) < (q^sign) as signed values
+	const __m256i vbound = _mm256_set1_epi64x(modulus ^ sign);
+
+	size_t kept = 0;
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m256i w = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(buf + i)), vmask);
+		__m256i below = _mm256_cmpgt_epi64(vbound, _mm256_xor_si256(w, vsign));
+		int bits = _mm256_movemask_pd(_mm256_castsi256_pd(below));
+		__m256i perm = _mm256_loadu_si256((const __m256i*)compactPermutations.index[bits]);
+		// kept <= i, so the four stored words end at or before buf[i+3]
+		_mm256_storeu_si256((__m256i*)(buf + kept), _mm256_permutevar8x32_epi32(w, perm));
+		kept += __builtin_popcount(bits);
+	}
+	for (; i < count; i++) {
+		uint64_t w = buf[i] & mask;
+		buf[kept] = w;
+		kept += (w < modulus);
+	}
+	return kept;
+}
+#endif
+
+void PRNGEngine::FillUniform(uint64_t *out, size_t count, uint64_t modulus) {
+	if (modulus == 0)
+		throw std::logic_error("FillUniform: the modulus must be nonzero");
+
+	// the smallest mask covering [0,modulus): words are accepted with probability above 1/2,
+	// and always for powers of two
+	uint64_t mask = (modulus == 1) ? 0 : (~(uint64_t)0 >> __builtin_clzll(modulus - 1));
+
+#ifdef PRNG_X86
+	bool avx2 = UseAVX2().load(std::memory_order_relaxed);
+#endif
+	size_t filled = 0;
+	while (filled < count) {
+		Fill(out + filled, count - filled);
+#ifdef PRNG_X86
+		if (avx2) {
+			filled += CompactBelowAVX2(out + filled, count - filled, mask, modulus);
+			continue;
+		}
+#endif
+		filled += CompactBelowPortable(out + filled, count - filled, mask, modulus);
+	}
+}
+
+bool ChaCha20Engine::SetAVX2(bool avx2) {
+	bool supported = SupportsAVX2();
+	UseAVX2().store(avx2 && supported);
+	return avx2 && supported;
+}
+
+bool ChaCha20Engine::GetAVX2() {
+	return UseAVX2().load();
+}
+
+ChaCha20Engine::ChaCha20Engine() {
+	std::random_device rd;
+	uint32_t key[8];
+	for (size_t i = 0; i < 8; i++)
+		key[i] = rd();
+	// in case random_device is deterministic on this platform, the time and the thread
+	// still make the keys of different engines different
+	uint64_t time = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+	uint64_t thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+	key[0] ^= (uint32_t)time;
+	key[1] ^= (uint32_t)(time >> 32);
+	key[2] ^= (uint32_t)thread;
+	key[3] ^= (uint32_t)(thread >> 32);
+	Initialize(key, 0, 0);
+}
+
+ChaCha20Engine::ChaCha20Engine(const uint32_t key[8], uint64_t counter, uint64_t nonce) {
+	Initialize(key, counter, nonce);
+}
+
+void ChaCha20Engine::Initialize(const uint32_t key[8], uint64_t counter, uint64_t nonce) {
+	// "expand 32-byte k"
+	m_state[0] = 0x61707865;
+	m_state[1] = 0x3320646e;
+	m_state[2] = 0x79622d32;
+	m_state[3] = 0x6b206574;
+	for (size_t i = 0; i < 8; i++)
+		m_state[4+i] = key[i];
+	m_state[12] = (uint32_t)counter;
+	m_state[13] = (uint32_t)(counter >> 32);
+	m_state[14] = (uint32_t)nonce;
+	m_state[15] = (uint32_t)(nonce >> 32);
+	m_position = BLOCK_WORDS*PARALLEL_BLOCKS;
+}
+
+void ChaCha20Engine::GenerateBlocks(uint64_t *out) {
+#ifdef PRNG_X86
+	if (UseAVX2().load(std::memory_order_relaxed)) {
+		ChaChaBlocksAVX2(m_state, out);
+	} else
+#endif
+		ChaChaBlocksPortable(m_state, out);
+
+	uint64_t counter = ((uint64_t)m_state[13] << 32 | m_state[12]) + PARALLEL_BLOCKS;
+	m_state[12] = (uint32_t)counter;
+	m_state[13] = (uint32_t)(counter >> 32);
+}
+
+void ChaCha20Engine::Fill(uint64_t *out, size_t count) {
+	const size_t groupWords = BLOCK_WORDS*PARALLEL_BLOCKS;
+
+	// first the keystream left over from the previous call
+	size_t available = groupWords - m_position;
+	size_t n = (count < available) ? count : available;
+	std::memcpy(out, m_keystream + m_position, n*sizeof(uint64_t));
+	m_position += n;
+	out += n;
+	count -= n;
+
+	// then whole groups of blocks, straight into the output
+	while (count >= groupWords) {
+		GenerateBlocks(out);
+		out += groupWords;
+		count -= groupWords;
+	}
+
+	if (count > 0) {
+		GenerateBlocks(m_keystream);
+		std::memcpy(out, m_keystream, count*sizeof(uint64_t));
+		m_position = count;
+	}
+}
+
+PRNGSeed ChaCha20Engine::DeriveSeed(const PRNGSeed &seed, uint64_t index) {
+	ChaCha20Engine engine(seed, index);
+	PRNGSeed derived;
+	for (size_t i = 0; i < derived.size(); i += 2) {
+		uint64_t word = engine.Next64();
+		derived[i] = (uint32_t)word;
+		derived[i+1] = (uint32_t)(word >> 32);
+	}
+	return derived;
+}
+
+MT19937Engine::MT19937Engine()
+	: m_engine(std::chrono::high_resolution_clock::now().time_since_epoch().count()+std::hash<std::thread::id>{}(std::this_thread::get_id())) {
+}
+
+void MT19937Engine::Fill(uint64_t *out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		uint64_t low = m_engine();
+		out[i] = low | ((uint64_t)m_engine() << 32);
+	}
+}
+
+} // namespace lbcrypto
@@ -0,0 +1,228 @@
+/**
+ * @file prng.h This code provides the pseudorandom number engines used by the distribution generators.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef LBCRYPTO_MATH_PRNG_H_
+#define LBCRYPTO_MATH_PRNG_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace lbcrypto {
+
+/**
+ * @brief Engines that can back PseudoRandomNumberGenerator.
+ */
+enum PRNGEngineType {
+	PRNG_CHACHA20,	//!< @brief ChaCha20 in counter mode (default)
+	PRNG_MT19937	//!< @brief std::mt19937, the engine used by earlier versions of the library
+};
+
+/**
+ * @brief A 256-bit seed from which a stream of random words can be expanded, as eight 32-bit words.
+ */
+typedef std::array<uint32_t, 8> PRNGSeed;
+
+/**
+ * @brief Interface of the pseudorandom number engines.
+ *
+ * An engine produces a stream of 64-bit words through Fill. It is also a uniform random bit
+ * generator of 32-bit words, so it can be passed to the distributions of <random>; these words
+ * are taken from the same stream, a block at a time.
+ */
+class PRNGEngine {
+public:
+	typedef uint32_t result_type;
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return 0xFFFFFFFF; }
+
+	virtual ~PRNGEngine() {}
+
+	/**
+	 * Returns the next 32-bit word of the stream.
+	 *
+	 * @return a uniformly random word.
+	 */
+	result_type operator()() {
+		if (m_next == BUFFER_WORDS)
+			Refill();
+		return m_buffer[m_next++];
+	}
+
+	/**
+	 * Returns the next 64-bit word of the stream.
+	 *
+	 * @return a uniformly random word.
+	 */
+	uint64_t Next64() {
+		uint64_t low = (*this)();
+		return low | ((uint64_t)(*this)() << 32);
+	}
+
+	/**
+	 * Fills a buffer with uniformly random 64-bit words, in bulk.
+	 *
+	 * @param out the buffer.
+	 * @param count the number of words to generate.
+	 */
+	virtual void Fill(uint64_t *out, size_t count) = 0;
+
+	/**
+	 * Fills a buffer with words uniformly distributed in [0,modulus), in bulk.
+	 * Words are drawn with Fill, masked to the bit length of the modulus, and the
+	 * accepted ones are compacted to the front of the buffer (with AVX2 when the CPU
+	 * supports it); the rejected positions are refilled the same way.
+	 *
+	 * @param out the buffer.
+	 * @param count the number of words to generate.
+	 * @param modulus the modulus, nonzero.
+	 */
+	void FillUniform(uint64_t *out, size_t count, uint64_t modulus);
+
+	/**
+	 * @return the type of the engine.
+	 */
+	virtual PRNGEngineType GetType() const = 0;
+
+protected:
+	PRNGEngine() : m_next(BUFFER_WORDS) {}
+
+private:
+	static const size_t BUFFER_WORDS = 128;
+
+	void Refill() {
+		Fill(reinterpret_cast<uint64_t*>(m_buffer), BUFFER_WORDS/2);
+		m_next = 0;
+	}
+
+	uint32_t m_buffer[BUFFER_WORDS];
+	size_t m_next;
+};
+
+/**
+ * @brief ChaCha20 (20 rounds, 64-bit block counter and 64-bit nonce) used as a stream of random words.
+ *
+ * Eight blocks are computed at a time with vector operations, using AVX2 when the CPU supports it.
+ * The stream is independent of how it is split between calls to Fill.
+ */
+class ChaCha20Engine : public PRNGEngine {
+public:
+	/**
+	 * Creates an engine with a fresh random key.
+	 */
+	ChaCha20Engine();
+
+	/**
+	 * Creates an engine with a given key.
+	 *
+	 * @param key the 256-bit key, as eight 32-bit little-endian words.
+	 * @param counter the number of the first block.
+	 * @param nonce the nonce.
+	 */
+	ChaCha20Engine(const uint32_t key[8], uint64_t counter = 0, uint64_t nonce = 0);
+
+	/**
+	 * Creates an engine expanding a seed.
+	 *
+	 * @param seed the seed, used as the key.
+	 * @param nonce the nonce, to expand several independent streams from the same seed.
+	 */
+	explicit ChaCha20Engine(const PRNGSeed &seed, uint64_t nonce = 0) {
+		Initialize(seed.data(), 0, nonce);
+	}
+
+	/**
+	 * Derives an independent seed from a seed and an index: the first 256 bits of the
+	 * stream expanded from seed with the index as nonce.
+	 *
+	 * @param seed the seed.
+	 * @param index the index of the derived seed.
+	 * @return the derived seed.
+	 */
+	static PRNGSeed DeriveSeed(const PRNGSeed &seed, uint64_t index);
+
+	void Fill(uint64_t *out, size_t count);
+
+	PRNGEngineType GetType() const { return PRNG_CHACHA20; }
+
+	/**
+	 * Selects the vectorized (AVX2) or the portable implementation of the block function
+	 * and of the compaction in FillUniform.
+	 * Requests for AVX2 on CPUs without it are ignored. This is mostly useful for testing.
+	 *
+	 * @param avx2 true to use AVX2.
+	 * @return whether AVX2 is used.
+	 */
+	static bool SetAVX2(bool avx2);
+
+	/**
+	 * @return whether the AVX2 implementation is used.
+	 */
+	static bool GetAVX2();
+
+	static const size_t BLOCK_WORDS = 8;		//!< @brief 64-bit words per ChaCha20 block
+	static const size_t PARALLEL_BLOCKS = 8;	//!< @brief blocks computed at a time
+
+private:
+	void Initialize(const uint32_t key[8], uint64_t counter, uint64_t nonce);
+	void GenerateBlocks(uint64_t *out);
+
+	uint32_t m_state[16];
+	// keystream generated but not consumed yet
+	uint64_t m_keystream[BLOCK_WORDS*PARALLEL_BLOCKS];
+	size_t m_position;
+};
+
+/**
+ * @brief Adapter exposing std::mt19937 as a PRNGEngine.
+ */
+class MT19937Engine : public PRNGEngine {
+public:
+	/**
+	 * Creates an engine with a fresh seed.
+	 */
+	MT19937Engine();
+
+	/**
+	 * Creates an engine with a given seed.
+	 *
+	 * @param seed the seed.
+	 */
+	explicit MT19937Engine(uint32_t seed) : m_engine(seed) {}
+
+	void Fill(uint64_t *out, size_t count);
+
+	PRNGEngineType GetType() const { return PRNG_MT19937; }
+
+private:
+	std::mt19937 m_engine;
+};
+
+} // namespace lbcrypto
+
+#endif // LBCRYPTO_MATH_PRNG_H_
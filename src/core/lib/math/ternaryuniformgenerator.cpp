@@ -26,23 +26,23 @@
  
 #include "ternaryuniformgenerator.h"
 #include <random>
+#include <vector>
 
 namespace lbcrypto {
 
-template<typename VecType>
-std::uniform_int_distribution<int> TernaryUniformGeneratorImpl<VecType>::m_distribution = std::uniform_int_distribution<int>(-1,1);
-
 template<typename VecType>
 VecType TernaryUniformGeneratorImpl<VecType>::GenerateVector (usint size, const typename VecType::Integer &modulus) const {
 	
+	std::shared_ptr<int32_t> values = GenerateIntVector(size);
+
 	VecType v(size);
 	v.SetModulus(modulus);
-	int32_t randomNumber;
+	typename VecType::Integer minusOne = modulus - typename VecType::Integer(1);
 
 	for (usint i = 0; i < size; i++) {
-		randomNumber = m_distribution(PseudoRandomNumberGenerator::GetPRNG());
+		int32_t randomNumber = (values.get())[i];
 		if (randomNumber < 0)
-			v[i] = modulus - typename VecType::Integer(1);
+			v[i] = minusOne;
 		else
 			v[i] = typename VecType::Integer(randomNumber);
 	}
@@ -54,10 +54,34 @@ template<typename VecType>
 std::shared_ptr<int32_t> TernaryUniformGeneratorImpl<VecType>::GenerateIntVector (usint size) const {
 	
 	std::shared_ptr<int32_t> ans( new int32_t[size], std::default_delete<int32_t[]>() );
+	int32_t *out = ans.get();
 
-	for (usint i = 0; i < size; i++) {
-		(ans.get())[i] = m_distribution(PseudoRandomNumberGenerator::GetPRNG());		
-
+	// every pair of bits gives 0 (00), 1 (01) or -1 (10); the pair 11 is rejected,
+	// so a word gives 24 coefficients on average
+	PRNGEngine &prng = PseudoRandomNumberGenerator::GetPRNG();
+	std::vector<uint64_t> words;
+	usint filled = 0;
+	while (filled < size) {
+		words.resize((size - filled) / 24 + 1);
+		prng.Fill(words.data(), words.size());
+		for (size_t w = 0; w < words.size() && filled < size; w++) {
+			uint64_t word = words[w];
+			if (size - filled >= 32) {
+				// room for all 32 pairs: the accepted ones are appended without branches
+				for (usint j = 0; j < 32; j++, word >>= 2) {
+					uint32_t pair = word & 3;
+					out[filled] = (int32_t)(pair & 1) - (int32_t)(pair >> 1);
+					filled += (pair != 3);
+				}
+			}
+			else {
+				for (usint j = 0; j < 32 && filled < size; j++, word >>= 2) {
+					uint32_t pair = word & 3;
+					if (pair != 3)
+						out[filled++] = (int32_t)(pair & 1) - (int32_t)(pair >> 1);
+				}
+			}
+		}
 	}
 
 	return ans;
@@ -39,6 +39,9 @@ typedef TernaryUniformGeneratorImpl<BigVector> TernaryUniformGenerator;
 
 /**
 * @brief A generator of the Ternary Uniform Distribution.
+*
+* The coefficients are cut from random words two bits at a time (up to 32 per word), rejecting
+* one of the four bit patterns; the words of a vector are drawn from the PRNG in one block.
 */
 template<typename VecType>
 class TernaryUniformGeneratorImpl : public DistributionGenerator<VecType> {
@@ -66,9 +69,6 @@ public:
 	* @return     A pointer to an array of integer values generated with the distribution.
 	*/
 	std::shared_ptr<int32_t> GenerateIntVector (usint size) const;
-
-private:
-	static std::uniform_int_distribution<int> m_distribution;
 };
 
 } // namespace lbcrypto
@@ -25,21 +25,16 @@
  */
 
 #include "transfrm.h"
+#include "native_int/nttkernels.h"
 
 namespace lbcrypto {
 
 
 template<typename VecType>
-std::map<typename VecType::Integer, VecType> ChineseRemainderTransformFTT<VecType>::m_rootOfUnityTableByModulus;
+std::shared_ptr<const typename ChineseRemainderTransformFTT<VecType>::NTTTablesMap> ChineseRemainderTransformFTT<VecType>::m_nttTables;
 
 template<typename VecType>
-std::map<typename VecType::Integer, VecType> ChineseRemainderTransformFTT<VecType>::m_rootOfUnityInverseTableByModulus;
-
-template<typename VecType>
-std::map<typename VecType::Integer,NativeVector> ChineseRemainderTransformFTT<VecType>::m_rootOfUnityPreconTableByModulus;
-
-template<typename VecType>
-std::map<typename VecType::Integer,NativeVector> ChineseRemainderTransformFTT<VecType>::m_rootOfUnityInversePreconTableByModulus;
+std::mutex ChineseRemainderTransformFTT<VecType>::m_nttTablesMutex;
 
 template<typename VecType>
 std::map<typename VecType::Integer, VecType> ChineseRemainderTransformArb<VecType>::m_cyclotomicPolyMap;
@@ -115,8 +110,177 @@ void NumberTheoreticTransform<VecType>::InverseTransformIterative(const VecType&
 	return;
 }
 
+//Number Theoretic Transform - ITERATIVE IMPLEMENTATION - butterflies run by the native NTT kernels
+template<typename VecType>
+void NumberTheoreticTransform<VecType>::ForwardTransformIterativeSIMD(const VecType& element, const NativeVector &stageTable,
+		const NativeVector &preconStageTable, const usint cycloOrder, VecType* result) {
+
+	if (typeid(IntType) == typeid(NativeInteger))
+	{
+		usint n = cycloOrder;
+
+		if( result->GetLength() != n )
+			throw std::logic_error("Vector for NumberTheoreticTransform::ForwardTransformIterativeSIMD size needs to be == cyclotomic order");
+		if( stageTable.GetLength() < n )
+			throw std::logic_error("Stage table for NumberTheoreticTransform::ForwardTransformIterativeSIMD is too short");
+
+		IntType modulus = element.GetModulus();
+		result->SetModulus(modulus);
+
+		//reverse coefficients (bit reversal)
+		BitReverse(element, result);
+
+		native_int::NTTKernels::Butterflies(NativeVectorData(*result), n, NativeVectorData(stageTable),
+				NativeVectorData(preconStageTable), modulus.ConvertToInt());
+	}
+	else
+		PALISADE_THROW(math_error, "This NTT method only works with NativeInteger");
+
+	return;
+}
+
+//Number Theoretic Transform - ITERATIVE IMPLEMENTATION - butterflies run by the native NTT kernels
+template<typename VecType>
+void NumberTheoreticTransform<VecType>::InverseTransformIterativeSIMD(const VecType& element, const NativeVector &stageTable,
+		const NativeVector &preconStageTable, const usint cycloOrder, VecType *ans) {
+
+	NumberTheoreticTransform<VecType>::ForwardTransformIterativeSIMD(element, stageTable, preconStageTable, cycloOrder, ans);
+
+	*ans *= (IntType(cycloOrder).ModInverse(element.GetModulus()));
+	return;
+}
+
+template<typename VecType>
+NTTTables<VecType>::NTTTables(const IntType& rootOfUnity, const usint CycloOrder, const IntType &modulus)
+	: m_modulus(modulus), m_rootOfUnity(rootOfUnity), m_cycloOrder(CycloOrder) {
+
+	if (IsIdentity())
+		return;
+
+	usint n = CycloOrder / 2;
+
+	//a root of unity of a larger power-of-two order is brought down to order CycloOrder by
+	//squaring it (halving lemma); this is how Decompose reuses the root of the parent ring
+	IntType root(rootOfUnity);
+	IntType minusOne = modulus - IntType(1);
+	for (usint i = 0; i < 64; i++) {
+		IntType power = root.ModExp(IntType(n), modulus);
+		if (power == minusOne || power == IntType(1))
+			break;
+		root = root.ModMul(root, modulus);
+	}
+
+	IntType rootOfUnityInverse;
+	try {
+		rootOfUnityInverse = root.ModInverse(modulus);
+	}
+	catch (std::exception& e) {
+		throw std::logic_error(std::string(e.what()) + ": rootOfUnity " + rootOfUnity.ToString() + " has no inverse");
+	}
+
+	//Precompute the Barrett mu parameter
+	IntType mu = ComputeMu<IntType>(modulus);
+
+	m_rootOfUnityTable = VecType(n, modulus);
+	m_rootOfUnityInverseTable = VecType(n, modulus);
+
+	IntType x(1);
+	IntType xInverse(1);
+	for (usint i = 0; i < n; i++) {
+		m_rootOfUnityTable[i] = x;
+		m_rootOfUnityInverseTable[i] = xInverse;
+		x.ModBarrettMulInPlace(root, modulus, mu);
+		xInverse.ModBarrettMulInPlace(rootOfUnityInverse, modulus, mu);
+	}
+
+	if (typeid(IntType) == typeid(NativeInteger)) {
+		NativeInteger nativeModulus = modulus.ConvertToInt();
+		m_rootOfUnityPreconTable = NativeVector(n, nativeModulus);
+		m_rootOfUnityInversePreconTable = NativeVector(n, nativeModulus);
+		if (modulus.GetMSB() < NTL_SP_NBITS + 1) {
+			for (usint i = 0; i < n; i++) {
+				m_rootOfUnityPreconTable[i] = NativeInteger(m_rootOfUnityTable[i].ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
+				m_rootOfUnityInversePreconTable[i] = NativeInteger(m_rootOfUnityInverseTable[i].ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
+			}
+		}
+
+		if (modulus.GetMSB() <= native_int::NTT_KERNEL_MAX_MODULUS_BITS) {
+			ComputeStageTable(modulus, m_rootOfUnityTable, &m_stageTable, &m_preconStageTable);
+			ComputeStageTable(modulus, m_rootOfUnityInverseTable, &m_inverseStageTable, &m_inversePreconStageTable);
+
+			uint64_t q = nativeModulus.ConvertToInt();
+			NativeInteger nInverse = NativeInteger(n).ModInverse(nativeModulus);
+			m_twistTable = NativeVector(n, nativeModulus);
+			m_preconTwistTable = NativeVector(n, nativeModulus);
+			m_inverseScaleTable = NativeVector(n, nativeModulus);
+			m_preconInverseScaleTable = NativeVector(n, nativeModulus);
+			for (usint i = 0; i < n; i++) {
+				NativeInteger psi = m_rootOfUnityTable[i].ConvertToInt();
+				NativeInteger scale = nInverse.ModMulFast(NativeInteger(m_rootOfUnityInverseTable[i].ConvertToInt()), nativeModulus);
+				m_twistTable[i] = psi;
+				m_preconTwistTable[i] = native_int::NTTKernels::ShoupPrecon(psi.ConvertToInt(), q);
+				m_inverseScaleTable[i] = scale;
+				m_preconInverseScaleTable[i] = native_int::NTTKernels::ShoupPrecon(scale.ConvertToInt(), q);
+			}
+		}
+	}
+}
+
+template<typename VecType>
+void NTTTables<VecType>::ComputeStageTable(const IntType &modulus, const VecType &rootOfUnityTable,
+		NativeVector *stageTable, NativeVector *preconStageTable) {
+
+	uint64_t nativeModulus = modulus.ConvertToInt();
+	usint n = rootOfUnityTable.GetLength();
+
+	// the factors of the stage with butterfly half-size h are stored at [h, 2h)
+	*stageTable = NativeVector(n, NativeInteger(nativeModulus));
+	*preconStageTable = NativeVector(n, NativeInteger(nativeModulus));
+	for (usint h = 1; h < n; h <<= 1) {
+		for (usint i = 0; i < h; i++) {
+			uint64_t omega = rootOfUnityTable[i * (n / h)].ConvertToInt();
+			(*stageTable)[h + i] = omega;
+			(*preconStageTable)[h + i] = native_int::NTTKernels::ShoupPrecon(omega, nativeModulus);
+		}
+	}
+}
+
+template<typename VecType>
+std::shared_ptr<const NTTTables<VecType>> ChineseRemainderTransformFTT<VecType>::GetNTTTables(const IntType& rootOfUnity,
+		const usint CycloOrder, const IntType &modulus) {
+
+	NTTTablesKey key = { modulus, rootOfUnity, CycloOrder };
+
+	// lookup without the mutex in the current version of the registry
+	std::shared_ptr<const NTTTablesMap> tablesMap = std::atomic_load(&m_nttTables);
+	if (tablesMap != NULL) {
+		auto mapSearch = tablesMap->find(key);
+		if (mapSearch != tablesMap->end())
+			return mapSearch->second;
+	}
+
+	std::lock_guard<std::mutex> lock(m_nttTablesMutex);
+
+	// another thread may have added the tables in the meantime
+	tablesMap = std::atomic_load(&m_nttTables);
+	if (tablesMap != NULL) {
+		auto mapSearch = tablesMap->find(key);
+		if (mapSearch != tablesMap->end())
+			return mapSearch->second;
+	}
+
+	std::shared_ptr<const NTTTables<VecType>> tables(new NTTTables<VecType>(rootOfUnity, CycloOrder, modulus));
+
+	// publish a new version of the registry; the previous version is freed once no reader uses it
+	std::shared_ptr<NTTTablesMap> newMap = tablesMap != NULL ?
+			std::make_shared<NTTTablesMap>(*tablesMap) : std::make_shared<NTTTablesMap>();
+	(*newMap)[key] = tables;
+	std::atomic_store(&m_nttTables, std::shared_ptr<const NTTTablesMap>(std::move(newMap)));
+
+	return tables;
+}
+
 //main Forward CRT Transform - implements FTT - uses iterative NTT as a subroutine
-//includes precomputation of twidle factor table
 template<typename VecType>
 void ChineseRemainderTransformFTT<VecType>::ForwardTransform(const VecType& element, const IntType& rootOfUnity,
 		const usint CycloOrder, VecType *OpFFT) {
@@ -127,7 +291,8 @@ void ChineseRemainderTransformFTT<VecType>::ForwardTransform(const VecType& elem
 	if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0)) {
 		// No transform, just copy in to out
 
-		*OpFFT = element;
+		if (OpFFT != &element)
+			*OpFFT = element;
 		return;
 
 		//throw std::logic_error("Root of unity for ChineseRemainderTransformFTT::ForwardTransform cannot be zero or one");
@@ -136,90 +301,88 @@ void ChineseRemainderTransformFTT<VecType>::ForwardTransform(const VecType& elem
 	if (!IsPowerOfTwo(CycloOrder))
 		throw std::logic_error("CyclotomicOrder for ChineseRemainderTransformFTT::ForwardTransform is not a power of two");
 
-	//Precompute the Barrett mu parameter
-	IntType mu = ComputeMu<IntType>(element.GetModulus());
+	ForwardTransform(element, *GetNTTTables(rootOfUnity, CycloOrder, element.GetModulus()), OpFFT);
+}
 
-	const VecType *rootOfUnityTable = NULL;
+//Forward CRT Transform with the twiddle factor tables already looked up
+template<typename VecType>
+void ChineseRemainderTransformFTT<VecType>::ForwardTransform(const VecType& element, const NTTTables<VecType> &tables, VecType *OpFFT) {
 
-	// check to see if the modulus is in the table, and add it if it isn't
-	const auto mapSearch = m_rootOfUnityTableByModulus.find(element.GetModulus());
-	if( mapSearch == m_rootOfUnityTableByModulus.end() || mapSearch->second[1] != rootOfUnity ) {
-#pragma omp critical
-		{
-			IntType modulus(element.GetModulus());
-			VecType rTable(CycloOrder / 2,modulus);
-			IntType x(1);
+	if (tables.IsIdentity()) {
+		if (OpFFT != &element)
+			*OpFFT = element;
+		return;
+	}
 
-			for (usint i = 0; i<CycloOrder / 2; i++) {
- 			    rTable[i]= x;
-			    x.ModBarrettMulInPlace(rootOfUnity, modulus, mu);
-			}
-			rootOfUnityTable = &(m_rootOfUnityTableByModulus[modulus] = std::move(rTable));
-
-			if (typeid(IntType) == typeid(NativeInteger)) {
-				NativeInteger nativeModulus = modulus.ConvertToInt();
-				NativeVector preconTable(CycloOrder/2,nativeModulus);
-				if(nativeModulus.GetMSB() < NTL_SP_NBITS + 1)
-				{
-					for (usint i = 0; i<CycloOrder / 2; i++) {
-						preconTable[i] = NativeInteger(rootOfUnityTable->operator[](i).ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
-					}
-				}
-				else{
-					for (usint i = 0; i<CycloOrder / 2; i++) {
-						preconTable[i] = 0;
-					}
-				}
-				m_rootOfUnityPreconTableByModulus[modulus] = std::move(preconTable);
-			}
-		}
+	// the tables must belong to the modulus of the element
+	if (element.GetModulus() != tables.GetModulus()) {
+		ForwardTransform(element, tables.GetRootOfUnity(), tables.GetCyclotomicOrder(), OpFFT);
+		return;
 	}
-	else {
-		rootOfUnityTable = &mapSearch->second;
+
+	const usint CycloOrder = tables.GetCyclotomicOrder();
+
+	if( OpFFT->GetLength() != CycloOrder/2 )
+		throw std::logic_error("Vector for ChineseRemainderTransformFTT::ForwardTransform size must be == CyclotomicOrder/2");
+
+	//native moduli: the twist by psi^i is fused into the transform, which runs in place if OpFFT == &element
+	if (tables.HasStageTables()) {
+		OpFFT->SetModulus(element.GetModulus());
+		native_int::NTTKernels::ForwardNegacyclic(NativeVectorData(*OpFFT), NativeVectorData(element), CycloOrder / 2,
+				NativeVectorData(tables.GetTwistTable()), NativeVectorData(tables.GetPreconTwistTable()),
+				NativeVectorData(tables.GetStageTable()), NativeVectorData(tables.GetPreconStageTable()),
+				element.GetModulus().ConvertToInt());
+		return;
 	}
 
-	VecType InputToFFT(element.GetLength(),element.GetModulus());
+	const VecType &rootOfUnityTable = tables.GetRootOfUnityTable();
 
-	usint ringDimensionFactor = rootOfUnityTable->GetLength() / (CycloOrder / 2);
+	//the input is twisted by psi^i in OpFFT itself, which then goes through an in-place transform
+	if (OpFFT != &element)
+		*OpFFT = element;
 
 	//Fermat Theoretic Transform (FTT)
 	if (typeid(IntType) == typeid(NativeInteger)) {
-		const NativeVector &preconTable = m_rootOfUnityPreconTableByModulus[element.GetModulus()];
+		const NativeVector &preconTable = tables.GetRootOfUnityPreconTable();
 		NativeInteger modulus = element.GetModulus().ConvertToInt();
 		if(element.GetModulus().GetMSB() < NTL_SP_NBITS + 1){
-			if (ringDimensionFactor == 1)
-					for (usint i = 0; i<CycloOrder / 2; i++)
-							InputToFFT[i]=element[i].ModMulPreconOptimized((*rootOfUnityTable)[i],modulus,preconTable[i]);
-					else
-						for (usint i = 0; i<CycloOrder / 2; i++)
-							InputToFFT[i]=element[i].ModMulPreconOptimized((*rootOfUnityTable)[i*ringDimensionFactor],modulus,preconTable[i*ringDimensionFactor]);
+			for (usint i = 0; i<CycloOrder / 2; i++)
+				(*OpFFT)[i].ModMulPreconOptimizedEq(rootOfUnityTable[i],modulus,preconTable[i]);
 		}
 		else{
-			if (ringDimensionFactor == 1)
-								for (usint i = 0; i<CycloOrder / 2; i++)
-										InputToFFT[i]=element[i].ModMulFast((*rootOfUnityTable)[i],modulus);
-								else
-									for (usint i = 0; i<CycloOrder / 2; i++)
-										InputToFFT[i]=element[i].ModMulFast((*rootOfUnityTable)[i*ringDimensionFactor],modulus);
-
+			for (usint i = 0; i<CycloOrder / 2; i++)
+				(*OpFFT)[i].ModMulEq(rootOfUnityTable[i],modulus);
 		}
 
 	} else {
+		//Precompute the Barrett mu parameter
+		IntType mu = ComputeMu<IntType>(element.GetModulus());
+
 		for (usint i = 0; i<CycloOrder / 2; i++)
-			InputToFFT[i]= element[i].ModBarrettMul((*rootOfUnityTable)[i*ringDimensionFactor], element.GetModulus(), mu);
+			(*OpFFT)[i].ModBarrettMulInPlace(rootOfUnityTable[i], element.GetModulus(), mu);
 	}
 
 	if (typeid(IntType) == typeid(NativeInteger))
-		NumberTheoreticTransform<VecType>::ForwardTransformIterative(InputToFFT, *rootOfUnityTable,
-				m_rootOfUnityPreconTableByModulus[element.GetModulus()], CycloOrder / 2, OpFFT);
+		NumberTheoreticTransform<VecType>::ForwardTransformIterative(*OpFFT, rootOfUnityTable,
+				tables.GetRootOfUnityPreconTable(), CycloOrder / 2, OpFFT);
 	else
-		NumberTheoreticTransform<VecType>::ForwardTransformIterative(InputToFFT, *rootOfUnityTable, CycloOrder / 2, OpFFT);
+		NumberTheoreticTransform<VecType>::ForwardTransformIterative(*OpFFT, rootOfUnityTable, CycloOrder / 2, OpFFT);
 
 	return;
 }
 
+//In-place forward CRT Transform
+template<typename VecType>
+void ChineseRemainderTransformFTT<VecType>::ForwardTransformInPlace(VecType *element, const IntType& rootOfUnity, const usint CycloOrder) {
+	ForwardTransform(*element, rootOfUnity, CycloOrder, element);
+}
+
+template<typename VecType>
+void ChineseRemainderTransformFTT<VecType>::ForwardTransformInPlace(VecType *element, const NTTTables<VecType> &tables) {
+	ForwardTransform(*element, tables, element);
+}
+
 //main Inverse CRT Transform - implements FTT - uses iterative NTT as a subroutine
-//includes precomputation of inverse twidle factor table
 template<typename VecType>
 void ChineseRemainderTransformFTT<VecType>::InverseTransform(const VecType& element, const IntType& rootOfUnity, const usint CycloOrder, VecType *OpIFFT) {
 
@@ -229,7 +392,8 @@ void ChineseRemainderTransformFTT<VecType>::InverseTransform(const VecType& elem
 	if (rootOfUnity == IntType(1) || rootOfUnity == IntType(0)) {
 		// just copy, no transform
 
-		*OpIFFT = element;
+		if (OpIFFT != &element)
+			*OpIFFT = element;
 		return;
 
 		//throw std::logic_error("Root of unity for ChineseRemainderTransformFTT::InverseTransform cannot be zero or one");
@@ -238,181 +402,86 @@ void ChineseRemainderTransformFTT<VecType>::InverseTransform(const VecType& elem
 	if (!IsPowerOfTwo(CycloOrder))
 		throw std::logic_error("CyclotomicOrder for ChineseRemainderTransformFTT::InverseTransform is not a power of two");
 
+	InverseTransform(element, *GetNTTTables(rootOfUnity, CycloOrder, element.GetModulus()), OpIFFT);
+}
 
-	//Precompute the Barrett mu parameter
-	IntType mu = ComputeMu<IntType>(element.GetModulus());
-
-	const VecType *rootOfUnityITable = NULL;
-
-	IntType rootofUnityInverse;
-
-	auto mSearch = m_rootOfUnityInverseTableByModulus.find(element.GetModulus());
+//Inverse CRT Transform with the twiddle factor tables already looked up
+template<typename VecType>
+void ChineseRemainderTransformFTT<VecType>::InverseTransform(const VecType& element, const NTTTables<VecType> &tables, VecType *OpIFFT) {
 
-	try {
-		rootofUnityInverse = rootOfUnity.ModInverse(element.GetModulus());
-	}
-	catch (std::exception& e) {
-		throw std::logic_error(std::string(e.what()) + ": rootOfUnity " + rootOfUnity.ToString() + " has no inverse");
+	if (tables.IsIdentity()) {
+		if (OpIFFT != &element)
+			*OpIFFT = element;
+		return;
 	}
 
-	// check to see if the modulus is in the table
-	if( mSearch == m_rootOfUnityInverseTableByModulus.end() || mSearch->second.GetLength() == 0 || mSearch->second[1] != rootofUnityInverse ) {
-#pragma omp critical
-			{
-
-				VecType TableI(CycloOrder / 2);
-
-				IntType x(1);
-
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-					TableI[i]= x;
-					x.ModBarrettMulInPlace(rootofUnityInverse, element.GetModulus(), mu);
-				}
-
-				rootOfUnityITable = &(m_rootOfUnityInverseTableByModulus[element.GetModulus()] = std::move(TableI));
-
-				if (typeid(IntType) == typeid(NativeInteger)) {
-					NativeInteger nativeModulus = element.GetModulus().ConvertToInt();
-					NativeVector preconTableI(CycloOrder / 2, nativeModulus);
-					if(element.GetModulus().GetMSB() < NTL_SP_NBITS+1){
-						for (usint i = 0; i<CycloOrder / 2; i++) {
-											preconTableI[i] = NativeInteger(rootOfUnityITable->operator[](i).ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
-										}
-					}
-					else{
+	// the tables must belong to the modulus of the element
+	if (element.GetModulus() != tables.GetModulus()) {
+		InverseTransform(element, tables.GetRootOfUnity(), tables.GetCyclotomicOrder(), OpIFFT);
+		return;
+	}
 
-						for (usint i = 0; i<CycloOrder / 2; i++) {
-											preconTableI[i] = 0;
-										}
+	const usint CycloOrder = tables.GetCyclotomicOrder();
 
-					}
-
-					m_rootOfUnityInversePreconTableByModulus[element.GetModulus()] = std::move(preconTableI);
-				}
-			}
-		}
+	if( OpIFFT->GetLength() != CycloOrder/2 )
+		throw std::logic_error("Vector for ChineseRemainderTransformFTT::InverseTransform size must be == CyclotomicOrder/2");
 
-	else {
-		rootOfUnityITable = &mSearch->second;
+	//native moduli: the scaling by n^{-1}*psi^{-i} is fused into the last butterfly stage, and the
+	//transform runs in place if OpIFFT == &element
+	if (tables.HasStageTables()) {
+		OpIFFT->SetModulus(element.GetModulus());
+		native_int::NTTKernels::InverseNegacyclic(NativeVectorData(*OpIFFT), NativeVectorData(element), CycloOrder / 2,
+				NativeVectorData(tables.GetInverseStageTable()), NativeVectorData(tables.GetInversePreconStageTable()),
+				NativeVectorData(tables.GetInverseScaleTable()), NativeVectorData(tables.GetPreconInverseScaleTable()),
+				element.GetModulus().ConvertToInt());
+		return;
 	}
 
+	const VecType &rootOfUnityITable = tables.GetRootOfUnityInverseTable();
+
 	if (typeid(IntType) == typeid(NativeInteger))
-		NumberTheoreticTransform<VecType>::InverseTransformIterative(element, *rootOfUnityITable,
-				m_rootOfUnityInversePreconTableByModulus[element.GetModulus()], CycloOrder / 2, OpIFFT);
+		NumberTheoreticTransform<VecType>::InverseTransformIterative(element, rootOfUnityITable,
+				tables.GetRootOfUnityInversePreconTable(), CycloOrder / 2, OpIFFT);
 	else
-		NumberTheoreticTransform<VecType>::InverseTransformIterative(element, *rootOfUnityITable, CycloOrder / 2, OpIFFT);
-
-	usint ringDimensionFactor = rootOfUnityITable->GetLength() / (CycloOrder / 2);
+		NumberTheoreticTransform<VecType>::InverseTransformIterative(element, rootOfUnityITable, CycloOrder / 2, OpIFFT);
 
 	if (typeid(IntType) == typeid(NativeInteger)) {
-		const NativeVector &preconTable = m_rootOfUnityInversePreconTableByModulus[element.GetModulus()];
+		const NativeVector &preconTable = tables.GetRootOfUnityInversePreconTable();
 		NativeInteger nativeModulus = element.GetModulus().ConvertToInt();
 		if(element.GetModulus().GetMSB() < NTL_SP_NBITS + 1){
-			if (ringDimensionFactor == 1)
-						for (usint i = 0; i<CycloOrder / 2; i++)
-							(*OpIFFT)[i].ModMulPreconOptimizedEq((*rootOfUnityITable)[i],nativeModulus,preconTable[i]);
-					else
-						for (usint i = 0; i<CycloOrder / 2; i++)
-							(*OpIFFT)[i].ModMulPreconOptimizedEq((*rootOfUnityITable)[i*ringDimensionFactor],nativeModulus,preconTable[i*ringDimensionFactor]);
+			for (usint i = 0; i<CycloOrder / 2; i++)
+				(*OpIFFT)[i].ModMulPreconOptimizedEq(rootOfUnityITable[i],nativeModulus,preconTable[i]);
 		}
 		else{
-			if (ringDimensionFactor == 1)
-						for (usint i = 0; i<CycloOrder / 2; i++)
-							(*OpIFFT)[i].ModMulEq((*rootOfUnityITable)[i],nativeModulus);
-					else
-						for (usint i = 0; i<CycloOrder / 2; i++)
-							(*OpIFFT)[i].ModMulEq((*rootOfUnityITable)[i*ringDimensionFactor],nativeModulus);
+			for (usint i = 0; i<CycloOrder / 2; i++)
+				(*OpIFFT)[i].ModMulEq(rootOfUnityITable[i],nativeModulus);
 		}
 
 	}
 	else {
+		//Precompute the Barrett mu parameter
+		IntType mu = ComputeMu<IntType>(element.GetModulus());
+
 		for (usint i = 0; i<CycloOrder / 2; i++)
-			(*OpIFFT)[i].ModBarrettMulInPlace((*rootOfUnityITable)[i*ringDimensionFactor], element.GetModulus(), mu);
+			(*OpIFFT)[i].ModBarrettMulInPlace(rootOfUnityITable[i], element.GetModulus(), mu);
 	}
 	return;
 }
 
+//In-place inverse CRT Transform
 template<typename VecType>
-void ChineseRemainderTransformFTT<VecType>::PreCompute(const IntType& rootOfUnity, const usint CycloOrder, const IntType &modulus) {
-
-	//Precompute the Barrett mu parameter
-	IntType mu = ComputeMu<IntType>(modulus);
-
-	IntType x(1);
-
-
-	VecType *rootOfUnityTableCheck = NULL;
-
-	rootOfUnityTableCheck = &m_rootOfUnityTableByModulus[modulus];
-	//Precomputes twiddle factor omega and FTT parameter phi for Forward Transform
-	if (rootOfUnityTableCheck->GetLength() == 0 ||
-		 m_rootOfUnityTableByModulus[modulus][0] != rootOfUnity ) {
-#pragma omp critical
-{
-		VecType Table(CycloOrder / 2, modulus);
-
-		for (usint i = 0; i<CycloOrder / 2; i++) {
-			Table[i]= x;
-			x.ModBarrettMulInPlace(rootOfUnity, modulus, mu);
-		}
-		m_rootOfUnityTableByModulus[modulus] = std::move(Table);
-
-		if (typeid(IntType) == typeid(NativeInteger)) {
-			NativeInteger nativeModulus = modulus.ConvertToInt();
-			NativeVector preconTable(CycloOrder/2,nativeModulus);
-			if(modulus.GetMSB()<NTL_SP_NBITS+1){
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-						preconTable[i] = NativeInteger(m_rootOfUnityTableByModulus[modulus].operator[](i).ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
-					}
-			}
-			else{
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-						preconTable[i] = 0;
-					}
-			}
-
-			m_rootOfUnityPreconTableByModulus[modulus] = std::move(preconTable);
-		}
+void ChineseRemainderTransformFTT<VecType>::InverseTransformInPlace(VecType *element, const IntType& rootOfUnity, const usint CycloOrder) {
+	InverseTransform(*element, rootOfUnity, CycloOrder, element);
 }
 
-	}
-
-	//Precomputes twiddle factor omega and FTT parameter phi for Inverse Transform
-	VecType  *rootOfUnityInverseTableCheck = &m_rootOfUnityInverseTableByModulus[modulus];
-	if (rootOfUnityInverseTableCheck->GetLength() == 0) {
-#pragma omp critical
-{
-		VecType TableI(CycloOrder / 2, modulus);
-		IntType rootOfUnityInverse = rootOfUnity.ModInverse(modulus);
-
-		x = 1;
-
-		for (usint i = 0; i<CycloOrder / 2; i++) {
-			TableI[i]= x;
-			x.ModBarrettMulInPlace(rootOfUnityInverse, modulus, mu);
-		}
-		m_rootOfUnityInverseTableByModulus[modulus] = std::move(TableI);
-
-		if (typeid(IntType) == typeid(NativeInteger)) {
-			NativeInteger nativeModulus = modulus.ConvertToInt();
-			NativeVector preconTableI(CycloOrder/2,nativeModulus);
-			if(modulus.GetMSB()<NTL_SP_NBITS+1){
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-								preconTableI[i] = NativeInteger(m_rootOfUnityInverseTableByModulus[modulus].operator[](i).ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
-						}
-			}
-			else{
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-								preconTableI[i] = 0;
-				}
-			}
-
-			m_rootOfUnityInversePreconTableByModulus[modulus] = std::move(preconTableI);
-		}
+template<typename VecType>
+void ChineseRemainderTransformFTT<VecType>::InverseTransformInPlace(VecType *element, const NTTTables<VecType> &tables) {
+	InverseTransform(*element, tables, element);
 }
 
-	}
-
+template<typename VecType>
+void ChineseRemainderTransformFTT<VecType>::PreCompute(const IntType& rootOfUnity, const usint CycloOrder, const IntType &modulus) {
+	GetNTTTables(rootOfUnity, CycloOrder, modulus);
 }
 
 template<typename VecType>
@@ -425,85 +494,14 @@ void ChineseRemainderTransformFTT<VecType>::PreCompute(std::vector<IntType> &roo
 		throw std::logic_error("size of root of unity and size of moduli chain not of same size");
 	}
 
-#pragma omp critical
-	for (usint i = 0; i<numOfRootU; ++i) {
-
-		IntType currentRoot(rootOfUnity[i]);
-		IntType currentMod(moduliiChain[i]);
-
-		//Precompute the Barrett mu parameter
-		IntType mu = ComputeMu<IntType>(currentMod);
-
-		if (m_rootOfUnityTableByModulus[moduliiChain[i]].GetLength() != 0 &&
-			m_rootOfUnityTableByModulus[moduliiChain[i]][0] == currentRoot)
-			continue;
-
-		IntType x(1);
-
-		//computation of root of unity table
-		VecType rTable(CycloOrder / 2, currentMod);
-
-		for (usint i = 0; i<CycloOrder / 2; i++) {
-		  rTable[i]= x;
-		  x.ModBarrettMulInPlace(currentRoot, currentMod, mu);
-		}
-		m_rootOfUnityTableByModulus[currentMod] = std::move(rTable);
-
-		if (typeid(x) == typeid(NativeInteger)) {
-			NativeInteger nativeModulus = currentMod.ConvertToInt();
-			NativeVector preconTable(CycloOrder/2,nativeModulus);
-			if(currentMod.GetMSB()<NTL_SP_NBITS+1){
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-						  preconTable[i] = NativeInteger(m_rootOfUnityTableByModulus[currentMod].operator[](i).ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
-						}
-			}
-			else{
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-						  preconTable[i] = 0;
-						}
-			}
-
-			m_rootOfUnityPreconTableByModulus[currentMod] = std::move(preconTable);
-		}
-
-		//computation of root of unity inverse table
-		x = 1;
-
-		IntType rootOfUnityInverse = currentRoot.ModInverse(currentMod);
-
-		VecType rTableI(CycloOrder / 2,currentMod);
-
-		for (usint i = 0; i<CycloOrder / 2; i++) {
-			rTableI[i]= x;
-			x.ModBarrettMulInPlace(rootOfUnityInverse, currentMod, mu);
-		}
-		m_rootOfUnityInverseTableByModulus[currentMod] = std::move(rTableI);
-
-		if (typeid(x) == typeid(NativeInteger)) {
-			NativeInteger nativeModulus = currentMod.ConvertToInt();
-			NativeVector preconTableI(CycloOrder/2,nativeModulus);
-			if(currentMod.GetMSB()<NTL_SP_NBITS+1){
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-								preconTableI[i] = NativeInteger(m_rootOfUnityInverseTableByModulus[currentMod].operator[](i).ConvertToInt()).PrepModMulPreconOptimized(nativeModulus);
-							}
-			}
-			else{
-				for (usint i = 0; i<CycloOrder / 2; i++) {
-								preconTableI[i] = 0;
-							}
-			}
-
-			m_rootOfUnityInversePreconTableByModulus[currentMod] = std::move(preconTableI);
-		}
-	}
+	for (usint i = 0; i<numOfRootU; ++i)
+		GetNTTTables(rootOfUnity[i], CycloOrder, moduliiChain[i]);
 }
 
 template<typename VecType>
 void ChineseRemainderTransformFTT<VecType>::Reset() {
-	m_rootOfUnityTableByModulus.clear();
-	m_rootOfUnityInverseTableByModulus.clear();
-	m_rootOfUnityPreconTableByModulus.clear();
-	m_rootOfUnityInversePreconTableByModulus.clear();
+	std::lock_guard<std::mutex> lock(m_nttTablesMutex);
+	std::atomic_store(&m_nttTables, std::shared_ptr<const NTTTablesMap>());
 }
 	
 	template<typename VecType>
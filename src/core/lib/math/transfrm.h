@@ -37,6 +37,9 @@
 #include <map>
 #include <fstream>
 #include <thread>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -47,6 +50,23 @@
 */
 namespace lbcrypto {
 
+	/**
+	* Returns a pointer to the uint64_t payload of a vector so that it can be passed to the
+	* native NTT kernels. Only native vectors have such a payload; NULL is returned otherwise.
+	*
+	* @param &v the vector.
+	* @return a pointer to the first coefficient or NULL.
+	*/
+	template<typename VecType>
+	inline uint64_t* NativeVectorData(VecType &v) { return NULL; }
+
+	template<typename VecType>
+	inline const uint64_t* NativeVectorData(const VecType &v) { return NULL; }
+
+	inline uint64_t* NativeVectorData(NativeVector &v) { return v.GetData(); }
+
+	inline const uint64_t* NativeVectorData(const NativeVector &v) { return v.GetData(); }
+
 	/**
 	* @brief Number Theoretic Transform implemetation
 	*/
@@ -57,7 +77,7 @@ namespace lbcrypto {
 
 	public:
 		/**
-		* Forward transform.
+		* Forward transform. The element and the result may be the same vector.
 		*
 		* @param element is the element to perform the transform on.
 		* @param rootOfUnityTable the root of unity table.
@@ -79,9 +99,7 @@ namespace lbcrypto {
 		result->SetModulus(modulus);
 
 		//reverse coefficients (bit reversal)
-		usint msb = GetMSB64(n - 1);
-		for (size_t i = 0; i < n; i++)
-		  (*result)[i]= element[ReverseBits(i, msb)];
+		BitReverse(element, result);
 
 		IntType omegaFactor;
 		IntType product;
@@ -164,6 +182,7 @@ namespace lbcrypto {
 
 		/**
 		* Forward transform for the NativeInteger case (based on NTL's modular multiplication).
+		* The element and the result may be the same vector.
 		*
 		* @param element is the element to perform the transform on.
 		* @param rootOfUnityTable the root of unity table.
@@ -188,9 +207,7 @@ namespace lbcrypto {
 			result->SetModulus(modulus);
 
 			//reverse coefficients (bit reversal)
-			usint msb = GetMSB64(n - 1);
-			for (size_t i = 0; i < n; i++)
-			  (*result)[i]= element[ReverseBits(i, msb)];
+			BitReverse(element, result);
 
 			IntType omegaFactor;
 			IntType butterflyPlus;
@@ -341,7 +358,7 @@ namespace lbcrypto {
 
 
 		/**
-		* Inverse transform.
+		* Inverse transform. The element and the result may be the same vector.
 		*
 		* @param element is the element to perform the transform on.
 		* @param rootOfUnityInverseTable the root of unity table.
@@ -352,6 +369,7 @@ namespace lbcrypto {
 
 		/**
 		* Inverse transform for the case of NativeInteger (based on NTL's modular multiplication).
+		* The element and the result may be the same vector.
 		*
 		* @param element is the element to perform the transform on.
 		* @param rootOfUnityInverseTable the root of unity table.
@@ -362,6 +380,148 @@ namespace lbcrypto {
 		static void InverseTransformIterative(const VecType& element, const VecType& rootOfUnityInverseTable,
 				const NativeVector& preconRootOfUnityInverseTable, const usint cycloOrder, VecType *transform);
 
+		/**
+		* Forward transform for the case of NativeInteger based on the runtime-dispatched
+		* butterfly kernels (AVX-512, AVX2 or scalar, see native_int::NTTKernels).
+		* The butterflies keep intermediate values in [0,4q) (Harvey's lazy reduction),
+		* so the modulus can have at most native_int::NTT_KERNEL_MAX_MODULUS_BITS bits.
+		* The element and the result may be the same vector.
+		*
+		* @param element is the element to perform the transform on.
+		* @param stageTable the root of unity table in stage order.
+		* @param preconStageTable the Shoup precomputations for stageTable.
+		* @param cycloOrder is the cyclotomic order.
+		* @param result is the output result of the transform.
+		*/
+		static void ForwardTransformIterativeSIMD(const VecType& element, const NativeVector &stageTable,
+				const NativeVector &preconStageTable, const usint cycloOrder, VecType* result);
+
+		/**
+		* Inverse transform for the case of NativeInteger based on the runtime-dispatched
+		* butterfly kernels (AVX-512, AVX2 or scalar, see native_int::NTTKernels).
+		* The butterflies keep intermediate values in [0,4q) (Harvey's lazy reduction),
+		* so the modulus can have at most native_int::NTT_KERNEL_MAX_MODULUS_BITS bits.
+		* The element and the result may be the same vector.
+		*
+		* @param element is the element to perform the transform on.
+		* @param stageTable the root of unity inverse table in stage order.
+		* @param preconStageTable the Shoup precomputations for stageTable.
+		* @param cycloOrder is the cyclotomic order.
+		* @param transform is the output result of the transform.
+		*/
+		static void InverseTransformIterativeSIMD(const VecType& element, const NativeVector &stageTable,
+				const NativeVector &preconStageTable, const usint cycloOrder, VecType *transform);
+
+	private:
+		/**
+		* Copies element to result in bit-reversed order. If result is element itself, the
+		* coefficients are permuted in place.
+		*
+		* @param element is the input vector.
+		* @param result is the output vector, of the same length as element.
+		*/
+		static void BitReverse(const VecType& element, VecType* result) {
+			usint n = result->GetLength();
+			usint msb = GetMSB64(n - 1);
+			if (result == &element) {
+				for (size_t i = 0; i < n; i++) {
+					size_t j = ReverseBits(i, msb);
+					if (i < j)
+						std::swap((*result)[i], (*result)[j]);
+				}
+			}
+			else {
+				for (size_t i = 0; i < n; i++)
+					(*result)[i]= element[ReverseBits(i, msb)];
+			}
+		}
+	};
+
+	/**
+	* @brief Twiddle factor tables of the power-of-two NTT for one modulus, root of unity
+	* and cyclotomic order. The tables are built once by the constructor and never modified
+	* afterwards, so they can be shared freely between threads.
+	*/
+	template<typename VecType>
+	class NTTTables
+	{
+		using IntType = typename VecType::Integer;
+
+	public:
+		/**
+		* Builds all the tables needed by the forward and inverse transforms.
+		*
+		* @param rootOfUnity the root of unity.
+		* @param CycloOrder is the cyclotomic order.
+		* @param modulus is the modulus.
+		*/
+		NTTTables(const IntType& rootOfUnity, const usint CycloOrder, const IntType &modulus);
+
+		const IntType& GetModulus() const { return m_modulus; }
+
+		const IntType& GetRootOfUnity() const { return m_rootOfUnity; }
+
+		usint GetCyclotomicOrder() const { return m_cycloOrder; }
+
+		/**
+		* A root of unity of zero or one means the transform is the identity; no tables are built.
+		*
+		* @return true if the transform is the identity.
+		*/
+		bool IsIdentity() const { return m_rootOfUnity == IntType(0) || m_rootOfUnity == IntType(1); }
+
+		//powers psi^i of the root of unity, and of its inverse, for i < CycloOrder/2
+		const VecType& GetRootOfUnityTable() const { return m_rootOfUnityTable; }
+		const VecType& GetRootOfUnityInverseTable() const { return m_rootOfUnityInverseTable; }
+
+		//NTL-specific precomputations for the tables above (native moduli only)
+		const NativeVector& GetRootOfUnityPreconTable() const { return m_rootOfUnityPreconTable; }
+		const NativeVector& GetRootOfUnityInversePreconTable() const { return m_rootOfUnityInversePreconTable; }
+
+		/**
+		* The tables in stage order used by the native NTT kernels are only built for native
+		* moduli of at most native_int::NTT_KERNEL_MAX_MODULUS_BITS bits.
+		*
+		* @return true if the stage tables are available.
+		*/
+		bool HasStageTables() const { return m_stageTable.GetLength() != 0; }
+
+		//twiddle factors in stage order with their Shoup precomputations (see native_int::NTTKernels)
+		const NativeVector& GetStageTable() const { return m_stageTable; }
+		const NativeVector& GetPreconStageTable() const { return m_preconStageTable; }
+		const NativeVector& GetInverseStageTable() const { return m_inverseStageTable; }
+		const NativeVector& GetInversePreconStageTable() const { return m_inversePreconStageTable; }
+
+		//powers psi^i used to twist the input of the forward negacyclic transform, and the factors
+		//n^{-1}*psi^{-i} that untwist the output of the inverse one, with their Shoup precomputations;
+		//built together with the stage tables
+		const NativeVector& GetTwistTable() const { return m_twistTable; }
+		const NativeVector& GetPreconTwistTable() const { return m_preconTwistTable; }
+		const NativeVector& GetInverseScaleTable() const { return m_inverseScaleTable; }
+		const NativeVector& GetPreconInverseScaleTable() const { return m_preconInverseScaleTable; }
+
+	private:
+		static void ComputeStageTable(const IntType &modulus, const VecType &rootOfUnityTable,
+				NativeVector *stageTable, NativeVector *preconStageTable);
+
+		IntType m_modulus;
+		IntType m_rootOfUnity;
+		usint m_cycloOrder;
+
+		VecType m_rootOfUnityTable;
+		VecType m_rootOfUnityInverseTable;
+		NativeVector m_rootOfUnityPreconTable;
+		NativeVector m_rootOfUnityInversePreconTable;
+
+		NativeVector m_stageTable;
+		NativeVector m_preconStageTable;
+		NativeVector m_inverseStageTable;
+		NativeVector m_inversePreconStageTable;
+
+		NativeVector m_twistTable;
+		NativeVector m_preconTwistTable;
+		NativeVector m_inverseScaleTable;
+		NativeVector m_preconInverseScaleTable;
 	};
 
 	/**
@@ -383,6 +543,17 @@ namespace lbcrypto {
 		*/
 		static void ForwardTransform(const VecType& element, const IntType& rootOfUnity, const usint CycloOrder, VecType *transform);
 
+		/**
+		* Forward transform using tables that were already looked up (see GetNTTTables).
+		* When the tables have stage tables, the multiplication by the powers of the root of unity
+		* is fused into the transform. transform may point to element.
+		*
+		* @param &element is the element to perform the transform on.
+		* @param &tables the twiddle factor tables.
+		* @return is the output result of the transform.
+		*/
+		static void ForwardTransform(const VecType& element, const NTTTables<VecType> &tables, VecType *transform);
+
 		/**
 		* Virtual inverse transform.
 		*
@@ -393,6 +564,66 @@ namespace lbcrypto {
 		*/
 		static void InverseTransform(const VecType& element, const IntType& rootOfUnity, const usint CycloOrder, VecType *transform);
 
+		/**
+		* Inverse transform using tables that were already looked up (see GetNTTTables).
+		* When the tables have stage tables, the final scaling is fused into the transform.
+		* transform may point to element.
+		*
+		* @param &element is the element to perform the inverse transform on.
+		* @param &tables the twiddle factor tables.
+		* @return is the output result of the inverse transform.
+		*/
+		static void InverseTransform(const VecType& element, const NTTTables<VecType> &tables, VecType *transform);
+
+		/**
+		* In-place forward transform: the coefficients of element are replaced by its
+		* evaluation representation, without allocating a temporary vector.
+		*
+		* @param element is the element to transform.
+		* @param rootOfUnity the root of unity.
+		* @param CycloOrder is the cyclotomic order.
+		*/
+		static void ForwardTransformInPlace(VecType *element, const IntType& rootOfUnity, const usint CycloOrder);
+
+		/**
+		* In-place forward transform using tables that were already looked up (see GetNTTTables).
+		*
+		* @param element is the element to transform.
+		* @param &tables the twiddle factor tables.
+		*/
+		static void ForwardTransformInPlace(VecType *element, const NTTTables<VecType> &tables);
+
+		/**
+		* In-place inverse transform: the evaluation representation in element is replaced by
+		* its coefficients, without allocating a temporary vector.
+		*
+		* @param element is the element to transform.
+		* @param rootOfUnity the root of unity.
+		* @param CycloOrder is the cyclotomic order.
+		*/
+		static void InverseTransformInPlace(VecType *element, const IntType& rootOfUnity, const usint CycloOrder);
+
+		/**
+		* In-place inverse transform using tables that were already looked up (see GetNTTTables).
+		*
+		* @param element is the element to transform.
+		* @param &tables the twiddle factor tables.
+		*/
+		static void InverseTransformInPlace(VecType *element, const NTTTables<VecType> &tables);
+
+		/**
+		* Returns the twiddle factor tables for a modulus, root of unity and cyclotomic order,
+		* building them on first use. Lookups of existing tables take no mutex: the registry is
+		* an immutable map, loaded atomically, that is replaced (copy on write, under a mutex) when
+		* tables are added. A replaced version is freed when the last lookup using it finishes.
+		*
+		* @param rootOfUnity the root of unity.
+		* @param CycloOrder is the cyclotomic order.
+		* @param modulus is the modulus
+		* @return the shared tables.
+		*/
+		static std::shared_ptr<const NTTTables<VecType>> GetNTTTables(const IntType& rootOfUnity, const usint CycloOrder, const IntType &modulus);
+
 		/**
 		* Precomputation of root of unity tables.
 		*
@@ -412,15 +643,33 @@ namespace lbcrypto {
 		static void PreCompute(std::vector<IntType> &rootOfUnity, const usint CycloOrder, std::vector<IntType> &moduliiChain);
 
 		/**
-		* Reset cached values for the transform to empty.
+		* Reset cached values for the transform to empty. Tables still referenced elsewhere
+		* (e.g. by element parameters) stay valid. Safe to call concurrently with transforms,
+		* which keep the version of the registry they loaded until they finish.
 		*/
 		static void Reset();
 
-	//private:
-		static std::map<IntType, VecType> m_rootOfUnityTableByModulus;
-		static std::map<IntType, VecType> m_rootOfUnityInverseTableByModulus;
-		static std::map<IntType, NativeVector> m_rootOfUnityPreconTableByModulus;
-		static std::map<IntType, NativeVector> m_rootOfUnityInversePreconTableByModulus;
+	private:
+		struct NTTTablesKey {
+			IntType modulus;
+			IntType rootOfUnity;
+			usint cycloOrder;
+
+			bool operator<(const NTTTablesKey &rhs) const {
+				if (cycloOrder != rhs.cycloOrder)
+					return cycloOrder < rhs.cycloOrder;
+				if (modulus != rhs.modulus)
+					return modulus < rhs.modulus;
+				return rootOfUnity < rhs.rootOfUnity;
+			}
+		};
+
+		typedef std::map<NTTTablesKey, std::shared_ptr<const NTTTables<VecType>>> NTTTablesMap;
+
+		//current version of the registry, only accessed with std::atomic_load and std::atomic_store;
+		//writers hold m_nttTablesMutex
+		static std::shared_ptr<const NTTTablesMap> m_nttTables;
+		static std::mutex m_nttTablesMutex;
 	};
 
 	// struct used as a key in BlueStein transform
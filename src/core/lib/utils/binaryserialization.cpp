@@ -0,0 +1,182 @@
+/**
+ * @file binaryserialization.cpp -- Compact binary serialization of PALISADE objects.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "binaryserialization.h"
+#include "exception.h"
+
+namespace lbcrypto {
+
+static const char BINARY_MAGIC[4] = { 'P', 'A', 'L', 'B' };
+
+// assembles a little endian word from bytes
+static inline uint64_t LoadLittleEndian(const char *p, usint bytes) {
+	uint64_t value = 0;
+	for (usint i = 0; i < bytes; i++)
+		value |= (uint64_t)(uint8_t)p[i] << (8*i);
+	return value;
+}
+
+// checks the magic and the version of a header, and returns the size of the payload
+static uint64_t ParseHeader(const char *header, usint *version, BinaryObjectType *type) {
+	for (usint i = 0; i < 4; i++)
+		if (header[i] != BINARY_MAGIC[i])
+			PALISADE_THROW(deserialize_error, "Not a binary PALISADE object");
+	*version = (uint8_t)header[4];
+	if (*version == 0 || *version > BINARY_SERIALIZATION_VERSION)
+		PALISADE_THROW(deserialize_error, "Unsupported binary format version " + std::to_string(*version));
+	*type = (BinaryObjectType)(uint8_t)header[5];
+	return LoadLittleEndian(header + 6, 8);
+}
+
+void BinaryWriter::WriteString(const std::string &value) {
+	WriteU32((uint32_t)value.size());
+	m_payload.append(value);
+}
+
+void BinaryWriter::WritePacked(const uint64_t *values, size_t count, usint bits) {
+	if (bits < 64) {
+		uint64_t all = 0;
+		for (size_t i = 0; i < count; i++)
+			all |= values[i];
+		if (all >> bits)
+			PALISADE_THROW(serialize_error, "Value does not fit in " + std::to_string(bits) + " bits");
+	}
+
+	FlushBits();
+	m_payload.reserve(m_payload.size() + (count*bits + 7)/8);
+	for (size_t i = 0; i < count; i++)
+		WriteBits(values[i], bits);
+	FlushBits();
+}
+
+void BinaryWriter::FlushBits() {
+	while (m_bitCount > 0) {
+		m_payload.push_back((char)(uint8_t)m_bitBuffer);
+		m_bitBuffer >>= 8;
+		m_bitCount = m_bitCount > 8 ? m_bitCount - 8 : 0;
+	}
+	m_bitBuffer = 0;
+}
+
+void BinaryWriter::WriteTo(std::ostream &out) {
+	FlushBits();
+
+	char header[BINARY_HEADER_SIZE];
+	for (usint i = 0; i < 4; i++)
+		header[i] = BINARY_MAGIC[i];
+	header[4] = (char)BINARY_SERIALIZATION_VERSION;
+	header[5] = (char)m_type;
+	for (usint i = 0; i < 8; i++)
+		header[6 + i] = (char)((uint64_t)m_payload.size() >> (8*i));
+
+	out.write(header, BINARY_HEADER_SIZE);
+	out.write(m_payload.data(), m_payload.size());
+	if (!out)
+		PALISADE_THROW(serialize_error, "Unable to write binary object");
+}
+
+BinaryReader::BinaryReader(std::istream &in, BinaryObjectType type)
+	: m_position(0), m_bitBuffer(0), m_bitCount(0) {
+	char header[BINARY_HEADER_SIZE];
+	if (!in.read(header, BINARY_HEADER_SIZE))
+		PALISADE_THROW(deserialize_error, "Unable to read the header of a binary object");
+	ReadHeader(header, type);
+
+	m_buffer.resize(m_size);
+	if (!in.read(&m_buffer[0], m_size))
+		PALISADE_THROW(deserialize_error, "Binary object is truncated");
+	m_data = m_buffer.data();
+}
+
+BinaryReader::BinaryReader(const char *data, size_t size, BinaryObjectType type)
+	: m_position(0), m_bitBuffer(0), m_bitCount(0) {
+	if (size < BINARY_HEADER_SIZE)
+		PALISADE_THROW(deserialize_error, "Binary object is truncated");
+	ReadHeader(data, type);
+	if (m_size > size - BINARY_HEADER_SIZE)
+		PALISADE_THROW(deserialize_error, "Binary object is truncated");
+	m_data = data + BINARY_HEADER_SIZE;
+}
+
+size_t BinaryReader::ReadHeader(const char *data, size_t size, BinaryObjectType *type) {
+	if (size < BINARY_HEADER_SIZE)
+		PALISADE_THROW(deserialize_error, "Binary object is truncated");
+	usint version;
+	uint64_t payloadSize = ParseHeader(data, &version, type);
+	if (payloadSize > size - BINARY_HEADER_SIZE)
+		PALISADE_THROW(deserialize_error, "Binary object is truncated");
+	return BINARY_HEADER_SIZE + payloadSize;
+}
+
+void BinaryReader::ReadHeader(const char *header, BinaryObjectType type) {
+	BinaryObjectType actual;
+	m_size = ParseHeader(header, &m_version, &actual);
+	if (actual != type)
+		PALISADE_THROW(deserialize_error, "Binary object has type " + std::to_string(actual) +
+				", expected " + std::to_string(type));
+}
+
+std::string BinaryReader::ReadString() {
+	size_t length = ReadU32();
+	Require(length);
+	std::string value(m_data + m_position, length);
+	m_position += length;
+	return value;
+}
+
+void BinaryReader::ReadPacked(uint64_t *values, size_t count, usint bits) {
+	FlushBits();
+	size_t bytes = (count*bits + 7)/8;
+	Require(bytes);
+
+	const char *p = m_data + m_position;
+	const uint64_t mask = Mask(bits);
+	unsigned __int128 buffer = 0;
+	usint available = 0;
+	size_t next = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (available < bits) {
+			// a whole word where possible, the last bytes one at a time
+			usint load = next + 8 <= bytes ? 8 : 1;
+			do {
+				buffer |= (unsigned __int128)LoadLittleEndian(p + next, load) << available;
+				next += load;
+				available += 8*load;
+			} while (available < bits);
+		}
+		values[i] = (uint64_t)buffer & mask;
+		buffer >>= bits;
+		available -= bits;
+	}
+	m_position += bytes;
+}
+
+void BinaryReader::Require(size_t bytes) const {
+	if (bytes > m_size - m_position)
+		PALISADE_THROW(deserialize_error, "Read past the end of a binary object");
+}
+
+} // namespace lbcrypto ends
@@ -0,0 +1,419 @@
+/**
+ * @file binaryserialization.h -- Compact binary serialization of PALISADE objects.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * A binary object is a header followed by a payload:
+ *
+ *   magic "PALB" | version (1 byte) | object type (1 byte) | payload size (8 bytes)
+ *
+ * All integers are little endian. The payload is a sequence of fixed size integers,
+ * length-prefixed strings and bit-packed arrays; a bit-packed array is padded to a whole
+ * number of bytes. Each object writes its own fields in order and reads them back in the
+ * same order; there are no field names.
+ */
+
+#ifndef LBCRYPTO_UTILS_BINARYSERIALIZATION_H
+#define LBCRYPTO_UTILS_BINARYSERIALIZATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "inttypes.h"
+
+namespace lbcrypto {
+
+/**
+ * @brief Types of the objects written in the binary format, stored in their header.
+ */
+enum BinaryObjectType {
+	BINARY_CRYPTO_CONTEXT = 1,
+	BINARY_CIPHERTEXT = 2,
+	BINARY_PUBLIC_KEY = 3,
+	BINARY_PRIVATE_KEY = 4,
+	BINARY_EVAL_KEY = 5,
+	BINARY_EVAL_KEY_STORE = 6,
+	BINARY_CIPHERTEXT_ARCHIVE = 7,
+	BINARY_CIPHERTEXT_ARCHIVE_INDEX = 8,
+	BINARY_CIPHERTEXT_ARCHIVE_END = 9
+};
+
+const usint BINARY_SERIALIZATION_VERSION = 1;	//!< @brief Version of the binary format written by this library.
+const size_t BINARY_HEADER_SIZE = 14;			//!< @brief Size of the header of a binary object, in bytes.
+
+/**
+ * @brief Writes a binary object into memory, then into a stream.
+ */
+class BinaryWriter {
+public:
+	/**
+	 * Starts an object.
+	 *
+	 * @param type the type of the object.
+	 */
+	explicit BinaryWriter(BinaryObjectType type) : m_type(type), m_bitBuffer(0), m_bitCount(0) {}
+
+	void WriteU8(uint8_t value) {
+		FlushBits();
+		m_payload.push_back((char)value);
+	}
+
+	void WriteU32(uint32_t value) { WriteLittleEndian(value, 4); }
+
+	void WriteU64(uint64_t value) { WriteLittleEndian(value, 8); }
+
+	/**
+	 * Writes the length of a string, then its characters.
+	 *
+	 * @param value the string.
+	 */
+	void WriteString(const std::string &value);
+
+	/**
+	 * Appends the low bits of a value to the current bit-packed array.
+	 *
+	 * @param value the value, less than 2^bits.
+	 * @param bits the number of bits to write, at most 64.
+	 */
+	void WriteBits(uint64_t value, usint bits) {
+		m_bitBuffer |= (unsigned __int128)value << m_bitCount;
+		m_bitCount += bits;
+		if (m_bitCount >= 64) {
+			PutWord((uint64_t)m_bitBuffer);
+			m_bitBuffer >>= 64;
+			m_bitCount -= 64;
+		}
+	}
+
+	/**
+	 * Writes a bit-packed array, each value on exactly bits bits.
+	 *
+	 * @param values the values.
+	 * @param count the number of values.
+	 * @param bits the number of bits per value, at most 64.
+	 * @throws serialize_error if a value does not fit in bits bits.
+	 */
+	void WritePacked(const uint64_t *values, size_t count, usint bits);
+
+	/**
+	 * Ends the current bit-packed array, padding it to a whole number of bytes. The other
+	 * write methods do it implicitly.
+	 */
+	void FlushBits();
+
+	/**
+	 * Writes the header and the payload written so far into a stream.
+	 *
+	 * @param out the stream.
+	 * @throws serialize_error if the stream fails.
+	 */
+	void WriteTo(std::ostream &out);
+
+	/**
+	 * @return the size of the object written so far, with its header.
+	 */
+	size_t GetSize() const { return BINARY_HEADER_SIZE + m_payload.size() + (m_bitCount + 7)/8; }
+
+private:
+	void WriteLittleEndian(uint64_t value, usint bytes) {
+		FlushBits();
+		for (usint i = 0; i < bytes; i++)
+			m_payload.push_back((char)(value >> (8*i)));
+	}
+
+	void PutWord(uint64_t word) {
+		char bytes[8];
+		for (usint i = 0; i < 8; i++)
+			bytes[i] = (char)(word >> (8*i));
+		m_payload.append(bytes, 8);
+	}
+
+	BinaryObjectType m_type;
+	std::string m_payload;
+	// bits of the current bit-packed array not written to the payload yet
+	unsigned __int128 m_bitBuffer;
+	usint m_bitCount;
+};
+
+/**
+ * @brief Reads a binary object from a stream or from memory.
+ *
+ * All read methods throw deserialize_error when they would read past the end of the payload.
+ */
+class BinaryReader {
+public:
+	/**
+	 * Reads an object from a stream: its header, then exactly its payload.
+	 *
+	 * @param in the stream.
+	 * @param type the expected type of the object.
+	 * @throws deserialize_error if the header is malformed or the object has another type.
+	 */
+	BinaryReader(std::istream &in, BinaryObjectType type);
+
+	/**
+	 * Reads an object from memory, without copying it. The memory must outlive the reader.
+	 *
+	 * @param data the object, starting with its header.
+	 * @param size the number of bytes available at data.
+	 * @param type the expected type of the object.
+	 * @throws deserialize_error if the header is malformed or the object has another type.
+	 */
+	BinaryReader(const char *data, size_t size, BinaryObjectType type);
+
+	BinaryReader(const BinaryReader &rhs) = delete;
+	BinaryReader& operator=(const BinaryReader &rhs) = delete;
+
+	uint8_t ReadU8() {
+		FlushBits();
+		Require(1);
+		return (uint8_t)m_data[m_position++];
+	}
+
+	/**
+	 * Returns the next byte without consuming it.
+	 *
+	 * @return the byte.
+	 */
+	uint8_t PeekU8() {
+		FlushBits();
+		Require(1);
+		return (uint8_t)m_data[m_position];
+	}
+
+	uint32_t ReadU32() { return (uint32_t)ReadLittleEndian(4); }
+
+	uint64_t ReadU64() { return ReadLittleEndian(8); }
+
+	/**
+	 * Reads a string written by BinaryWriter::WriteString.
+	 *
+	 * @return the string.
+	 */
+	std::string ReadString();
+
+	/**
+	 * Reads the next value of the current bit-packed array.
+	 *
+	 * @param bits the number of bits of the value, at most 64.
+	 * @return the value.
+	 */
+	uint64_t ReadBits(usint bits) {
+		while (m_bitCount < bits) {
+			Require(1);
+			m_bitBuffer |= (unsigned __int128)(uint8_t)m_data[m_position++] << m_bitCount;
+			m_bitCount += 8;
+		}
+		uint64_t value = (uint64_t)m_bitBuffer & Mask(bits);
+		m_bitBuffer >>= bits;
+		m_bitCount -= bits;
+		return value;
+	}
+
+	/**
+	 * Reads a bit-packed array written by BinaryWriter::WritePacked.
+	 *
+	 * @param values the buffer for the values.
+	 * @param count the number of values.
+	 * @param bits the number of bits per value, at most 64.
+	 */
+	void ReadPacked(uint64_t *values, size_t count, usint bits);
+
+	/**
+	 * Skips the padding at the end of the current bit-packed array. The other read methods
+	 * do it implicitly.
+	 */
+	void FlushBits() {
+		m_bitBuffer = 0;
+		m_bitCount = 0;
+	}
+
+	/**
+	 * @return the version of the format the object was written with.
+	 */
+	usint GetVersion() const { return m_version; }
+
+	/**
+	 * @return the size of the object, with its header.
+	 */
+	size_t GetSize() const { return BINARY_HEADER_SIZE + m_size; }
+
+	/**
+	 * @return whether the whole payload was read.
+	 */
+	bool AtEnd() const { return m_position == m_size; }
+
+	/**
+	 * Reads the header of an object in memory.
+	 *
+	 * @param data the object, starting with its header.
+	 * @param size the number of bytes available at data.
+	 * @param type receives the type of the object.
+	 * @return the size of the object, with its header.
+	 * @throws deserialize_error if the header is malformed.
+	 */
+	static size_t ReadHeader(const char *data, size_t size, BinaryObjectType *type);
+
+private:
+	void ReadHeader(const char *header, BinaryObjectType type);
+
+	uint64_t ReadLittleEndian(usint bytes) {
+		FlushBits();
+		Require(bytes);
+		uint64_t value = 0;
+		for (usint i = 0; i < bytes; i++)
+			value |= (uint64_t)(uint8_t)m_data[m_position++] << (8*i);
+		return value;
+	}
+
+	void Require(size_t bytes) const;
+
+	static uint64_t Mask(usint bits) { return bits == 64 ? ~(uint64_t)0 : ((uint64_t)1 << bits) - 1; }
+
+	// the payload, owned when it was read from a stream
+	std::string m_buffer;
+	const char *m_data;
+	size_t m_size;
+	size_t m_position;
+	usint m_version;
+	unsigned __int128 m_bitBuffer;
+	usint m_bitCount;
+};
+
+/**
+ * @brief A binary object in memory whose reading is deferred to the first use of what it holds.
+ *
+ * The memory is kept alive by an owner, for instance a MappedFile, until the object is read.
+ * ReadPending is safe to call from several threads; only the first call reads the object.
+ */
+class DeferredBinary {
+public:
+	DeferredBinary() : m_data(nullptr), m_size(0), m_type(BINARY_EVAL_KEY), m_pending(false) {}
+
+	DeferredBinary(const DeferredBinary &rhs)
+		: m_data(rhs.m_data), m_size(rhs.m_size), m_type(rhs.m_type), m_owner(rhs.m_owner),
+		  m_pending(rhs.m_pending.load()) {}
+
+	DeferredBinary& operator=(const DeferredBinary &rhs) {
+		m_data = rhs.m_data;
+		m_size = rhs.m_size;
+		m_type = rhs.m_type;
+		m_owner = rhs.m_owner;
+		m_pending = rhs.m_pending.load();
+		return *this;
+	}
+
+	/**
+	 * Records the object to read on first use.
+	 *
+	 * @param data the object, starting with its header.
+	 * @param size the number of bytes available at data.
+	 * @param type the expected type of the object.
+	 * @param owner keeps data alive until the object is read.
+	 */
+	void Set(const char *data, size_t size, BinaryObjectType type, std::shared_ptr<const void> owner) {
+		m_data = data;
+		m_size = size;
+		m_type = type;
+		m_owner = owner;
+		m_pending = true;
+	}
+
+	/**
+	 * Forgets the object, after what it holds was replaced.
+	 */
+	void Clear() {
+		m_data = nullptr;
+		m_size = 0;
+		m_owner.reset();
+		m_pending = false;
+	}
+
+	/**
+	 * @return whether the object was not read yet.
+	 */
+	bool IsPending() const { return m_pending.load(std::memory_order_acquire); }
+
+	/**
+	 * Reads the object if it was not read yet, and releases its memory.
+	 *
+	 * @param read called with a reader of the object.
+	 */
+	template<typename Read>
+	void ReadPending(Read read) const {
+		if (!m_pending.load(std::memory_order_acquire))
+			return;
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_pending.load(std::memory_order_relaxed)) {
+			BinaryReader reader(m_data, m_size, m_type);
+			read(reader);
+			m_owner.reset();
+			m_pending.store(false, std::memory_order_release);
+		}
+	}
+
+private:
+	const char *m_data;
+	size_t m_size;
+	BinaryObjectType m_type;
+	mutable std::shared_ptr<const void> m_owner;
+	mutable std::atomic<bool> m_pending;
+	mutable std::mutex m_mutex;
+};
+
+/**
+ * Writes the number of elements of a vector, then the elements.
+ *
+ * @param writer the binary object being written.
+ * @param elements the elements, of a type with a SerializeBinary method.
+ */
+template<typename Element>
+void SerializeBinaryVector(BinaryWriter &writer, const std::vector<Element> &elements) {
+	writer.WriteU32(elements.size());
+	for (size_t i = 0; i < elements.size(); i++)
+		elements[i].SerializeBinary(writer);
+}
+
+/**
+ * Reads a vector written by SerializeBinaryVector.
+ *
+ * @param reader the binary object being read.
+ * @param elements receives the elements, of a type with a DeserializeBinary method.
+ */
+template<typename Element>
+void DeserializeBinaryVector(BinaryReader &reader, std::vector<Element> *elements) {
+	usint size = reader.ReadU32();
+	elements->clear();
+	elements->resize(size);
+	for (usint i = 0; i < size; i++)
+		(*elements)[i].DeserializeBinary(reader);
+}
+
+} // namespace lbcrypto ends
+
+#endif
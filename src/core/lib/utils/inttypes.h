@@ -70,4 +70,12 @@ enum MODE {
 	OPTIMIZED = 1
 };
 
+/**
+* @brief Lists the distributions the noise of RLWE schemes can be drawn from
+*/
+enum NoiseDistribution {
+	GAUSSIAN = 0,
+	CENTERED_BINOMIAL = 1
+};
+
 #endif
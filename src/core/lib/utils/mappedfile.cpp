@@ -0,0 +1,88 @@
+/**
+ * @file mappedfile.cpp -- Read-only memory mappings of files.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "mappedfile.h"
+#include "exception.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace lbcrypto {
+
+std::shared_ptr<const MappedFile> MappedFile::Open(const std::string &filename) {
+	std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifndef _WIN32
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0)
+		PALISADE_THROW(deserialize_error, "Unable to open " + filename);
+
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		PALISADE_THROW(deserialize_error, "Unable to read the size of " + filename);
+	}
+
+	file->m_size = st.st_size;
+	if (file->m_size > 0) {
+		void *data = mmap(nullptr, file->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			close(fd);
+			PALISADE_THROW(deserialize_error, "Unable to map " + filename);
+		}
+		file->m_data = static_cast<const char*>(data);
+	}
+	// the mapping stays valid after the descriptor is closed
+	close(fd);
+#else
+	std::ifstream in(filename, std::ios::binary);
+	if (!in)
+		PALISADE_THROW(deserialize_error, "Unable to open " + filename);
+	std::stringstream contents;
+	contents << in.rdbuf();
+	file->m_buffer = contents.str();
+	file->m_data = file->m_buffer.data();
+	file->m_size = file->m_buffer.size();
+#endif
+
+	return file;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+	if (m_data != nullptr)
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+} // namespace lbcrypto ends
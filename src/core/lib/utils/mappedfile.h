@@ -0,0 +1,78 @@
+/**
+ * @file mappedfile.h -- Read-only memory mappings of files.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef LBCRYPTO_UTILS_MAPPEDFILE_H
+#define LBCRYPTO_UTILS_MAPPEDFILE_H
+
+#include <memory>
+#include <string>
+
+namespace lbcrypto {
+
+/**
+ * @brief A file mapped read-only into memory.
+ *
+ * The pages of the file are loaded by the operating system when they are first read, so
+ * mapping a large file is immediate. Where memory mappings are not available, the file is
+ * read into memory instead.
+ */
+class MappedFile {
+public:
+	/**
+	 * Maps a file.
+	 *
+	 * @param filename the name of the file.
+	 * @throws deserialize_error if the file cannot be opened or mapped.
+	 */
+	static std::shared_ptr<const MappedFile> Open(const std::string &filename);
+
+	~MappedFile();
+
+	MappedFile(const MappedFile &rhs) = delete;
+	MappedFile& operator=(const MappedFile &rhs) = delete;
+
+	/**
+	 * @return the contents of the file.
+	 */
+	const char *GetData() const { return m_data; }
+
+	/**
+	 * @return the size of the file, in bytes.
+	 */
+	size_t GetSize() const { return m_size; }
+
+private:
+	MappedFile() : m_data(nullptr), m_size(0) {}
+
+	const char *m_data;
+	size_t m_size;
+	// the contents of the file, when it could not be mapped
+	std::string m_buffer;
+};
+
+} // namespace lbcrypto ends
+
+#endif
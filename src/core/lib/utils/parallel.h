@@ -29,6 +29,7 @@
 #define SRC_CORE_LIB_UTILS_PARALLEL_H_
 
 #include "omp.h"
+#include <exception>
 
 namespace lbcrypto {
 
@@ -51,6 +52,32 @@ public:
 
 extern ParallelControls PalisadeParallelControls;
 
+/**
+ * Carries an exception out of a parallel loop, which exceptions cannot leave: the iterations
+ * call Capture in a catch block, and Rethrow after the loop rethrows the first exception captured
+ * with its original type.
+ */
+class ParallelException {
+	std::exception_ptr m_exception;
+public:
+	/**
+	 * Keeps the exception being handled, unless one was kept already.
+	 */
+	void Capture() {
+#pragma omp critical(ParallelException)
+		if (!m_exception)
+			m_exception = std::current_exception();
+	}
+
+	/**
+	 * Rethrows the exception kept, if any.
+	 */
+	void Rethrow() const {
+		if (m_exception)
+			std::rethrow_exception(m_exception);
+	}
+};
+
 }
 
 #endif /* SRC_CORE_LIB_UTILS_PARALLEL_H_ */
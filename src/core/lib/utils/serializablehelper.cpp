@@ -149,4 +149,105 @@ bool SerializableHelper::ReadSerializationFromFile(const std::string jsonFileNam
 	return !serObj->HasParseError();
 }
 
+// the value is over once the parser finishes it, so the rest of the stream is left unread
+static const unsigned STREAM_PARSE_FLAGS = rapidjson::kParseStopWhenDoneFlag;
+
+// records the kind of a token, and its string for strings and keys
+class SerializedStreamReader::TokenHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, TokenHandler> {
+public:
+	TokenHandler(Token* token, std::string* str) : m_token(token), m_str(str) {}
+
+	bool Default() { *m_token = TOKEN_SCALAR; return true; }
+	bool String(const char* str, rapidjson::SizeType length, bool) { *m_token = TOKEN_STRING; return Assign(str, length); }
+	bool Key(const char* str, rapidjson::SizeType length, bool) { *m_token = TOKEN_KEY; return Assign(str, length); }
+	bool StartObject() { *m_token = TOKEN_START_OBJECT; return true; }
+	bool EndObject(rapidjson::SizeType) { *m_token = TOKEN_END_OBJECT; return true; }
+	bool StartArray() { *m_token = TOKEN_START_ARRAY; return true; }
+	bool EndArray(rapidjson::SizeType) { *m_token = TOKEN_END_ARRAY; return true; }
+
+private:
+	bool Assign(const char* str, rapidjson::SizeType length) {
+		if( m_str != 0 )
+			m_str->assign(str, length);
+		return true;
+	}
+
+	Token* m_token;
+	std::string* m_str;
+};
+
+// forwards the tokens of a value to a handler, and tracks how deep into the value they are
+template<typename Handler>
+class ValueHandler {
+public:
+	explicit ValueHandler(Handler& handler) : m_handler(handler), m_depth(0) {}
+
+	bool Null() { return m_handler.Null(); }
+	bool Bool(bool b) { return m_handler.Bool(b); }
+	bool Int(int i) { return m_handler.Int(i); }
+	bool Uint(unsigned i) { return m_handler.Uint(i); }
+	bool Int64(int64_t i) { return m_handler.Int64(i); }
+	bool Uint64(uint64_t i) { return m_handler.Uint64(i); }
+	bool Double(double d) { return m_handler.Double(d); }
+	bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) { return m_handler.RawNumber(str, length, copy); }
+	bool String(const char* str, rapidjson::SizeType length, bool copy) { return m_handler.String(str, length, copy); }
+	bool Key(const char* str, rapidjson::SizeType length, bool copy) { return m_handler.Key(str, length, copy); }
+	bool StartObject() { m_depth++; return m_handler.StartObject(); }
+	bool EndObject(rapidjson::SizeType count) { m_depth--; return m_handler.EndObject(count); }
+	bool StartArray() { m_depth++; return m_handler.StartArray(); }
+	bool EndArray(rapidjson::SizeType count) { m_depth--; return m_handler.EndArray(count); }
+
+	int GetDepth() const { return m_depth; }
+
+private:
+	Handler& m_handler;
+	int m_depth;
+};
+
+SerializedStreamReader::SerializedStreamReader(std::istream& in) : m_stream(in) {
+	m_reader.IterativeParseInit();
+}
+
+bool SerializedStreamReader::Next(Token* token, std::string* str) {
+	TokenHandler handler(token, str);
+	return m_reader.IterativeParseNext<STREAM_PARSE_FLAGS>(m_stream, handler);
+}
+
+template<typename Handler>
+bool SerializedStreamReader::ReadInto(Handler& handler) {
+	ValueHandler<Handler> value(handler);
+	do {
+		if( !m_reader.IterativeParseNext<STREAM_PARSE_FLAGS>(m_stream, value) )
+			return false;
+	} while( value.GetDepth() > 0 );
+	return true;
+}
+
+bool SerializedStreamReader::StartObject() {
+	Token token;
+	return Next(&token, 0) && token == TOKEN_START_OBJECT;
+}
+
+bool SerializedStreamReader::NextMember(std::string* name) {
+	Token token;
+	return Next(&token, name) && token == TOKEN_KEY;
+}
+
+bool SerializedStreamReader::ReadString(std::string* value) {
+	Token token;
+	return Next(&token, value) && token == TOKEN_STRING;
+}
+
+bool SerializedStreamReader::ReadValue(Serialized* value) {
+	bool ok = false;
+	auto generator = [this, &ok](Serialized& handler) { return ok = ReadInto(handler); };
+	value->Populate(generator);
+	return ok;
+}
+
+bool SerializedStreamReader::SkipValue() {
+	rapidjson::BaseReaderHandler<> ignore;
+	return ReadInto(ignore);
+}
+
 }
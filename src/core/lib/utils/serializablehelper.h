@@ -1197,6 +1197,78 @@ namespace lbcrypto {
     std::ostream& os_;
   };
 
+  /**
+   * @brief Reads a serialization from a stream incrementally, with the rapidjson pull parser.
+   *
+   * Objects can be entered to read their members one at a time, and only the values read with
+   * ReadValue are built as a Serialized, so that a large serialization (a map of keys, a vector
+   * of ciphertexts) is never held in memory whole. The text is read from the stream as it is
+   * parsed. Each method reads the next value of the serialization, which must be of the expected
+   * kind; the methods return false on parse errors and on values of another kind.
+   */
+  class SerializedStreamReader {
+  public:
+    /**
+     * @param in the stream, positioned at the start of a serialization.
+     */
+    explicit SerializedStreamReader(std::istream& in);
+
+    /**
+     * Enters the next value, an object; its members are then read with NextMember.
+     * @return success or failure
+     */
+    bool StartObject();
+
+    /**
+     * Reads the name of the next member of the current object; its value comes next.
+     * @param name receives the name of the member.
+     * @return false at the end of the current object, which is then left, or on failure
+     */
+    bool NextMember(std::string* name);
+
+    /**
+     * Reads the next value, a string.
+     * @param value receives the string.
+     * @return success or failure
+     */
+    bool ReadString(std::string* value);
+
+    /**
+     * Reads the next value whole.
+     * @param value receives the value.
+     * @return success or failure
+     */
+    bool ReadValue(Serialized* value);
+
+    /**
+     * Skips the next value.
+     * @return success or failure
+     */
+    bool SkipValue();
+
+    /**
+     * @return whether the parse failed, as opposed to finding a value of another kind.
+     */
+    bool HasParseError() const { return m_reader.HasParseError(); }
+
+  private:
+    // the kinds of tokens read by Next
+    enum Token { TOKEN_SCALAR, TOKEN_STRING, TOKEN_KEY, TOKEN_START_OBJECT, TOKEN_END_OBJECT,
+                 TOKEN_START_ARRAY, TOKEN_END_ARRAY };
+
+    class TokenHandler;
+
+    // reads the next token, and its string for strings and keys
+    bool Next(Token* token, std::string* str);
+
+    // reads the tokens of the next value into a handler
+    template<typename Handler>
+    bool ReadInto(Handler& handler);
+
+    IStreamWrapper m_stream;
+    rapidjson::Reader m_reader;
+  };
+
 }
 
 #endif
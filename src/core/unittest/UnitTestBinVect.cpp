@@ -632,3 +632,82 @@ void modmul_vector(const string& msg) {
 TEST(UTBinVect,modmul_vector) {
 	RUN_BIG_BACKENDS(modmul_vector, "modmul_vector")
 }
+
+// payloads of native vectors are aligned for every allocator, and can be released
+// after the allocator has been switched and from other threads
+TEST(UTBinVect,native_aligned_storage) {
+	native_int::NativeAllocatorType saved = native_int::NativeVectorMemory::GetAllocator();
+	native_int::NativeAllocatorType types[] = { native_int::NATIVE_ALLOCATOR_HEAP, native_int::NATIVE_ALLOCATOR_THREAD_POOL, native_int::NATIVE_ALLOCATOR_BLOCK };
+	std::vector<NativeVector> kept;
+
+	for (usint t = 0; t < 3; t++) {
+		native_int::NativeVectorMemory::SetAllocator(types[t]);
+		for (usint len = 1; len <= 4096; len *= 4) {
+			NativeVector v(len, NativeInteger(1) << 40);
+			for (usint i = 0; i < len; i++)
+				v[i] = NativeInteger(3*i + t);
+			ASSERT_EQ(0U, (uintptr_t)v.GetData() % native_int::NATIVE_VECTOR_ALIGNMENT) << "allocator " << t << " length " << len;
+			for (usint i = 0; i < len; i++)
+				ASSERT_EQ(v[i].ConvertToInt(), v.GetData()[i]);
+			v.GetData()[len-1] = 17;
+			EXPECT_EQ(17U, v[len-1].ConvertToInt());
+			kept.push_back(v);
+		}
+	}
+
+	native_int::NativeVectorMemory::SetAllocator(native_int::NATIVE_ALLOCATOR_THREAD_POOL);
+#pragma omp parallel for
+	for (usint i = 0; i < kept.size(); i++) {
+		NativeVector copy(kept[i]);
+		EXPECT_EQ(0U, (uintptr_t)copy.GetData() % native_int::NATIVE_VECTOR_ALIGNMENT);
+		EXPECT_EQ(kept[i], copy);
+		kept[i] = NativeVector(1, NativeInteger(97));
+	}
+	native_int::NativeVectorMemory::ReleaseThreadPool();
+
+	native_int::NativeVectorMemory::SetAllocator(native_int::NATIVE_ALLOCATOR_HEAP);
+	kept.clear();
+	native_int::NativeVectorMemory::SetAllocator(saved);
+}
+
+// the fused and lazy native operations match the separate ModMul / ModAdd / ModSub,
+// including for moduli too large for the NTL code path and for full 64-bit moduli
+TEST(UTBinVect,native_fused_mul_add) {
+	NativeInteger moduli[] = { NativeInteger((uint64_t)((1ULL << 40) - 87)), NativeInteger((uint64_t)((1ULL << 60) - 93)),
+			NativeInteger((uint64_t)(~0ULL - 58)) };
+	usint n = 64;
+
+	for (usint m = 0; m < 3; m++) {
+		DiscreteUniformGeneratorImpl<NativeVector> dug;
+		dug.SetModulus(moduli[m]);
+
+		NativeVector acc = dug.GenerateVector(n);
+		std::vector<NativeVector> a, b;
+		for (usint k = 0; k < 9; k++) {
+			a.push_back(dug.GenerateVector(n));
+			b.push_back(dug.GenerateVector(n));
+		}
+
+		NativeVector result(acc);
+		result.AddMulInPlace(a[0], b[0]);
+		EXPECT_EQ(acc.ModAdd(a[0].ModMul(b[0])), result) << "AddMulInPlace modulus " << moduli[m];
+
+		result = acc;
+		result.SubMulInPlace(a[0], b[0]);
+		EXPECT_EQ(acc.ModSub(a[0].ModMul(b[0])), result) << "SubMulInPlace modulus " << moduli[m];
+
+		NativeVector expected(acc);
+		std::vector<std::pair<const NativeVector*, const NativeVector*>> terms;
+		for (usint k = 0; k < a.size(); k++) {
+			expected.ModAddEq(a[k].ModMul(b[k]));
+			terms.push_back(std::make_pair(&a[k], &b[k]));
+		}
+		result = acc;
+		result.AddInnerProductInPlace(terms);
+		EXPECT_EQ(expected, result) << "AddInnerProductInPlace modulus " << moduli[m];
+	}
+
+	NativeVector shorter(n/2, moduli[0]);
+	NativeVector v(n, moduli[0]);
+	EXPECT_THROW(v.AddMulInPlace(shorter, v), std::logic_error);
+}
@@ -673,6 +673,223 @@ TEST(UTDCRTPoly, DCRT_mod_ops_on_two_elements) {
 	RUN_BIG_DCRTPOLYS(DCRT_mod_ops_on_two_elements, "DCRT DCRT_mod_ops_on_two_elements");
 }
 
+template<typename Element>
+void DCRT_batch_switch_format(const string& msg) {
+
+	usint order = 64;
+	usint nBits = 24;
+	usint towersize = 3;
+
+	shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams = GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+	typename Element::DugType dug;
+
+	Element op1(dug, ildcrtparams, Format::COEFFICIENT);
+	Element op2(dug, ildcrtparams, Format::EVALUATION);
+	Element op3(dug, ildcrtparams, Format::COEFFICIENT);
+
+	Element expected1(op1), expected2(op2), expected3(op3);
+	expected1.SwitchFormat();
+	expected2.SwitchFormat();
+	expected3.SwitchFormat();
+
+	// each polynomial switches from its own format
+	Element::SwitchFormat({ &op1, &op2 });
+	EXPECT_EQ(expected1, op1) << msg << " Failure: batched SwitchFormat";
+	EXPECT_EQ(expected2, op2) << msg << " Failure: batched SwitchFormat";
+	EXPECT_EQ(Format::EVALUATION, op1.GetFormat()) << msg;
+	EXPECT_EQ(Format::COEFFICIENT, op2.GetFormat()) << msg;
+
+	// whole polynomials and single towers in the same batch
+	typename Element::NTTBatch batch;
+	batch.Add(&op3);
+	NativePoly tower(op1.GetElementAtIndex(0));
+	batch.Add(&tower);
+	EXPECT_EQ(towersize + 1, batch.Size()) << msg;
+	batch.Run();
+	EXPECT_EQ(0U, batch.Size()) << msg;
+	EXPECT_EQ(expected3, op3) << msg << " Failure: NTTBatch";
+	NativePoly towerExpected(op1.GetElementAtIndex(0));
+	towerExpected.SwitchFormat();
+	EXPECT_EQ(towerExpected, tower) << msg << " Failure: NTTBatch tower";
+}
+
+TEST(UTDCRTPoly, DCRT_batch_switch_format) {
+	RUN_BIG_DCRTPOLYS(DCRT_batch_switch_format, "DCRT batch_switch_format");
+}
+
+template<typename Element>
+void DCRT_fused_mul_add(const string& msg) {
+
+	usint order = 64;
+	usint nBits = 50;
+	usint towersize = 3;
+
+	shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams = GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+	typename Element::DugType dug;
+
+	std::vector<Element> a, b;
+	for (usint k = 0; k < 5; k++) {
+		a.push_back(Element(dug, ildcrtparams, Format::EVALUATION));
+		b.push_back(Element(dug, ildcrtparams, Format::EVALUATION));
+	}
+	Element acc(dug, ildcrtparams, Format::EVALUATION);
+
+	Element expected = acc + a[0] * b[0];
+	Element result(acc);
+	result.AddMulInPlace(a[0], b[0]);
+	EXPECT_EQ(expected, result) << msg << " Failure: AddMulInPlace";
+
+	expected = acc - a[1] * b[1];
+	result = acc;
+	result.SubMulInPlace(a[1], b[1]);
+	EXPECT_EQ(expected, result) << msg << " Failure: SubMulInPlace";
+
+	expected = acc;
+	std::vector<std::pair<const Element*, const Element*>> terms;
+	for (usint k = 0; k < a.size(); k++) {
+		expected += a[k] * b[k];
+		terms.push_back(std::make_pair(&a[k], &b[k]));
+	}
+	result = acc;
+	result.AddInnerProductInPlace(terms);
+	EXPECT_EQ(expected, result) << msg << " Failure: AddInnerProductInPlace";
+
+	// vectors of different lengths, so that the outputs have different numbers of terms
+	std::vector<Element> b3(b.begin(), b.begin() + 3);
+	std::vector<Element> product = Element::TensorProduct(a, b3);
+	ASSERT_EQ(a.size() + b3.size() - 1, product.size()) << msg << " Failure: TensorProduct size";
+	for (usint k = 0; k < product.size(); k++) {
+		expected = Element(ildcrtparams, Format::EVALUATION, true);
+		for (usint i = 0; i < a.size(); i++)
+			if (k >= i && k - i < b3.size())
+				expected += a[i] * b3[k-i];
+		EXPECT_EQ(expected, product[k]) << msg << " Failure: TensorProduct element " << k;
+	}
+}
+
+TEST(UTDCRTPoly, DCRT_fused_mul_add) {
+	RUN_BIG_DCRTPOLYS(DCRT_fused_mul_add, "DCRT fused_mul_add");
+}
+
+template<typename Element>
+void DCRT_move_semantics(const string& msg) {
+
+	// containers of elements move rather than copy them when they grow
+	EXPECT_TRUE(std::is_nothrow_move_constructible<Element>::value) << msg;
+	EXPECT_TRUE(std::is_nothrow_move_constructible<NativePoly>::value) << msg;
+
+	usint order = 16;
+	usint nBits = 24;
+	usint towersize = 3;
+
+	shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams = GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+	typename Element::DugType dug;
+
+	Element original(dug, ildcrtparams, Format::EVALUATION);
+	Element source(original);
+	const NativeInteger *payload = &source.GetElementAtIndex(0).GetValues()[0];
+
+	Element moved(std::move(source));
+	EXPECT_EQ(original, moved) << msg;
+	EXPECT_EQ(0U, source.GetNumOfElements()) << msg << " Failure: move constructor copied";
+	EXPECT_EQ(payload, &moved.GetElementAtIndex(0).GetValues()[0]) << msg << " Failure: move constructor reallocated";
+
+	Element assigned;
+	assigned = std::move(moved);
+	EXPECT_EQ(original, assigned) << msg;
+	EXPECT_EQ(payload, &assigned.GetElementAtIndex(0).GetValues()[0]) << msg << " Failure: move assignment reallocated";
+}
+
+TEST(UTDCRTPoly, DCRT_move_semantics) {
+	RUN_BIG_DCRTPOLYS(DCRT_move_semantics, "DCRT move_semantics");
+}
+
+// every tower holds the same small sample, reduced by its own modulus
+template<typename Element>
+void CheckSmallTowers(const Element& e, int64_t bound, const string& msg) {
+	auto ildcrtparams = e.GetParams();
+	for (usint j = 0; j < ildcrtparams->GetRingDimension(); j++) {
+		int64_t first = 0;
+		for (usint i = 0; i < ildcrtparams->GetParams().size(); i++) {
+			uint64_t q = ildcrtparams->GetParams()[i]->GetModulus().ConvertToInt();
+			uint64_t v = e.GetElementAtIndex(i).GetValues()[j].ConvertToInt();
+			int64_t centered = (v > q/2) ? -(int64_t)(q - v) : (int64_t)v;
+			if (i == 0)
+				first = centered;
+			EXPECT_EQ(first, centered) << msg << " Failure: tower " << i << " index " << j;
+			EXPECT_LE(std::abs(centered), bound) << msg;
+		}
+	}
+}
+
+template<typename Element>
+void DCRT_dgg_towers(const string& msg) {
+
+	usint order = 64;
+	usint nBits = 50;
+	usint towersize = 4;
+
+	shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams = GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+	typename Element::DggType dgg(3.2);
+	Element e(dgg, ildcrtparams, Format::COEFFICIENT);
+	CheckSmallTowers(e, (int64_t)(3.2*10), msg);
+
+	typename Element::TugType tug;
+	Element t(tug, ildcrtparams, Format::COEFFICIENT);
+	CheckSmallTowers(t, 1, msg + " tug");
+
+	typename Element::BugType bug;
+	Element b(bug, ildcrtparams, Format::COEFFICIENT);
+	CheckSmallTowers(b, 1, msg + " bug");
+}
+
+TEST(UTDCRTPoly, DCRT_dgg_towers) {
+	RUN_BIG_DCRTPOLYS(DCRT_dgg_towers, "DCRT dgg_towers");
+}
+
+// an element expanded from a seed depends only on the seed and the parameters
+template<typename Element>
+void DCRT_seeded_uniform(const string& msg) {
+
+	usint order = 64;
+	usint nBits = 50;
+	usint towersize = 4;
+
+	shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams = GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+	const PRNGSeed seed = {{ 8, 7, 6, 5, 4, 3, 2, 1 }};
+	Element a(seed, ildcrtparams, Format::EVALUATION);
+	Element b(seed, ildcrtparams, Format::EVALUATION);
+	Element c(ChaCha20Engine::DeriveSeed(seed, 1), ildcrtparams, Format::EVALUATION);
+
+	EXPECT_EQ(Format::EVALUATION, a.GetFormat()) << msg;
+	EXPECT_EQ(a, b) << msg;
+	EXPECT_NE(a, c) << msg;
+
+	for (usint i = 0; i < towersize; i++) {
+		const typename Element::PolyType &tower = a.GetElementAtIndex(i);
+		EXPECT_EQ(ildcrtparams->GetParams()[i]->GetModulus(), tower.GetModulus()) << msg;
+		for (usint j = 0; j < ildcrtparams->GetRingDimension(); j++)
+			EXPECT_LT(tower.GetValues()[j], tower.GetModulus()) << msg;
+		// towers are expanded from different streams
+		if (i > 0) {
+			EXPECT_NE(a.GetElementAtIndex(0).GetValues()[0], tower.GetValues()[0]) << msg;
+		}
+	}
+
+	Element d(seed, ildcrtparams, Format::COEFFICIENT);
+	EXPECT_EQ(Format::COEFFICIENT, d.GetFormat()) << msg;
+	EXPECT_EQ(a.GetElementAtIndex(0).GetValues(), d.GetElementAtIndex(0).GetValues()) << msg;
+}
+
+TEST(UTDCRTPoly, DCRT_seeded_uniform) {
+	RUN_BIG_DCRTPOLYS(DCRT_seeded_uniform, "DCRT seeded_uniform");
+}
+
 // only need to try this with one
 void testDCRTPolyConstructorNegative(std::vector<NativePoly> &towers) {
 	DCRTPoly expectException(towers);
@@ -640,3 +640,255 @@ TEST(UTDistrGen, Karney_Variance) {
 	RUN_ALL_BACKENDS(Karney_Variance, "Karney_Variance")
 }
 
+
+// ChaCha20 block function test vector of RFC 7539, section 2.3.2; its 32-bit block counter and
+// 96-bit nonce map to the 64-bit counter and nonce of the engine
+TEST(UTDistrGen, ChaCha20_test_vector) {
+	const uint32_t key[8] = { 0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c,
+			0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c };
+	const uint64_t expected[8] = { 0x15593bd1e4e7f110ULL, 0xc47120a31fdd0f50ULL,
+			0x0368c033c7f4d1c7ULL, 0x4e6cd4c39aaa2204ULL, 0x09aa9f07466482d2ULL,
+			0xa2028bd905d7c214ULL, 0xb94e16ded19c12b5ULL, 0x4e3c50a2e883d0cbULL };
+
+	bool saved = ChaCha20Engine::GetAVX2();
+	for (int avx2 = 0; avx2 < 2; avx2++) {
+		ChaCha20Engine::SetAVX2(avx2 == 1);
+		ChaCha20Engine engine(key, 1 | ((uint64_t)0x09000000 << 32), 0x4a000000);
+		uint64_t block[8];
+		engine.Fill(block, 8);
+		for (usint i = 0; i < 8; i++)
+			EXPECT_EQ(expected[i], block[i]) << "word " << i << " avx2 " << avx2;
+	}
+	ChaCha20Engine::SetAVX2(saved);
+}
+
+// the stream does not depend on how it is split between calls, nor on the implementation
+TEST(UTDistrGen, ChaCha20_bulk_fill) {
+	const uint32_t key[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	const size_t total = 1000;
+
+	bool saved = ChaCha20Engine::GetAVX2();
+	ChaCha20Engine::SetAVX2(false);
+	std::vector<uint64_t> reference(total);
+	ChaCha20Engine(key).Fill(reference.data(), total);
+	ChaCha20Engine::SetAVX2(true);
+
+	ChaCha20Engine engine(key);
+	std::vector<uint64_t> pieces(total);
+	size_t sizes[] = { 1, 7, 64, 3, 129, 0, 500 };
+	size_t done = 0;
+	for (size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+		engine.Fill(pieces.data() + done, sizes[s]);
+		done += sizes[s];
+	}
+	engine.Fill(pieces.data() + done, total - done);
+	EXPECT_EQ(reference, pieces);
+
+	// 32-bit draws come from the same stream
+	ChaCha20Engine words(key);
+	for (size_t i = 0; i < 100; i++)
+		EXPECT_EQ(reference[i], words.Next64()) << "word " << i;
+
+	ChaCha20Engine::SetAVX2(saved);
+}
+
+// bulk uniform sampling keeps, in order, the stream words below the modulus after masking
+TEST(UTDistrGen, ChaCha20_fill_uniform) {
+	const uint32_t key[8] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+	const size_t total = 1003;
+	const uint64_t moduli[] = { 1, 3, (uint64_t)1 << 20, ((uint64_t)1 << 40) + 15,
+			1152921504606748673ULL, 18446744073709551557ULL };
+
+	bool saved = ChaCha20Engine::GetAVX2();
+	ChaCha20Engine::SetAVX2(false);
+	for (size_t m = 0; m < sizeof(moduli)/sizeof(moduli[0]); m++) {
+		uint64_t q = moduli[m];
+		uint64_t mask = 1;
+		while (mask < q - 1)
+			mask = (mask << 1) | 1;
+		if (q == 1)
+			mask = 0;
+
+		std::vector<uint64_t> reference;
+		ChaCha20Engine stream(key);
+		while (reference.size() < total) {
+			uint64_t w = stream.Next64() & mask;
+			if (w < q)
+				reference.push_back(w);
+		}
+
+		for (int avx2 = 0; avx2 < 2; avx2++) {
+			ChaCha20Engine::SetAVX2(avx2 != 0);
+			std::vector<uint64_t> out(total);
+			ChaCha20Engine(key).FillUniform(out.data(), total, q);
+			EXPECT_EQ(reference, out) << "modulus " << q << ", avx2 " << avx2;
+		}
+		ChaCha20Engine::SetAVX2(false);
+	}
+	ChaCha20Engine::SetAVX2(saved);
+
+	std::vector<uint64_t> out(1);
+	EXPECT_THROW(ChaCha20Engine(key).FillUniform(out.data(), 1, 0), std::logic_error);
+}
+
+// samples lie in [-eta,eta] with mean 0 and variance eta/2
+TEST(UTDistrGen, CenteredBinomialGenerator) {
+	const usint size = 1 << 18;
+	const usint etas[] = { 1, 3, 20, 21, 32 };
+
+	for (size_t e = 0; e < sizeof(etas)/sizeof(etas[0]); e++) {
+		usint eta = etas[e];
+		CenteredBinomialGeneratorImpl<NativeVector> cbg(eta);
+		EXPECT_EQ(eta, cbg.GetEta());
+
+		std::shared_ptr<int32_t> values = cbg.GenerateIntVector(size);
+		double sum = 0, squares = 0;
+		int32_t largest = 0;
+		for (usint i = 0; i < size; i++) {
+			int32_t x = (values.get())[i];
+			sum += x;
+			squares += (double)x * x;
+			largest = std::max(largest, std::abs(x));
+		}
+		double mean = sum / size;
+		double variance = squares / size - mean * mean;
+		EXPECT_LE(std::abs(mean), 0.05) << "eta " << eta;
+		EXPECT_NEAR(eta / 2.0, variance, 0.03 * eta) << "eta " << eta;
+		EXPECT_LE(largest, (int32_t)eta) << "eta " << eta;
+
+		NativeInteger modulus("1152921504606748673");
+		NativeVector v = cbg.GenerateVector(16, modulus);
+		EXPECT_EQ(modulus, v.GetModulus());
+		for (usint i = 0; i < v.GetLength(); i++)
+			EXPECT_TRUE(v[i] <= NativeInteger(eta) || v[i] >= modulus - NativeInteger(eta)) << "eta " << eta;
+	}
+
+	EXPECT_EQ(20U, CenteredBinomialGeneratorImpl<NativeVector>::EtaForStd(3.2));
+	EXPECT_EQ(CBD_MAX_ETA, CenteredBinomialGeneratorImpl<NativeVector>::EtaForStd(4));
+	// the distribution cannot have the variance of a wider Gaussian
+	EXPECT_THROW(CenteredBinomialGeneratorImpl<NativeVector>::EtaForStd(4.1), config_error);
+	EXPECT_THROW(CenteredBinomialGeneratorImpl<NativeVector>(0), std::logic_error);
+	EXPECT_THROW(CenteredBinomialGeneratorImpl<NativeVector>(CBD_MAX_ETA + 1), std::logic_error);
+}
+
+// ternary and binary vectors are cut from random words; each value has the right frequency
+TEST(UTDistrGen, TernaryAndBinaryUniformGenerator) {
+	const usint size = (1 << 18) + 13;
+
+	TernaryUniformGeneratorImpl<NativeVector> tug;
+	std::shared_ptr<int32_t> ternary = tug.GenerateIntVector(size);
+	usint counts[3] = { 0, 0, 0 };
+	for (usint i = 0; i < size; i++) {
+		int32_t x = (ternary.get())[i];
+		ASSERT_TRUE(x >= -1 && x <= 1) << "index " << i;
+		counts[x + 1]++;
+	}
+	for (usint k = 0; k < 3; k++)
+		EXPECT_NEAR(1.0/3, (double)counts[k] / size, 0.01) << "value " << (int)k - 1;
+
+	BinaryUniformGeneratorImpl<NativeVector> bug;
+	std::shared_ptr<int32_t> binary = bug.GenerateIntVector(size);
+	usint ones = 0;
+	for (usint i = 0; i < size; i++) {
+		int32_t x = (binary.get())[i];
+		ASSERT_TRUE(x == 0 || x == 1) << "index " << i;
+		ones += x;
+	}
+	EXPECT_NEAR(0.5, (double)ones / size, 0.01);
+
+	NativeInteger modulus("1152921504606748673");
+	NativeVector t = tug.GenerateVector(size, modulus);
+	NativeVector b = bug.GenerateVector(size, modulus);
+	EXPECT_EQ(modulus, t.GetModulus());
+	EXPECT_EQ(modulus, b.GetModulus());
+	for (usint i = 0; i < size; i++) {
+		EXPECT_TRUE(t[i] <= NativeInteger(1) || t[i] == modulus - NativeInteger(1));
+		EXPECT_TRUE(b[i] <= NativeInteger(1));
+	}
+}
+
+// seeds derived from the same seed and index are equal, and independent otherwise
+TEST(UTDistrGen, ChaCha20_derive_seed) {
+	const PRNGSeed seed = {{ 1, 2, 3, 4, 5, 6, 7, 8 }};
+
+	EXPECT_EQ(ChaCha20Engine::DeriveSeed(seed, 5), ChaCha20Engine::DeriveSeed(seed, 5));
+	EXPECT_NE(ChaCha20Engine::DeriveSeed(seed, 5), ChaCha20Engine::DeriveSeed(seed, 6));
+	EXPECT_NE(seed, ChaCha20Engine::DeriveSeed(seed, 0));
+
+	// the engine built from a seed expands the same stream as the one built from the raw key
+	ChaCha20Engine e1(seed, 3);
+	ChaCha20Engine e2(seed.data(), 0, 3);
+	std::vector<uint64_t> w1(100), w2(100);
+	e1.Fill(w1.data(), w1.size());
+	e2.Fill(w2.data(), w2.size());
+	EXPECT_EQ(w1, w2);
+}
+
+// the table-based sampler follows the discrete Gaussian and does not depend on the instruction set
+TEST(UTDistrGen, DiscreteGaussianCDT) {
+	const uint32_t key[8] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+	const double std = 3.2;
+	const size_t count = 1 << 20;
+
+	DiscreteGaussianCDT cdt(std);
+	EXPECT_EQ(std, cdt.GetStd());
+	EXPECT_GE(cdt.GetBound(), (int32_t)(9 * std));
+
+	bool saved = DiscreteGaussianCDT::GetAVX2();
+	DiscreteGaussianCDT::SetAVX2(false);
+	std::vector<int32_t> portable(count + 7);
+	ChaCha20Engine g1(key);
+	cdt.Generate(portable.data(), portable.size(), g1);
+	DiscreteGaussianCDT::SetAVX2(true);
+	std::vector<int32_t> vectorized(count + 7);
+	ChaCha20Engine g2(key);
+	cdt.Generate(vectorized.data(), vectorized.size(), g2);
+	DiscreteGaussianCDT::SetAVX2(saved);
+	EXPECT_EQ(portable, vectorized);
+
+	double sum = 0, squares = 0;
+	size_t zeros = 0;
+	int32_t largest = 0;
+	for (size_t i = 0; i < count; i++) {
+		int32_t x = portable[i];
+		sum += x;
+		squares += (double)x * x;
+		zeros += (x == 0);
+		largest = std::max(largest, std::abs(x));
+	}
+	double mean = sum / count;
+	double variance = squares / count - mean * mean;
+
+	double norm = 1;
+	for (int k = 1; k < 60; k++)
+		norm += 2 * exp(-k * k / (2 * std * std));
+
+	EXPECT_LE(std::abs(mean), 0.02) << "mean";
+	EXPECT_NEAR(std * std, variance, 0.1) << "variance";
+	EXPECT_NEAR(1 / norm, (double)zeros / count, 0.002) << "probability of 0";
+	EXPECT_LE(largest, cdt.GetBound());
+
+	EXPECT_THROW(DiscreteGaussianCDT(CDT_MAX_STD * 2), std::logic_error);
+	std::vector<int32_t> out(1);
+	EXPECT_THROW(DiscreteGaussianCDT().Generate(out.data(), 1, g1), std::logic_error);
+}
+
+// the engine of each thread follows the selected type
+TEST(UTDistrGen, PRNG_engine_type) {
+	PRNGEngineType saved = PseudoRandomNumberGenerator::GetEngineType();
+
+	PseudoRandomNumberGenerator::SetEngineType(PRNG_MT19937);
+	EXPECT_EQ(PRNG_MT19937, PseudoRandomNumberGenerator::GetPRNG().GetType());
+	PseudoRandomNumberGenerator::SetEngineType(PRNG_CHACHA20);
+	EXPECT_EQ(PRNG_CHACHA20, PseudoRandomNumberGenerator::GetPRNG().GetType());
+
+	// different threads get differently keyed engines
+	std::vector<uint64_t> first(4);
+#pragma omp parallel for num_threads(4)
+	for (int t = 0; t < 4; t++)
+		PseudoRandomNumberGenerator::GetPRNG().Fill(&first[t], 1);
+	for (int t = 1; t < 4; t++)
+		EXPECT_NE(first[0], first[t]);
+
+	PseudoRandomNumberGenerator::SetEngineType(saved);
+}
@@ -39,6 +39,7 @@ Test cases in this file make the following assumptions:
 #include "lattice/backend.h"
 #include "math/nbtheory.h"
 #include "math/distrgen.h"
+#include "math/native_int/nttkernels.h"
 #include "utils/inttypes.h"
 #include "utils/utilities.h"
 
@@ -309,3 +310,271 @@ void decomposeMult_single_crt(const string& msg) {
 TEST(UTNTT, decomposeMult_single_crt) {
 	RUN_ALL_POLYS(decomposeMult_single_crt, "decomposeMult_single_crt")
 }
+
+// checks every native NTT kernel supported by the CPU against a direct evaluation of the transform
+TEST(UTNTT, native_kernels_single_crt) {
+	usint m = 128;
+	usint n = m / 2;
+	usint bits[] = { 30, 50, 60, 62 };	// modulus sizes; FirstPrime(b-1) returns a b-bit prime
+
+	native_int::NTTKernelISA savedISA = native_int::NTTKernels::GetISA();
+
+	for (usint b : bits) {
+		NativeInteger modulus = FirstPrime<NativeInteger>(b - 1, m);
+		NativeInteger rootOfUnity(RootOfUnity(m, modulus));
+
+		DiscreteUniformGeneratorImpl<NativeVector> dug;
+		dug.SetModulus(modulus);
+		NativeVector x = dug.GenerateVector(n);
+
+		// slot k of the evaluation representation is x(psi^(2k+1))
+		NativeVector expected(n, modulus);
+		for (usint k = 0; k < n; k++) {
+			NativeInteger point = rootOfUnity.ModExp(NativeInteger(2 * k + 1), modulus);
+			NativeInteger power(1);
+			NativeInteger sum(0);
+			for (usint i = 0; i < n; i++) {
+				sum = sum.ModAdd(x[i].ModMul(power, modulus), modulus);
+				power = power.ModMul(point, modulus);
+			}
+			expected[k] = sum;
+		}
+
+		for (int isa = native_int::NTT_KERNEL_SCALAR; isa <= native_int::NTTKernels::GetSupportedISA(); isa++) {
+			native_int::NTTKernels::SetISA((native_int::NTTKernelISA)isa);
+			string msg = native_int::NTTKernels::GetISAName((native_int::NTTKernelISA)isa) + " " + std::to_string(b) + " bits";
+
+			NativeVector X(n, modulus);
+			ChineseRemainderTransformFTT<NativeVector>::ForwardTransform(x, rootOfUnity, m, &X);
+			EXPECT_EQ(expected, X) << msg;
+
+			NativeVector y(n, modulus);
+			ChineseRemainderTransformFTT<NativeVector>::InverseTransform(X, rootOfUnity, m, &y);
+			EXPECT_EQ(x, y) << msg;
+		}
+	}
+
+	native_int::NTTKernels::SetISA(savedISA);
+}
+
+// compares the lazy-reduction NTT with the existing fully-reducing transform, including
+// ring dimensions smaller than the one the twiddle tables were built for
+TEST(UTNTT, lazy_ntt_vs_existing_transform) {
+	usint mTable = 2048;
+	usint bits[] = { 28, 40, 50, 59, 60, 61, 62 };	// modulus sizes; FirstPrime(b-1) returns a b-bit prime
+	usint dims[] = { 2, 8, 64, 1024 };
+
+	for (usint b : bits) {
+		NativeInteger modulus = FirstPrime<NativeInteger>(b - 1, mTable);
+		NativeInteger rootOfUnity(RootOfUnity(mTable, modulus));
+		auto tables = ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity, mTable, modulus);
+
+		const NativeVector &rootTable = tables->GetRootOfUnityTable();
+		const NativeVector &preconTable = tables->GetRootOfUnityPreconTable();
+		const NativeVector &stageTable = tables->GetStageTable();
+		const NativeVector &preconStageTable = tables->GetPreconStageTable();
+
+		DiscreteUniformGeneratorImpl<NativeVector> dug;
+		dug.SetModulus(modulus);
+
+		for (usint n : dims) {
+			string msg = std::to_string(b) + " bits, n = " + std::to_string(n);
+
+			// random coefficients and the largest possible ones
+			NativeVector largest(n, modulus);
+			for (usint i = 0; i < n; i++)
+				largest[i] = modulus - NativeInteger(1);
+			NativeVector inputs[] = { dug.GenerateVector(n), largest };
+
+			for (const NativeVector &x : inputs) {
+				NativeVector expected(n, modulus);
+				NumberTheoreticTransform<NativeVector>::ForwardTransformIterative(x, rootTable, preconTable, n, &expected);
+
+				NativeVector result(n, modulus);
+				NumberTheoreticTransform<NativeVector>::ForwardTransformIterativeSIMD(x, stageTable, preconStageTable, n, &result);
+				EXPECT_EQ(expected, result) << msg;
+
+				NativeVector inPlace(x);
+				NumberTheoreticTransform<NativeVector>::ForwardTransformIterativeSIMD(inPlace, stageTable, preconStageTable, n, &inPlace);
+				EXPECT_EQ(expected, inPlace) << msg << " (in place)";
+			}
+		}
+	}
+}
+
+// the negacyclic twist and the inverse scaling are fused into the kernels; checks every
+// instruction set against direct evaluation, including ring dimensions below the vector width
+// and transforms that overwrite their input
+TEST(UTNTT, fused_negacyclic_ntt) {
+	usint orders[] = { 4, 16, 32, 64, 2048 };
+	usint bits[] = { 30, 50, 62 };	// modulus sizes; FirstPrime(b-1) returns a b-bit prime
+
+	native_int::NTTKernelISA savedISA = native_int::NTTKernels::GetISA();
+
+	for (usint m : orders) {
+		usint n = m / 2;
+		for (usint b : bits) {
+			NativeInteger modulus = FirstPrime<NativeInteger>(b - 1, m);
+			NativeInteger rootOfUnity(RootOfUnity(m, modulus));
+			auto tables = ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity, m, modulus);
+			EXPECT_TRUE(tables->HasStageTables());
+
+			DiscreteUniformGeneratorImpl<NativeVector> dug;
+			dug.SetModulus(modulus);
+			NativeVector x = dug.GenerateVector(n);
+
+			NativeVector expected(n, modulus);
+			for (usint k = 0; k < n; k++) {
+				NativeInteger point = rootOfUnity.ModExp(NativeInteger(2 * k + 1), modulus);
+				NativeInteger power(1);
+				NativeInteger sum(0);
+				for (usint i = 0; i < n; i++) {
+					sum = sum.ModAdd(x[i].ModMul(power, modulus), modulus);
+					power = power.ModMul(point, modulus);
+				}
+				expected[k] = sum;
+			}
+
+			for (int isa = native_int::NTT_KERNEL_SCALAR; isa <= native_int::NTTKernels::GetSupportedISA(); isa++) {
+				native_int::NTTKernels::SetISA((native_int::NTTKernelISA)isa);
+				string msg = native_int::NTTKernels::GetISAName((native_int::NTTKernelISA)isa) + " " + std::to_string(b) +
+						" bits, n = " + std::to_string(n);
+
+				NativeVector X(n, modulus);
+				ChineseRemainderTransformFTT<NativeVector>::ForwardTransform(x, *tables, &X);
+				EXPECT_EQ(expected, X) << msg;
+
+				NativeVector y(n, modulus);
+				ChineseRemainderTransformFTT<NativeVector>::InverseTransform(X, *tables, &y);
+				EXPECT_EQ(x, y) << msg;
+
+				NativeVector inPlace(x);
+				ChineseRemainderTransformFTT<NativeVector>::ForwardTransform(inPlace, *tables, &inPlace);
+				EXPECT_EQ(expected, inPlace) << msg << " (in place)";
+				ChineseRemainderTransformFTT<NativeVector>::InverseTransform(inPlace, *tables, &inPlace);
+				EXPECT_EQ(x, inPlace) << msg << " (in place)";
+			}
+		}
+	}
+
+	native_int::NTTKernels::SetISA(savedISA);
+}
+
+// ring dimensions 2^10 to 2^17 run kernels specialized at compile time; checks them, and the
+// run-time kernels just outside that range, against the existing transform for every instruction set
+TEST(UTNTT, fixed_dimension_kernels) {
+	native_int::NTTKernelISA savedISA = native_int::NTTKernels::GetISA();
+
+	for (usint logn = 9; logn <= 18; logn++) {
+		usint n = 1 << logn;
+		usint m = 2 * n;
+		NativeInteger modulus = FirstPrime<NativeInteger>(59, m);
+		NativeInteger rootOfUnity(RootOfUnity(m, modulus));
+		auto tables = ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity, m, modulus);
+
+		DiscreteUniformGeneratorImpl<NativeVector> dug;
+		dug.SetModulus(modulus);
+		NativeVector x = dug.GenerateVector(n);
+
+		NativeVector expected(n, modulus);
+		NumberTheoreticTransform<NativeVector>::ForwardTransformIterative(x, tables->GetRootOfUnityTable(),
+				tables->GetRootOfUnityPreconTable(), n, &expected);
+
+		for (int isa = native_int::NTT_KERNEL_SCALAR; isa <= native_int::NTTKernels::GetSupportedISA(); isa++) {
+			native_int::NTTKernels::SetISA((native_int::NTTKernelISA)isa);
+			string msg = native_int::NTTKernels::GetISAName((native_int::NTTKernelISA)isa) + " n = " + std::to_string(n);
+
+			NativeVector result(n, modulus);
+			NumberTheoreticTransform<NativeVector>::ForwardTransformIterativeSIMD(x, tables->GetStageTable(),
+					tables->GetPreconStageTable(), n, &result);
+			EXPECT_EQ(expected, result) << msg;
+
+			NativeVector y(x);
+			ChineseRemainderTransformFTT<NativeVector>::ForwardTransformInPlace(&y, *tables);
+			ChineseRemainderTransformFTT<NativeVector>::InverseTransformInPlace(&y, *tables);
+			EXPECT_EQ(x, y) << msg;
+		}
+	}
+
+	native_int::NTTKernels::SetISA(savedISA);
+}
+
+// the in-place transforms must agree with the out-of-place ones, on both the fused native kernels
+// and the generic paths (moduli too large for the kernels, multiprecision integers)
+template<typename VecType>
+void in_place_transform(usint m, const typename VecType::Integer &modulus, const string &msg) {
+	typedef typename VecType::Integer IntType;
+	usint n = m / 2;
+	IntType rootOfUnity(RootOfUnity<IntType>(m, modulus));
+
+	DiscreteUniformGeneratorImpl<VecType> dug;
+	dug.SetModulus(modulus);
+	VecType x = dug.GenerateVector(n);
+
+	VecType expected(n, modulus);
+	ChineseRemainderTransformFTT<VecType>::ForwardTransform(x, rootOfUnity, m, &expected);
+
+	VecType y(x);
+	ChineseRemainderTransformFTT<VecType>::ForwardTransformInPlace(&y, rootOfUnity, m);
+	EXPECT_EQ(expected, y) << msg;
+	ChineseRemainderTransformFTT<VecType>::InverseTransformInPlace(&y, rootOfUnity, m);
+	EXPECT_EQ(x, y) << msg;
+
+	auto tables = ChineseRemainderTransformFTT<VecType>::GetNTTTables(rootOfUnity, m, modulus);
+	ChineseRemainderTransformFTT<VecType>::ForwardTransformInPlace(&y, *tables);
+	EXPECT_EQ(expected, y) << msg << " (tables)";
+	ChineseRemainderTransformFTT<VecType>::InverseTransformInPlace(&y, *tables);
+	EXPECT_EQ(x, y) << msg << " (tables)";
+}
+
+TEST(UTNTT, in_place_transform) {
+	usint m = 256;
+	in_place_transform<NativeVector>(m, FirstPrime<NativeInteger>(39, m), "native, 40 bits");
+	in_place_transform<NativeVector>(m, FirstPrime<NativeInteger>(62, m), "native, 63 bits");
+	in_place_transform<BigVector>(m, FirstPrime<BigInteger>(100, m), "BigVector, 101 bits");
+}
+
+// the twiddle tables are shared per (modulus, root of unity, cyclotomic order) and outlive a registry reset
+TEST(UTNTT, ntt_tables_registry) {
+	usint m = 64;
+	NativeInteger modulus = FirstPrime<NativeInteger>(40, m);
+	NativeInteger rootOfUnity(RootOfUnity(m, modulus));
+
+	auto tables = ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity, m, modulus);
+	EXPECT_EQ(tables, ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity, m, modulus));
+	EXPECT_NE(tables, ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity.ModMul(rootOfUnity, modulus), m / 2, modulus));
+
+	shared_ptr<ILNativeParams> params( new ILNativeParams(m, modulus, rootOfUnity) );
+	EXPECT_EQ(tables.get(), &params->GetNTTTables());
+
+	// tables are looked up concurrently while new ones are being added and the registry is reset
+	std::vector<NativeInteger> moduli;
+	std::vector<NativeInteger> roots;
+	NativeInteger q = modulus;
+	for (usint i = 0; i < 16; i++) {
+		q = NextPrime(q, m);
+		moduli.push_back(q);
+		roots.push_back(RootOfUnity(m, q));
+	}
+	bool allFound = true;
+#pragma omp parallel for reduction(&&:allFound)
+	for (usint i = 0; i < 64; i++) {
+		NativeInteger qi = moduli[i % moduli.size()];
+		auto t = ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(roots[i % roots.size()], m, qi);
+		allFound = allFound && t->GetModulus() == qi && t->GetRootOfUnityTable().GetLength() == m / 2;
+		if (i % 16 == 15)
+			ChineseRemainderTransformFTT<NativeVector>::Reset();
+	}
+	EXPECT_TRUE(allFound);
+
+	ChineseRemainderTransformFTT<NativeVector>::Reset();
+	EXPECT_EQ(modulus, params->GetNTTTables().GetModulus());
+	EXPECT_NE(tables, ChineseRemainderTransformFTT<NativeVector>::GetNTTTables(rootOfUnity, m, modulus));
+
+	NativePoly x(params, Format::COEFFICIENT);
+	x = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	NativePoly xClone(x);
+	x.SwitchFormat();
+	x.SwitchFormat();
+	EXPECT_EQ(xClone, x);
+}
@@ -198,6 +198,101 @@ TEST(UTSer,ildcrtpoly_test) {
 	RUN_BIG_DCRTPOLYS(ildcrtpoly_test, "ildcrtpoly_test")
 }
 
+TEST(UTSer,binary_packing) {
+	const usint bits[] = { 1, 7, 20, 33, 60, 64 };
+	std::vector<std::vector<uint64_t>> values;
+
+	BinaryWriter writer(BINARY_CIPHERTEXT);
+	writer.WriteString("tag");
+	for( usint b : bits ) {
+		std::vector<uint64_t> v(101);
+		for( size_t i = 0; i < v.size(); i++ )
+			v[i] = (i * 0x9E3779B97F4A7C15ULL) >> (64 - b);
+		writer.WritePacked(v.data(), v.size(), b);
+		writer.WriteU8(0xA5);
+		values.push_back(v);
+	}
+	EXPECT_THROW( writer.WritePacked(values[2].data(), values[2].size(), 1), serialize_error ) << "Overflow not detected";
+
+	std::stringstream ss;
+	writer.WriteTo(ss);
+	EXPECT_EQ( writer.GetSize(), ss.str().size() ) << "Size mismatch";
+
+	BinaryReader reader(ss, BINARY_CIPHERTEXT);
+	EXPECT_EQ( "tag", reader.ReadString() ) << "String mismatch";
+	for( size_t k = 0; k < values.size(); k++ ) {
+		std::vector<uint64_t> v(values[k].size());
+		reader.ReadPacked(v.data(), v.size(), bits[k]);
+		EXPECT_EQ( values[k], v ) << "Packed values mismatch for " << bits[k] << " bits";
+		EXPECT_EQ( 0xA5, reader.ReadU8() ) << "Packed array not padded to a byte";
+	}
+	EXPECT_TRUE( reader.AtEnd() ) << "Unread payload";
+	EXPECT_THROW( reader.ReadU8(), deserialize_error ) << "Read past the end not detected";
+
+	string s = ss.str();
+	EXPECT_THROW( BinaryReader(s.data(), s.size(), BINARY_PUBLIC_KEY), deserialize_error ) << "Wrong type not detected";
+	EXPECT_THROW( BinaryReader(s.data(), s.size() - 1, BINARY_CIPHERTEXT), deserialize_error ) << "Truncation not detected";
+	s[0] = 'X';
+	EXPECT_THROW( BinaryReader(s.data(), s.size(), BINARY_CIPHERTEXT), deserialize_error ) << "Bad magic not detected";
+}
+
+template<typename Element>
+void ilvector_binary_test(const string& msg) {
+	auto p = ElemParamFactory::GenElemParams<typename Element::Params>(1024);
+	typename Element::DugType dug;
+	Element vec(dug, p, COEFFICIENT);
+
+	BinaryWriter writer(BINARY_CIPHERTEXT);
+	vec.SerializeBinary(writer);
+	std::stringstream ss;
+	writer.WriteTo(ss);
+
+	// exactly ceil(log2 q) bits per value
+	size_t n = p->GetRingDimension();
+	size_t bits = (p->GetModulus() - typename Element::Integer(1)).GetMSB();
+	EXPECT_GE( ss.str().size(), (n*bits + 7)/8 ) << msg << " Values not written";
+	EXPECT_LE( ss.str().size(), (n*bits + 7)/8 + 256 ) << msg << " Values not packed";
+
+	BinaryReader reader(ss, BINARY_CIPHERTEXT);
+	Element newvec;
+	newvec.DeserializeBinary(reader);
+	EXPECT_TRUE( reader.AtEnd() ) << msg << " Unread payload";
+
+	EXPECT_EQ( vec, newvec ) << msg << " Mismatch after binary ser/deser";
+}
+
+TEST(UTSer,ilvector_binary_test) {
+	RUN_ALL_POLYS(ilvector_binary_test, "ilvector_binary_test")
+}
+
+template<typename Element>
+void ildcrtpoly_binary_test(const string& msg) {
+	auto p = GenerateDCRTParams<typename Element::Integer>(1024, 5, 30);
+	typename Element::DugType dug;
+	Element vec(dug, p);
+
+	BinaryWriter writer(BINARY_CIPHERTEXT);
+	vec.SerializeBinary(writer);
+	std::stringstream ss;
+	writer.WriteTo(ss);
+
+	size_t bits = 0;
+	for( auto &tower : p->GetParams() )
+		bits += (tower->GetModulus() - NativeInteger(1)).GetMSB();
+	EXPECT_LE( ss.str().size(), (p->GetRingDimension()*bits)/8 + 256 ) << msg << " Values not packed";
+
+	BinaryReader reader(ss, BINARY_CIPHERTEXT);
+	Element newvec;
+	newvec.DeserializeBinary(reader);
+
+	EXPECT_EQ( vec, newvec ) << msg << " Mismatch after binary ser/deser";
+	EXPECT_EQ( *vec.GetParams(), *newvec.GetParams() ) << msg << " Parameters mismatch after binary ser/deser";
+}
+
+TEST(UTSer,ildcrtpoly_binary_test) {
+	RUN_BIG_DCRTPOLYS(ildcrtpoly_binary_test, "ildcrtpoly_binary_test")
+}
+
 template<typename V>
 void serialize_vector_bigint(const string& msg) {
   //Serialize/DeserializeVector is a helper function to test
@@ -405,12 +405,13 @@ LPKeyPair<Element> LPAlgorithmBFV<Element>::KeyGen(CryptoContext<Element> cc, bo
 
 	const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 
-	const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
-	typename Element::DugType dug;
 	typename Element::TugType tug;
 
-	//Generate the element "a" of the public key
-	Element a(dug, elementParams, Format::EVALUATION);
+	//Generate the element "a" of the public key, expanded from a seed if seeded uniform components are enabled
+	PRNGSeed seed{};
+	if (cryptoParams->GetSeededUniform())
+		seed = UniformSeed::Generate();
+	Element a(cryptoParams->SampleUniform(elementParams, seed, 0));
 
 	//Generate the secret key
 	Element s;
@@ -418,7 +419,7 @@ LPKeyPair<Element> LPAlgorithmBFV<Element>::KeyGen(CryptoContext<Element> cc, bo
 	//Done in two steps not to use a random polynomial from a pre-computed pool
 	//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 	if (cryptoParams->GetMode() == RLWE) {
-		s = Element(dgg, elementParams, Format::COEFFICIENT);
+		s = cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT);
 		s.SwitchFormat();
 	}
 	else {
@@ -429,7 +430,7 @@ LPKeyPair<Element> LPAlgorithmBFV<Element>::KeyGen(CryptoContext<Element> cc, bo
 	kp.secretKey->SetPrivateElement(s);
 
 	//Done in two steps not to use a discrete Gaussian polynomial from a pre-computed pool
-	Element e(dgg, elementParams, Format::COEFFICIENT);
+	Element e(cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT));
 	e.SwitchFormat();
 
 	Element b(elementParams, Format::EVALUATION, true);
@@ -438,6 +439,8 @@ LPKeyPair<Element> LPAlgorithmBFV<Element>::KeyGen(CryptoContext<Element> cc, bo
 
 	kp.publicKey->SetPublicElementAtIndex(0, std::move(b));
 	kp.publicKey->SetPublicElementAtIndex(1, std::move(a));
+	if (cryptoParams->GetSeededUniform())
+		kp.publicKey->SetUniformSeed(seed, 1);
 
 	return kp;
 }
@@ -456,7 +459,6 @@ Ciphertext<Element> LPAlgorithmBFV<Element>::Encrypt(const LPPublicKey<Element>
 
 	const typename Element::Integer &delta = cryptoParams->GetDelta();
 
-	const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 	typename Element::TugType tug;
 
 	const Element &p0 = publicKey->GetPublicElements().at(0);
@@ -466,12 +468,12 @@ Ciphertext<Element> LPAlgorithmBFV<Element>::Encrypt(const LPPublicKey<Element>
 
 	//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 	if (cryptoParams->GetMode() == RLWE)
-		u = Element(dgg, elementParams, Format::EVALUATION);
+		u = cryptoParams->SampleNoise(elementParams, Format::EVALUATION);
 	else
 		u = Element(tug, elementParams, Format::EVALUATION);
 
-	Element e1(dgg, elementParams, Format::EVALUATION);
-	Element e2(dgg, elementParams, Format::EVALUATION);
+	Element e1(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
+	Element e2(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
 	Element c0(elementParams);
 	Element c1(elementParams);
@@ -497,19 +499,21 @@ Ciphertext<Element> LPAlgorithmBFV<Element>::Encrypt(const LPPrivateKey<Element>
 
 	ptxt.SwitchFormat();
 
-	const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
-	typename Element::DugType dug;
 	const typename Element::Integer &delta = cryptoParams->GetDelta();
 
-	Element a(dug, elementParams, Format::EVALUATION);
+	// c1 = -a is uniform itself, so it is the element drawn (and possibly expanded from a seed)
+	PRNGSeed seed{};
+	if (cryptoParams->GetSeededUniform())
+		seed = UniformSeed::Generate();
+	Element c1(cryptoParams->SampleUniform(elementParams, seed, 0));
 	const Element &s = privateKey->GetPrivateElement();
-	Element e(dgg, elementParams, Format::EVALUATION);
+	Element e(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
-	Element c0(a*s + e + delta*ptxt);
-	Element c1(elementParams, Format::EVALUATION, true);
-	c1 -= a;
+	Element c0(e + delta*ptxt - c1*s);
 
 	ciphertext->SetElements({ c0, c1 });
+	if (cryptoParams->GetSeededUniform())
+		ciphertext->SetUniformSeed(seed, 1);
 
 	return ciphertext;
 }
@@ -553,6 +557,29 @@ DecryptResult LPAlgorithmBFV<Element>::Decrypt(const LPPrivateKey<Element> priva
 	return DecryptResult(plaintext->GetLength());
 }
 
+// Products left unrelinearized by EvalMult are in COEFFICIENT format, while fresh and relinearized
+// ciphertexts are in EVALUATION format. Returns the elements of ciphertext in the given format,
+// switching a copy of them only when needed.
+template <class Element>
+static const std::vector<Element>& ElementsInFormat(ConstCiphertext<Element> ciphertext, Format format,
+		std::vector<Element> *converted) {
+	const std::vector<Element> &elements = ciphertext->GetElements();
+	if (elements[0].GetFormat() == format)
+		return elements;
+
+	*converted = elements;
+	for (size_t i = 0; i < converted->size(); i++)
+		(*converted)[i].SwitchFormat();
+	return *converted;
+}
+
+// The format in which two ciphertexts are combined: theirs if they agree, EVALUATION otherwise
+template <class Element>
+static Format CommonFormat(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2) {
+	Format format = ciphertext1->GetElements()[0].GetFormat();
+	return format == ciphertext2->GetElements()[0].GetFormat() ? format : EVALUATION;
+}
+
 template <class Element>
 Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalAdd(ConstCiphertext<Element> ciphertext1,
 		ConstCiphertext<Element> ciphertext2) const {
@@ -564,8 +591,11 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalAdd(ConstCiphertext<Element>
 
 	Ciphertext<Element> newCiphertext = ciphertext1->CloneEmpty();
 
-	const std::vector<Element> &cipherText1Elements = ciphertext1->GetElements();
-	const std::vector<Element> &cipherText2Elements = ciphertext2->GetElements();
+	// the ciphertexts may have different numbers of elements, and then also different formats
+	Format format = CommonFormat(ciphertext1, ciphertext2);
+	std::vector<Element> converted1, converted2;
+	const std::vector<Element> &cipherText1Elements = ElementsInFormat(ciphertext1, format, &converted1);
+	const std::vector<Element> &cipherText2Elements = ElementsInFormat(ciphertext2, format, &converted2);
 
 	size_t cipherTextRElementsSize;
 	size_t cipherTextSmallElementsSize;
@@ -596,7 +626,7 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalAdd(ConstCiphertext<Element>
 			c[i] = cipherText1Elements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -624,7 +654,7 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalAdd(ConstCiphertext<Element>
 			c[i] = cipherTextElements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -641,8 +671,11 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalSub(ConstCiphertext<Element>
 
 	Ciphertext<Element> newCiphertext = ciphertext1->CloneEmpty();
 
-	const std::vector<Element> &cipherText1Elements = ciphertext1->GetElements();
-	const std::vector<Element> &cipherText2Elements = ciphertext2->GetElements();
+	// the ciphertexts may have different numbers of elements, and then also different formats
+	Format format = CommonFormat(ciphertext1, ciphertext2);
+	std::vector<Element> converted1, converted2;
+	const std::vector<Element> &cipherText1Elements = ElementsInFormat(ciphertext1, format, &converted1);
+	const std::vector<Element> &cipherText2Elements = ElementsInFormat(ciphertext2, format, &converted2);
 
 	size_t cipherTextRElementsSize;
 	size_t cipherTextSmallElementsSize;
@@ -668,12 +701,12 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalSub(ConstCiphertext<Element>
 
 	for(size_t i=cipherTextSmallElementsSize; i<cipherTextRElementsSize; i++){
 		if(isCipherText1Small == true)
-			c[i] = cipherText2Elements[i];
+			c[i] = cipherText2Elements[i].Negate();
 		else
 			c[i] = cipherText1Elements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -707,7 +740,7 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalSub(ConstCiphertext<Element>
 			c[i] = cipherTextElements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -825,7 +858,7 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalMult(ConstCiphertext<Element
 	for(size_t i=0; i<cipherTextRElementsSize; i++)
 		c[i].SwitchModulus(q, elementParams->GetRootOfUnity(), elementParams->GetBigModulus(), elementParams->GetBigRootOfUnity());
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 	newCiphertext->SetDepth((ciphertext1->GetDepth() + ciphertext2->GetDepth()));
 
 	return newCiphertext;
@@ -951,23 +984,33 @@ Ciphertext<Element> LPAlgorithmSHEBFV<Element>::EvalMultAndRelinearize(ConstCiph
 	//Perform a multiplication
 	Ciphertext<Element> cipherText = this->EvalMult(ciphertext1, ciphertext2);
 
-	const shared_ptr<LPCryptoParametersBFV<Element>> cryptoParamsLWE = std::dynamic_pointer_cast<LPCryptoParametersBFV<Element>>(ek[0]->GetCryptoParameters());
-	usint relinWindow = cryptoParamsLWE->GetRelinWindow();
+	return this->Relinearize(cipherText, ek);
+}
 
-	Ciphertext<Element> newCiphertext = cipherText->CloneEmpty();
+template <class Element>
+Ciphertext<Element> LPAlgorithmSHEBFV<Element>::Relinearize(ConstCiphertext<Element> cipherText,
+	const vector<LPEvalKey<Element>> &ek) const {
 
 	std::vector<Element> c = cipherText->GetElements();
 
+	if (ek.size() + 2 < c.size()) {
+		std::string errMsg = "LPAlgorithmSHEBFV::Relinearize not enough evaluation keys for the number of ciphertext elements";
+		throw std::runtime_error(errMsg);
+	}
+
+	const shared_ptr<LPCryptoParametersBFV<Element>> cryptoParamsLWE = std::dynamic_pointer_cast<LPCryptoParametersBFV<Element>>(cipherText->GetCryptoParameters());
+	usint relinWindow = cryptoParamsLWE->GetRelinWindow();
+
+	Ciphertext<Element> newCiphertext = cipherText->CloneEmpty();
+
 	if(c[0].GetFormat() == Format::COEFFICIENT)
 		for(size_t i=0; i<c.size(); i++)
 			c[i].SwitchFormat();
 
 	Element ct0(c[0]);
 	Element ct1(c[1]);
-	// Perform a keyswitching operation to result of the multiplication. It does it until it reaches to 2 elements.
-	//TODO: Maybe we can change the number of keyswitching and terminate early. For instance; perform keyswitching until 4 elements left.
-	for(size_t j = 0; j<=cipherText->GetDepth()-2; j++){
-		size_t index = cipherText->GetDepth()-2-j;
+	// Perform a keyswitching operation for every element past the first two, using the key for the matching power of s.
+	for(size_t index = 0; index+2 < c.size(); index++){
 		LPEvalKeyRelin<Element> evalKey = std::static_pointer_cast<LPEvalKeyRelinImpl<Element>>(ek[index]);
 
 		const std::vector<Element> &b = evalKey->GetAVector();
@@ -996,27 +1039,30 @@ LPEvalKey<Element> LPAlgorithmSHEBFV<Element>::KeySwitchGen(const LPPrivateKey<E
 	const shared_ptr<typename Element::Params> elementParams = cryptoParamsLWE->GetElementParams();
 	const Element &s = newPrivateKey->GetPrivateElement();
 
-	const typename Element::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
-	typename Element::DugType dug;
-
 	usint relinWindow = cryptoParamsLWE->GetRelinWindow();
 
 	std::vector<Element> evalKeyElements(originalPrivateKey->GetPrivateElement().PowersOfBase(relinWindow));
 	std::vector<Element> evalKeyElementsGenerated;
 
+	PRNGSeed seed{};
+	if (cryptoParamsLWE->GetSeededUniform())
+		seed = UniformSeed::Generate();
+
 	for (usint i = 0; i < (evalKeyElements.size()); i++)
 	{
 		// Generate a_i vectors
-		Element a(dug, elementParams, Format::EVALUATION);
+		Element a(cryptoParamsLWE->SampleUniform(elementParams, seed, i));
 		evalKeyElementsGenerated.push_back(a);
 
 		// Generate a_i * s + e - PowerOfBase(s^2)
-		Element e(dgg, elementParams, Format::EVALUATION);
+		Element e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 		evalKeyElements.at(i) -= (a*s + e);
 	}
 
 	ek->SetAVector(std::move(evalKeyElements));
 	ek->SetBVector(std::move(evalKeyElementsGenerated));
+	if (cryptoParamsLWE->GetSeededUniform())
+		ek->SetUniformSeed(seed, 1);
 
 	return ek;
 
@@ -1174,7 +1220,6 @@ LPEvalKey<Element> LPAlgorithmPREBFV<Element>::ReKeyGen(const LPPublicKey<Elemen
 
 		s.SetFormat(Format::EVALUATION);
 
-		const typename Element::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
 		typename Element::TugType tug;
 
 		const Element &p0 = newPK->GetPublicElements().at(0);
@@ -1183,12 +1228,12 @@ LPEvalKey<Element> LPAlgorithmPREBFV<Element>::ReKeyGen(const LPPublicKey<Elemen
 		Element u;
 
 		if (cryptoParamsLWE->GetMode() == RLWE)
-			u = Element(dgg, elementParams, Format::EVALUATION);
+			u = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 		else
 			u = Element(tug, elementParams, Format::EVALUATION);
 
-		Element e1(dgg, elementParams, Format::EVALUATION);
-		Element e2(dgg, elementParams, Format::EVALUATION);
+		Element e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+		Element e2(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 		Element c0(elementParams);
 		Element c1(elementParams);
@@ -1251,7 +1296,6 @@ Ciphertext<Element> LPAlgorithmPREBFV<Element>::ReEncrypt(const LPEvalKey<Elemen
 			Ciphertext<Element> zeroCiphertext(new CiphertextImpl<Element>(publicKey));
 			zeroCiphertext->SetEncodingType(encType);
 
-			const typename Element::DggType &dgg = cryptoPars->GetDiscreteGaussianGenerator();
 			typename Element::TugType tug;
 			// Scaling the distribution standard deviation by K for HRA-security
 			auto stdDev = cryptoPars->GetDistributionParameter();
@@ -1263,7 +1307,7 @@ Ciphertext<Element> LPAlgorithmPREBFV<Element>::ReEncrypt(const LPEvalKey<Elemen
 			Element u;
 
 			if (cryptoPars->GetMode() == RLWE)
-				u = Element(dgg, elementParams, Format::EVALUATION);
+				u = cryptoPars->SampleNoise(elementParams, Format::EVALUATION);
 			else
 				u = Element(tug, elementParams, Format::EVALUATION);
 
@@ -1303,7 +1347,6 @@ LPKeyPair<Element> LPAlgorithmMultipartyBFV<Element>::MultipartyKeyGen(CryptoCon
 
 	const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 
-	const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 	typename Element::DugType dug;
 	typename Element::TugType tug;
 
@@ -1325,7 +1368,7 @@ LPKeyPair<Element> LPAlgorithmMultipartyBFV<Element>::MultipartyKeyGen(CryptoCon
 	kp.secretKey->SetPrivateElement(s);
 
 	//Done in two steps not to use a discrete Gaussian polynomial from a pre-computed pool
-	Element e(dgg, elementParams, Format::COEFFICIENT);
+	Element e(cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT));
 	e.SwitchFormat();
 
 	Element b(elementParams, Format::EVALUATION, true);
@@ -1350,7 +1393,6 @@ LPKeyPair<Element> LPAlgorithmMultipartyBFV<Element>::MultipartyKeyGen(CryptoCon
 
 	const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 
-	const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 	typename Element::DugType dug;
 	typename Element::TugType tug;
 
@@ -1363,7 +1405,7 @@ LPKeyPair<Element> LPAlgorithmMultipartyBFV<Element>::MultipartyKeyGen(CryptoCon
 	//Done in two steps not to use a random polynomial from a pre-computed pool
 	//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 	if (cryptoParams->GetMode() == RLWE) {
-		s = Element(dgg, elementParams, Format::COEFFICIENT);
+		s = cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT);
 		s.SwitchFormat();
 	}
 	else {
@@ -1375,7 +1417,7 @@ LPKeyPair<Element> LPAlgorithmMultipartyBFV<Element>::MultipartyKeyGen(CryptoCon
 	kp.secretKey->SetPrivateElement(s);
 
 	//Done in two steps not to use a discrete Gaussian polynomial from a pre-computed pool
-	Element e(dgg, elementParams, Format::COEFFICIENT);
+	Element e(cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT));
 	e.SwitchFormat();
 
 	Element b(elementParams, Format::EVALUATION, true);
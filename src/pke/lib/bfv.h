@@ -524,6 +524,17 @@ namespace lbcrypto {
 		virtual Ciphertext<Element> EvalMultAndRelinearize(ConstCiphertext<Element> ct1,
 			ConstCiphertext<Element> ct, const vector<LPEvalKey<Element>> &ek) const;
 
+		/**
+		* Function for relinearization of a ciphertext with more than two elements, for instance the sum
+		* of several products computed by EvalMult without an evaluation key.
+		*
+		* @param ct input ciphertext.
+		* @param ek the evaluation keys for the powers of the secret key, from s^2 on.
+		* @return new ciphertext with two elements.
+		*/
+		virtual Ciphertext<Element> Relinearize(ConstCiphertext<Element> ct,
+			const vector<LPEvalKey<Element>> &ek) const;
+
 		/**
 		* Function for homomorphic negation of ciphertexts.
 		*
@@ -549,7 +549,6 @@ Ciphertext<DCRTPoly> LPAlgorithmBFVrns<DCRTPoly>::Encrypt(const LPPublicKey<DCRT
 
 	const std::vector<NativeInteger> &deltaTable = cryptoParams->GetCRTDeltaTable();
 
-	const typename DCRTPoly::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 	typename DCRTPoly::TugType tug;
 
 	const DCRTPoly &p0 = publicKey->GetPublicElements().at(0);
@@ -559,21 +558,20 @@ Ciphertext<DCRTPoly> LPAlgorithmBFVrns<DCRTPoly>::Encrypt(const LPPublicKey<DCRT
 
 	//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 	if (cryptoParams->GetMode() == RLWE)
-		u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+		u = cryptoParams->SampleNoise(elementParams, Format::EVALUATION);
 	else
 		u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-	DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
-	DCRTPoly e2(dgg, elementParams, Format::EVALUATION);
+	DCRTPoly e1(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
+	DCRTPoly e2(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
-	DCRTPoly c0(elementParams);
-	DCRTPoly c1(elementParams);
+	std::vector<DCRTPoly> c(2);
 
-	c0 = p0*u + e1 + ptxt.Times(deltaTable);
+	c[0] = p0*u + e1 + ptxt.Times(deltaTable);
 
-	c1 = p1*u + e2;
+	c[1] = p1*u + e2;
 
-	ciphertext->SetElements({ c0, c1 });
+	ciphertext->SetElements(std::move(c));
 
 	return ciphertext;
 }
@@ -643,20 +641,22 @@ Ciphertext<DCRTPoly> LPAlgorithmBFVrns<DCRTPoly>::Encrypt(const LPPrivateKey<DCR
 
 	ptxt.SwitchFormat();
 
-	const typename DCRTPoly::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
-	typename DCRTPoly::DugType dug;
-
 	const std::vector<NativeInteger> &deltaTable = cryptoParams->GetCRTDeltaTable();
 
-	DCRTPoly a(dug, elementParams, Format::EVALUATION);
+	// c1 = -a is uniform itself, so it is the element drawn (and possibly expanded from a seed)
+	PRNGSeed seed{};
+	if (cryptoParams->GetSeededUniform())
+		seed = UniformSeed::Generate();
+	std::vector<DCRTPoly> c(2);
+	c[1] = cryptoParams->SampleUniform(elementParams, seed, 0);
 	const DCRTPoly &s = privateKey->GetPrivateElement();
-	DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+	DCRTPoly e(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
-	DCRTPoly c0(a*s + e + ptxt.Times(deltaTable));
-	DCRTPoly c1(elementParams, Format::EVALUATION, true);
-	c1 -= a;
+	c[0] = e + ptxt.Times(deltaTable) - c[1]*s;
 
-	ciphertext->SetElements({ c0, c1 });
+	ciphertext->SetElements(std::move(c));
+	if (cryptoParams->GetSeededUniform())
+		ciphertext->SetUniformSeed(seed, 1);
 
 	return ciphertext;
 }
@@ -684,7 +684,7 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalAdd(ConstCiphertext<DCR
 			c[i] = cipherTextElements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -714,7 +714,7 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalSub(ConstCiphertext<DCR
 			c[i] = cipherTextElements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -740,7 +740,8 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMult(ConstCiphertext<DC
 			throw std::runtime_error(errMsg);
 	}
 
-	//Get the ciphertext elements
+	// Get the ciphertext elements; these copies are consumed by ExpandCRTBasis below,
+	// which turns them into the expanded polynomials in place
 	std::vector<DCRTPoly> cipherText1Elements = ciphertext1->GetElements();
 	std::vector<DCRTPoly> cipherText2Elements = ciphertext2->GetElements();
 
@@ -748,24 +749,26 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMult(ConstCiphertext<DC
 	size_t cipherText2ElementsSize = cipherText2Elements.size();
 	size_t cipherTextRElementsSize = cipherText1ElementsSize + cipherText2ElementsSize - 1;
 
-	std::vector<DCRTPoly> c(cipherTextRElementsSize);
-
 	const shared_ptr<typename DCRTPoly::Params> elementParams = cryptoParamsBFVrns->GetElementParams();
 	const shared_ptr<ILDCRTParams<BigInteger>> paramsS = cryptoParamsBFVrns->GetDCRTParamsS();
 	const shared_ptr<ILDCRTParams<BigInteger>> paramsQS = cryptoParamsBFVrns->GetDCRTParamsQS();
 
 	// Expands the CRT basis to Q*S; Outputs the polynomials in EVALUATION representation
+	// The NTTs of all the towers of all the elements are run together as one batch
 
+	DCRTPoly::NTTBatch batch;
 
 	for(size_t i=0; i<cipherText1ElementsSize; i++)
 		cipherText1Elements[i].ExpandCRTBasis(paramsQS, paramsS, cryptoParamsBFVrns->GetCRTInverseTable(),
 				cryptoParamsBFVrns->GetCRTqDivqiModsiTable(), cryptoParamsBFVrns->GetCRTqModsiTable(),
-				cryptoParamsBFVrns->GetDCRTParamsSModulimu(),cryptoParamsBFVrns->GetCRTInversePreconTable());
+				cryptoParamsBFVrns->GetDCRTParamsSModulimu(),cryptoParamsBFVrns->GetCRTInversePreconTable(), &batch);
 
 	for(size_t i=0; i<cipherText2ElementsSize; i++)
 		cipherText2Elements[i].ExpandCRTBasis(paramsQS, paramsS, cryptoParamsBFVrns->GetCRTInverseTable(),
 				cryptoParamsBFVrns->GetCRTqDivqiModsiTable(), cryptoParamsBFVrns->GetCRTqModsiTable(),
-				cryptoParamsBFVrns->GetDCRTParamsSModulimu(),cryptoParamsBFVrns->GetCRTInversePreconTable());
+				cryptoParamsBFVrns->GetDCRTParamsSModulimu(),cryptoParamsBFVrns->GetCRTInversePreconTable(), &batch);
+
+	batch.Run();
 
 	// Performs the multiplication itself
 	// Karatsuba technique is currently slower so it is commented out
@@ -784,28 +787,17 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMult(ConstCiphertext<DC
 	else // if size of any of the ciphertexts > 2
 	{*/
 
-	bool *isFirstAdd = new bool[cipherTextRElementsSize];
-	std::fill_n(isFirstAdd, cipherTextRElementsSize, true);
-
-	for(size_t i=0; i<cipherText1ElementsSize; i++){
-		for(size_t j=0; j<cipherText2ElementsSize; j++){
-
-			if(isFirstAdd[i+j] == true){
-				c[i+j] = cipherText1Elements[i] * cipherText2Elements[j];
-				isFirstAdd[i+j] = false;
-			}
-			else{
-				c[i+j] += cipherText1Elements[i] * cipherText2Elements[j];
-			}
-		}
-	}
-
-	delete []isFirstAdd;
+	// c[k] is the sum of the products cipherText1Elements[i]*cipherText2Elements[j] with i+j=k;
+	// all the towers of all the c[k] are computed together, in parallel, with lazy reduction
+	std::vector<DCRTPoly> c = DCRTPoly::TensorProduct(cipherText1Elements, cipherText2Elements);
 	//};
 
+	//converts to coefficient representation before rounding
+	for(size_t i=0; i<cipherTextRElementsSize; i++)
+		batch.Add(&c[i]);
+	batch.Run();
+
 	for(size_t i=0; i<cipherTextRElementsSize; i++){
-		//converts to coefficient representation before rounding
-		c[i].SwitchFormat();
 		// Performs the scaling by p/q followed by rounding; the result is in the CRT basis S
 		c[i] = c[i].ScaleAndRound(paramsS,cryptoParamsBFVrns->GetCRTMultIntTable(),cryptoParamsBFVrns->GetCRTMultFloatTable(),
 				cryptoParamsBFVrns->GetDCRTParamsSModulimu());
@@ -815,7 +807,7 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMult(ConstCiphertext<DC
 					cryptoParamsBFVrns->GetDCRTParamsQModulimu(),cryptoParamsBFVrns->GetCRTSInversePreconTable());
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 	newCiphertext->SetDepth((ciphertext1->GetDepth() + ciphertext2->GetDepth()));
 
 	return newCiphertext;
@@ -833,14 +825,15 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::KeySwitchGen(const LPPrivate
 	const shared_ptr<typename DCRTPoly::Params> elementParams = cryptoParamsLWE->GetElementParams();
 	const DCRTPoly &s = newPrivateKey->GetPrivateElement();
 
-	const typename DCRTPoly::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
-	typename DCRTPoly::DugType dug;
-
 	const DCRTPoly &oldKey = originalPrivateKey->GetPrivateElement();
 
 	std::vector<DCRTPoly> evalKeyElements;
 	std::vector<DCRTPoly> evalKeyElementsGenerated;
 
+	PRNGSeed seed{};
+	if (cryptoParamsLWE->GetSeededUniform())
+		seed = UniformSeed::Generate();
+
 	uint32_t relinWindow = cryptoParamsLWE->GetRelinWindow();
 
 	for (usint i = 0; i < oldKey.GetNumOfElements(); i++)
@@ -859,11 +852,11 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::KeySwitchGen(const LPPrivate
 				filtered.SetElementAtIndex(i,decomposedKeyElements[k]);
 
 				// Generate a_i vectors
-				DCRTPoly a(dug, elementParams, Format::EVALUATION);
+				DCRTPoly a(cryptoParamsLWE->SampleUniform(elementParams, seed, evalKeyElementsGenerated.size()));
 				evalKeyElementsGenerated.push_back(a);
 
 				// Generate a_i * s + e - [oldKey]_qi [(q/qi)^{-1}]_qi (q/qi)
-				DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+				DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 				evalKeyElements.push_back(filtered - (a*s + e));
 			}
 		}
@@ -876,11 +869,11 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::KeySwitchGen(const LPPrivate
 			filtered.SetElementAtIndex(i,oldKey.GetElementAtIndex(i));
 
 			// Generate a_i vectors
-			DCRTPoly a(dug, elementParams, Format::EVALUATION);
+			DCRTPoly a(cryptoParamsLWE->SampleUniform(elementParams, seed, evalKeyElementsGenerated.size()));
 			evalKeyElementsGenerated.push_back(a);
 
 			// Generate a_i * s + e - [oldKey]_qi [(q/qi)^{-1}]_qi (q/qi)
-			DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+			DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 			evalKeyElements.push_back(filtered - (a*s + e));
 		}
 
@@ -888,6 +881,8 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::KeySwitchGen(const LPPrivate
 
 	ek->SetAVector(std::move(evalKeyElements));
 	ek->SetBVector(std::move(evalKeyElementsGenerated));
+	if (cryptoParamsLWE->GetSeededUniform())
+		ek->SetUniformSeed(seed, 1);
 
 	return ek;
 
@@ -915,63 +910,134 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::KeySwitch(const LPEvalKey<D
 
 	DCRTPoly ct0(c[0]);
 
-	//in the case of EvalMult, c[0] is initially in coefficient format and needs to be switched to evaluation format
-	if (c.size() > 2)
-		ct0.SwitchFormat();
-
 	DCRTPoly ct1;
 
 	if (c.size() == 2) //case of automorphism
 	{
 		digitsC2 = c[1].CRTDecompose(relinWindow);
-		ct1 = digitsC2[0] * a[0];
+		ct1 = DCRTPoly(ct0.GetParams(), Format::EVALUATION, true);
 	}
 	else //case of EvalMult
 	{
 		digitsC2 = c[2].CRTDecompose(relinWindow);
 		ct1 = c[1];
-		//Convert ct1 to evaluation representation
-		ct1.SwitchFormat();
-		ct1 += digitsC2[0] * a[0];
-
+		//in the case of EvalMult, c[0] and c[1] are initially in coefficient format and need to be
+		//switched to evaluation format
+		DCRTPoly::SwitchFormat({ &ct0, &ct1 });
 	}
 
-	ct0 += digitsC2[0] * b[0];
-
-	for (usint i = 1; i < digitsC2.size(); ++i)
+	std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsB(digitsC2.size());
+	std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsA(digitsC2.size());
+	for (usint i = 0; i < digitsC2.size(); ++i)
 	{
-		ct0 += digitsC2[i] * b[i];
-		ct1 += digitsC2[i] * a[i];
+		termsB[i] = std::make_pair(&digitsC2[i], &b[i]);
+		termsA[i] = std::make_pair(&digitsC2[i], &a[i]);
 	}
 
-	newCiphertext->SetElements({ ct0, ct1 });
+	ct0.AddInnerProductInPlace(termsB);
+	ct1.AddInnerProductInPlace(termsA);
+
+	std::vector<DCRTPoly> ct(2);
+	ct[0] = std::move(ct0);
+	ct[1] = std::move(ct1);
+	newCiphertext->SetElements(std::move(ct));
 
 	return newCiphertext;
 }
 
 template <>
-Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMultAndRelinearize(ConstCiphertext<DCRTPoly> ciphertext1,
-	ConstCiphertext<DCRTPoly> ciphertext2, const vector<LPEvalKey<DCRTPoly>> &ek) const{
+shared_ptr<vector<DCRTPoly>> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalFastRotationPrecompute(ConstCiphertext<DCRTPoly> ciphertext) const
+{
 
-	Ciphertext<DCRTPoly> cipherText = this->EvalMult(ciphertext1, ciphertext2);
+	const std::vector<DCRTPoly> &c = ciphertext->GetElements();
+
+	if (c.size() != 2) {
+		std::string errMsg = "LPAlgorithmSHEBFVrns::EvalFastRotationPrecompute the ciphertext should have two elements";
+		throw std::runtime_error(errMsg);
+	}
 
 	const shared_ptr<LPCryptoParametersBFVrns<DCRTPoly>> cryptoParamsLWE =
-			std::dynamic_pointer_cast<LPCryptoParametersBFVrns<DCRTPoly>>(ek[0]->GetCryptoParameters());
+			std::dynamic_pointer_cast<LPCryptoParametersBFVrns<DCRTPoly>>(ciphertext->GetCryptoParameters());
 
-	Ciphertext<DCRTPoly> newCiphertext = cipherText->CloneEmpty();
+	return shared_ptr<vector<DCRTPoly>>(new vector<DCRTPoly>(c[1].CRTDecompose(cryptoParamsLWE->GetRelinWindow())));
+
+}
+
+template <>
+Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalFastAutomorphism(ConstCiphertext<DCRTPoly> ciphertext, usint i,
+	const shared_ptr<vector<DCRTPoly>> digits, const std::map<usint, LPEvalKey<DCRTPoly>> &evalKeys) const
+{
+
+	auto fk = evalKeys.find(i);
+	if( fk == evalKeys.end() ) {
+		PALISADE_THROW(config_error, "Could not find an EvalKey for index " + to_string(i));
+	}
 
-	std::vector<DCRTPoly> c = cipherText->GetElements();
+	LPEvalKeyRelin<DCRTPoly> evalKey = std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(fk->second);
 
-	if(c[0].GetFormat() == Format::COEFFICIENT)
+	const std::vector<DCRTPoly> &b = evalKey->GetAVector();
+	const std::vector<DCRTPoly> &a = evalKey->GetBVector();
+
+	if (digits->size() != b.size()) {
+		std::string errMsg = "LPAlgorithmSHEBFVrns::EvalFastAutomorphism the digits were not computed by EvalFastRotationPrecompute";
+		throw std::runtime_error(errMsg);
+	}
+
+	const std::vector<DCRTPoly> &c = ciphertext->GetElements();
+
+	// The automorphism commutes with the CRT decomposition, so it is applied to the digits of c[1]
+	// rather than to c[1] itself; in evaluation representation it is only a permutation of the values
+	std::vector<DCRTPoly> digitsC1(digits->size());
+#pragma omp parallel for
+	for (usint j = 0; j < digits->size(); j++)
+		digitsC1[j] = (*digits)[j].AutomorphismTransform(i);
+
+	DCRTPoly ct0 = c[0].AutomorphismTransform(i);
+	if (ct0.GetFormat() == Format::COEFFICIENT)
+		ct0.SwitchFormat();
+
+	DCRTPoly ct1(ct0.GetParams(), Format::EVALUATION, true);
+
+	std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsB(digitsC1.size());
+	std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsA(digitsC1.size());
+	for (usint j = 0; j < digitsC1.size(); ++j)
+	{
+		termsB[j] = std::make_pair(&digitsC1[j], &b[j]);
+		termsA[j] = std::make_pair(&digitsC1[j], &a[j]);
+	}
+
+	ct0.AddInnerProductInPlace(termsB);
+	ct1.AddInnerProductInPlace(termsA);
+
+	Ciphertext<DCRTPoly> newCiphertext = ciphertext->CloneEmpty();
+
+	std::vector<DCRTPoly> ct(2);
+	ct[0] = std::move(ct0);
+	ct[1] = std::move(ct1);
+	newCiphertext->SetElements(std::move(ct));
+
+	return newCiphertext;
+}
+
+// Key switches the elements past the first two of a ciphertext with the keys for the matching
+// powers of s, and returns the two remaining elements; c is taken by value so temporaries can be moved in
+static std::vector<DCRTPoly> RelinearizeElements(std::vector<DCRTPoly> c, const vector<LPEvalKey<DCRTPoly>> &ek) {
+
+	if (ek.size() + 2 < c.size()) {
+		std::string errMsg = "LPAlgorithmSHEBFVrns::Relinearize not enough evaluation keys for the number of ciphertext elements";
+		throw std::runtime_error(errMsg);
+	}
+
+	if(c[0].GetFormat() == Format::COEFFICIENT) {
+		std::vector<DCRTPoly*> elements(c.size());
 		for(size_t i=0; i<c.size(); i++)
-			c[i].SwitchFormat();
+			elements[i] = &c[i];
+		DCRTPoly::SwitchFormat(elements);
+	}
 
-	DCRTPoly ct0(c[0]);
-	DCRTPoly ct1(c[1]);
-	// Perform a keyswitching operation to result of the multiplication. It does it until it reaches to 2 elements.
-	//TODO: Maybe we can change the number of keyswitching and terminate early. For instance; perform keyswitching until 4 elements left.
-	for(size_t j = 0; j<=cipherText->GetDepth()-2; j++){
-		size_t index = cipherText->GetDepth()-2-j;
+	DCRTPoly ct0(std::move(c[0]));
+	DCRTPoly ct1(std::move(c[1]));
+	for(size_t index = 0; index+2 < c.size(); index++){
 		LPEvalKeyRelin<DCRTPoly> evalKey = std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(ek[index]);
 
 		const std::vector<DCRTPoly> &b = evalKey->GetAVector();
@@ -979,13 +1045,45 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMultAndRelinearize(Cons
 
 		std::vector<DCRTPoly> digitsC2 = c[index+2].CRTDecompose();
 
+		std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsB(digitsC2.size());
+		std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsA(digitsC2.size());
 		for (usint i = 0; i < digitsC2.size(); ++i){
-			ct0 += digitsC2[i] * b[i];
-			ct1 += digitsC2[i] * a[i];
+			termsB[i] = std::make_pair(&digitsC2[i], &b[i]);
+			termsA[i] = std::make_pair(&digitsC2[i], &a[i]);
 		}
+
+		ct0.AddInnerProductInPlace(termsB);
+		ct1.AddInnerProductInPlace(termsA);
 	}
 
-	newCiphertext->SetElements({ ct0, ct1 });
+	std::vector<DCRTPoly> ct(2);
+	ct[0] = std::move(ct0);
+	ct[1] = std::move(ct1);
+	return ct;
+}
+
+template <>
+Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::EvalMultAndRelinearize(ConstCiphertext<DCRTPoly> ciphertext1,
+	ConstCiphertext<DCRTPoly> ciphertext2, const vector<LPEvalKey<DCRTPoly>> &ek) const{
+
+	Ciphertext<DCRTPoly> cipherText = this->EvalMult(ciphertext1, ciphertext2);
+
+	Ciphertext<DCRTPoly> newCiphertext = cipherText->CloneEmpty();
+
+	// cipherText is a temporary, so its elements are moved rather than copied
+	newCiphertext->SetElements(RelinearizeElements(std::move(cipherText->GetElementsForUpdate()), ek));
+
+	return newCiphertext;
+
+}
+
+template <>
+Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrns<DCRTPoly>::Relinearize(ConstCiphertext<DCRTPoly> ciphertext,
+	const vector<LPEvalKey<DCRTPoly>> &ek) const{
+
+	Ciphertext<DCRTPoly> newCiphertext = ciphertext->CloneEmpty();
+
+	newCiphertext->SetElements(RelinearizeElements(ciphertext->GetElements(), ek));
 
 	return newCiphertext;
 
@@ -1006,7 +1104,6 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReKeyGen(const LPPublicKey<D
 			std::dynamic_pointer_cast<LPCryptoParametersBFVrns<DCRTPoly>>(newPK->GetCryptoParameters());
 	const shared_ptr<DCRTPoly::Params> elementParams = cryptoParamsLWE->GetElementParams();
 
-	const DCRTPoly::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
 	DCRTPoly::DugType dug;
 	DCRTPoly::TugType tug;
 
@@ -1038,12 +1135,12 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReKeyGen(const LPPublicKey<D
 				DCRTPoly u;
 
 				if (cryptoParamsLWE->GetMode() == RLWE)
-					u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+					u = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 				else
 					u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-				DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
-				DCRTPoly e2(dgg, elementParams, Format::EVALUATION);
+				DCRTPoly e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+				DCRTPoly e2(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 				DCRTPoly c0(elementParams);
 				DCRTPoly c1(elementParams);
@@ -1055,7 +1152,7 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReKeyGen(const LPPublicKey<D
 				DCRTPoly a(dug, elementParams, Format::EVALUATION);
 				evalKeyElementsGenerated.push_back(c1);
 
-				DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+				DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 				evalKeyElements.push_back(c0);
 			}
 		}
@@ -1070,12 +1167,12 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReKeyGen(const LPPublicKey<D
 			DCRTPoly u;
 
 			if (cryptoParamsLWE->GetMode() == RLWE)
-				u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+				u = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 			else
 				u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-			DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
-			DCRTPoly e2(dgg, elementParams, Format::EVALUATION);
+			DCRTPoly e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+			DCRTPoly e2(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 			DCRTPoly c0(elementParams);
 			DCRTPoly c1(elementParams);
@@ -1087,7 +1184,7 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReKeyGen(const LPPublicKey<D
 			DCRTPoly a(dug, elementParams, Format::EVALUATION);
 			evalKeyElementsGenerated.push_back(c1);
 
-			DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+			DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 			evalKeyElements.push_back(c0);
 		}
 
@@ -1131,7 +1228,10 @@ Ciphertext<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReEncrypt(const LPEvalKey<D
 		ct1 += digitsC2[i] * a[i];
 	}
 
-	newCiphertext->SetElements({ ct0, ct1 });
+	std::vector<DCRTPoly> ct(2);
+	ct[0] = std::move(ct0);
+	ct[1] = std::move(ct1);
+	newCiphertext->SetElements(std::move(ct));
 
 	if (publicKey == nullptr) { // Recipient PK is not provided - CPA-secure PRE
 		return newCiphertext;
@@ -1162,7 +1262,6 @@ Ciphertext<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReEncrypt(const LPEvalKey<D
 		Ciphertext<DCRTPoly> zeroCiphertext(new CiphertextImpl<DCRTPoly>(publicKey));
 		zeroCiphertext->SetEncodingType(encType);
 
-		const DCRTPoly::DggType &dgg = cryptoPars->GetDiscreteGaussianGenerator();
 		DCRTPoly::TugType tug;
 		// Scaling the distribution standard deviation by K for HRA-security
 		auto stdDev = cryptoPars->GetDistributionParameter();
@@ -1173,7 +1272,7 @@ Ciphertext<DCRTPoly> LPAlgorithmPREBFVrns<DCRTPoly>::ReEncrypt(const LPEvalKey<D
 
 		DCRTPoly u;
 		if (cryptoPars->GetMode() == RLWE)
-			u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+			u = cryptoPars->SampleNoise(elementParams, Format::EVALUATION);
 		else
 			u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
@@ -260,6 +260,40 @@ Ciphertext<NativePoly> LPAlgorithmSHEBFVrns<NativePoly>::EvalMultAndRelinearize(
 	NONATIVEPOLY
 }
 
+template <>
+Ciphertext<Poly> LPAlgorithmSHEBFVrns<Poly>::Relinearize(ConstCiphertext<Poly> ct,
+	const vector<LPEvalKey<Poly>> &ek) const{
+	NOPOLY
+}
+
+template <>
+Ciphertext<NativePoly> LPAlgorithmSHEBFVrns<NativePoly>::Relinearize(ConstCiphertext<NativePoly> ct,
+	const vector<LPEvalKey<NativePoly>> &ek) const{
+	NONATIVEPOLY
+}
+
+template <>
+shared_ptr<vector<Poly>> LPAlgorithmSHEBFVrns<Poly>::EvalFastRotationPrecompute(ConstCiphertext<Poly> ciphertext) const{
+	NOPOLY
+}
+
+template <>
+shared_ptr<vector<NativePoly>> LPAlgorithmSHEBFVrns<NativePoly>::EvalFastRotationPrecompute(ConstCiphertext<NativePoly> ciphertext) const{
+	NONATIVEPOLY
+}
+
+template <>
+Ciphertext<Poly> LPAlgorithmSHEBFVrns<Poly>::EvalFastAutomorphism(ConstCiphertext<Poly> ciphertext, usint i,
+	const shared_ptr<vector<Poly>> digits, const std::map<usint, LPEvalKey<Poly>> &evalKeys) const{
+	NOPOLY
+}
+
+template <>
+Ciphertext<NativePoly> LPAlgorithmSHEBFVrns<NativePoly>::EvalFastAutomorphism(ConstCiphertext<NativePoly> ciphertext, usint i,
+	const shared_ptr<vector<NativePoly>> digits, const std::map<usint, LPEvalKey<NativePoly>> &evalKeys) const{
+	NONATIVEPOLY
+}
+
 template <>
 DecryptResult LPAlgorithmMultipartyBFVrns<Poly>::MultipartyDecryptFusion(const vector<Ciphertext<Poly>>& ciphertextVec,
 		NativePoly *plaintext) const {
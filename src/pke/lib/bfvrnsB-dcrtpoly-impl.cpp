@@ -596,7 +596,6 @@ Ciphertext<DCRTPoly> LPAlgorithmBFVrnsB<DCRTPoly>::Encrypt(const LPPublicKey<DCR
 
 	const std::vector<NativeInteger> &deltaTable = cryptoParams->GetCRTDeltaTable();
 
-	const typename DCRTPoly::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 	typename DCRTPoly::TugType tug;
 
 	const DCRTPoly &p0 = publicKey->GetPublicElements().at(0);
@@ -606,12 +605,12 @@ Ciphertext<DCRTPoly> LPAlgorithmBFVrnsB<DCRTPoly>::Encrypt(const LPPublicKey<DCR
 
 	//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 	if (cryptoParams->GetMode() == RLWE)
-		u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+		u = cryptoParams->SampleNoise(elementParams, Format::EVALUATION);
 	else
 		u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-	DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
-	DCRTPoly e2(dgg, elementParams, Format::EVALUATION);
+	DCRTPoly e1(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
+	DCRTPoly e2(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
 	DCRTPoly c0(elementParams);
 	DCRTPoly c1(elementParams);
@@ -708,20 +707,21 @@ Ciphertext<DCRTPoly> LPAlgorithmBFVrnsB<DCRTPoly>::Encrypt(const LPPrivateKey<DC
 
 	ptxt.SwitchFormat();
 
-	const typename DCRTPoly::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
-	typename DCRTPoly::DugType dug;
-
 	const std::vector<NativeInteger> &deltaTable = cryptoParams->GetCRTDeltaTable();
 
-	DCRTPoly a(dug, elementParams, Format::EVALUATION);
+	// c1 = -a is uniform itself, so it is the element drawn (and possibly expanded from a seed)
+	PRNGSeed seed{};
+	if (cryptoParams->GetSeededUniform())
+		seed = UniformSeed::Generate();
+	DCRTPoly c1(cryptoParams->SampleUniform(elementParams, seed, 0));
 	const DCRTPoly &s = privateKey->GetPrivateElement();
-	DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+	DCRTPoly e(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
-	DCRTPoly c0(a*s + e + ptxt.Times(deltaTable));
-	DCRTPoly c1(elementParams, Format::EVALUATION, true);
-	c1 -= a;
+	DCRTPoly c0(e + ptxt.Times(deltaTable) - c1*s);
 
 	ciphertext->SetElements({ c0, c1 });
+	if (cryptoParams->GetSeededUniform())
+		ciphertext->SetUniformSeed(seed, 1);
 
 	return ciphertext;
 }
@@ -749,7 +749,7 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalAdd(ConstCiphertext<DC
 			c[i] = cipherTextElements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -779,7 +779,7 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalSub(ConstCiphertext<DC
 			c[i] = cipherTextElements[i];
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 
 	return newCiphertext;
 
@@ -976,7 +976,7 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalMult(ConstCiphertext<D
 				paramsBModqiPrecon);
 	}
 
-	newCiphertext->SetElements(c);
+	newCiphertext->SetElements(std::move(c));
 	newCiphertext->SetDepth((ciphertext1->GetDepth() + ciphertext2->GetDepth()));
 
 	return newCiphertext;
@@ -994,14 +994,15 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::KeySwitchGen(const LPPrivat
 	const shared_ptr<typename DCRTPoly::Params> elementParams = cryptoParamsLWE->GetElementParams();
 	const DCRTPoly &s = newPrivateKey->GetPrivateElement();
 
-	const typename DCRTPoly::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
-	typename DCRTPoly::DugType dug;
-
 	const DCRTPoly &oldKey = originalPrivateKey->GetPrivateElement();
 
 	std::vector<DCRTPoly> evalKeyElements;
 	std::vector<DCRTPoly> evalKeyElementsGenerated;
 
+	PRNGSeed seed{};
+	if (cryptoParamsLWE->GetSeededUniform())
+		seed = UniformSeed::Generate();
+
 	uint32_t relinWindow = cryptoParamsLWE->GetRelinWindow();
 
 	for (usint i = 0; i < oldKey.GetNumOfElements(); i++)
@@ -1020,11 +1021,11 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::KeySwitchGen(const LPPrivat
 				filtered.SetElementAtIndex(i,decomposedKeyElements[k]);
 
 				// Generate a_i vectors
-				DCRTPoly a(dug, elementParams, Format::EVALUATION);
+				DCRTPoly a(cryptoParamsLWE->SampleUniform(elementParams, seed, evalKeyElementsGenerated.size()));
 				evalKeyElementsGenerated.push_back(a);
 
 				// Generate a_i * s + e - [oldKey]_qi [(q/qi)^{-1}]_qi (q/qi)
-				DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+				DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 				evalKeyElements.push_back(filtered - (a*s + e));
 			}
 		}
@@ -1037,11 +1038,11 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::KeySwitchGen(const LPPrivat
 			filtered.SetElementAtIndex(i,oldKey.GetElementAtIndex(i));
 
 			// Generate a_i vectors
-			DCRTPoly a(dug, elementParams, Format::EVALUATION);
+			DCRTPoly a(cryptoParamsLWE->SampleUniform(elementParams, seed, evalKeyElementsGenerated.size()));
 			evalKeyElementsGenerated.push_back(a);
 
 			// Generate a_i * s + e - [oldKey]_qi [(q/qi)^{-1}]_qi (q/qi)
-			DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+			DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 			evalKeyElements.push_back(filtered - (a*s + e));
 		}
 
@@ -1049,6 +1050,8 @@ LPEvalKey<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::KeySwitchGen(const LPPrivat
 
 	ek->SetAVector(std::move(evalKeyElements));
 	ek->SetBVector(std::move(evalKeyElementsGenerated));
+	if (cryptoParamsLWE->GetSeededUniform())
+		ek->SetUniformSeed(seed, 1);
 
 	return ek;
 
@@ -1112,28 +1115,100 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::KeySwitch(const LPEvalKey<
 
 
 template <>
-Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalMultAndRelinearize(ConstCiphertext<DCRTPoly> ciphertext1,
-	ConstCiphertext<DCRTPoly> ciphertext2, const vector<LPEvalKey<DCRTPoly>> &ek) const{
+shared_ptr<vector<DCRTPoly>> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalFastRotationPrecompute(ConstCiphertext<DCRTPoly> ciphertext) const
+{
 
-	Ciphertext<DCRTPoly> cipherText = this->EvalMult(ciphertext1, ciphertext2);
+	const std::vector<DCRTPoly> &c = ciphertext->GetElements();
+
+	if (c.size() != 2) {
+		std::string errMsg = "LPAlgorithmSHEBFVrnsB::EvalFastRotationPrecompute the ciphertext should have two elements";
+		throw std::runtime_error(errMsg);
+	}
 
 	const shared_ptr<LPCryptoParametersBFVrnsB<DCRTPoly>> cryptoParamsLWE =
-			std::dynamic_pointer_cast<LPCryptoParametersBFVrnsB<DCRTPoly>>(ek[0]->GetCryptoParameters());
+			std::dynamic_pointer_cast<LPCryptoParametersBFVrnsB<DCRTPoly>>(ciphertext->GetCryptoParameters());
 
-	Ciphertext<DCRTPoly> newCiphertext = cipherText->CloneEmpty();
+	return shared_ptr<vector<DCRTPoly>>(new vector<DCRTPoly>(c[1].CRTDecompose(cryptoParamsLWE->GetRelinWindow())));
+
+}
+
+template <>
+Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalFastAutomorphism(ConstCiphertext<DCRTPoly> ciphertext, usint i,
+	const shared_ptr<vector<DCRTPoly>> digits, const std::map<usint, LPEvalKey<DCRTPoly>> &evalKeys) const
+{
+
+	auto fk = evalKeys.find(i);
+	if( fk == evalKeys.end() ) {
+		PALISADE_THROW(config_error, "Could not find an EvalKey for index " + to_string(i));
+	}
+
+	LPEvalKeyRelin<DCRTPoly> evalKey = std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(fk->second);
+
+	const std::vector<DCRTPoly> &b = evalKey->GetAVector();
+	const std::vector<DCRTPoly> &a = evalKey->GetBVector();
+
+	if (digits->size() != b.size()) {
+		std::string errMsg = "LPAlgorithmSHEBFVrnsB::EvalFastAutomorphism the digits were not computed by EvalFastRotationPrecompute";
+		throw std::runtime_error(errMsg);
+	}
+
+	const std::vector<DCRTPoly> &c = ciphertext->GetElements();
+
+	// The automorphism commutes with the CRT decomposition, so it is applied to the digits of c[1]
+	// rather than to c[1] itself; in evaluation representation it is only a permutation of the values
+	std::vector<DCRTPoly> digitsC1(digits->size());
+#pragma omp parallel for
+	for (usint j = 0; j < digits->size(); j++)
+		digitsC1[j] = (*digits)[j].AutomorphismTransform(i);
+
+	DCRTPoly ct0 = c[0].AutomorphismTransform(i);
+	if (ct0.GetFormat() == Format::COEFFICIENT)
+		ct0.SwitchFormat();
+
+	DCRTPoly ct1(ct0.GetParams(), Format::EVALUATION, true);
+
+	std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsB(digitsC1.size());
+	std::vector<std::pair<const DCRTPoly*, const DCRTPoly*>> termsA(digitsC1.size());
+	for (usint j = 0; j < digitsC1.size(); ++j)
+	{
+		termsB[j] = std::make_pair(&digitsC1[j], &b[j]);
+		termsA[j] = std::make_pair(&digitsC1[j], &a[j]);
+	}
+
+	ct0.AddInnerProductInPlace(termsB);
+	ct1.AddInnerProductInPlace(termsA);
+
+	Ciphertext<DCRTPoly> newCiphertext = ciphertext->CloneEmpty();
+
+	std::vector<DCRTPoly> ct(2);
+	ct[0] = std::move(ct0);
+	ct[1] = std::move(ct1);
+	newCiphertext->SetElements(std::move(ct));
+
+	return newCiphertext;
+}
+
+template <>
+Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::Relinearize(ConstCiphertext<DCRTPoly> cipherText,
+	const vector<LPEvalKey<DCRTPoly>> &ek) const{
 
 	std::vector<DCRTPoly> c = cipherText->GetElements();
 
+	if (ek.size() + 2 < c.size()) {
+		std::string errMsg = "LPAlgorithmSHEBFVrnsB::Relinearize not enough evaluation keys for the number of ciphertext elements";
+		throw std::runtime_error(errMsg);
+	}
+
+	Ciphertext<DCRTPoly> newCiphertext = cipherText->CloneEmpty();
+
 	if(c[0].GetFormat() == Format::COEFFICIENT)
 		for(size_t i=0; i<c.size(); i++)
 			c[i].SwitchFormat();
 
 	DCRTPoly ct0(c[0]);
 	DCRTPoly ct1(c[1]);
-	// Perform a keyswitching operation to result of the multiplication. It does it until it reaches to 2 elements.
-	//TODO: Maybe we can change the number of keyswitching and terminate early. For instance; perform keyswitching until 4 elements left.
-	for(size_t j = 0; j<=cipherText->GetDepth()-2; j++){
-		size_t index = cipherText->GetDepth()-2-j;
+	// Perform a keyswitching operation for every element past the first two, using the key for the matching power of s.
+	for(size_t index = 0; index+2 < c.size(); index++){
 		LPEvalKeyRelin<DCRTPoly> evalKey = std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(ek[index]);
 
 		const std::vector<DCRTPoly> &b = evalKey->GetAVector();
@@ -1153,6 +1228,16 @@ Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalMultAndRelinearize(Con
 
 }
 
+template <>
+Ciphertext<DCRTPoly> LPAlgorithmSHEBFVrnsB<DCRTPoly>::EvalMultAndRelinearize(ConstCiphertext<DCRTPoly> ciphertext1,
+	ConstCiphertext<DCRTPoly> ciphertext2, const vector<LPEvalKey<DCRTPoly>> &ek) const{
+
+	Ciphertext<DCRTPoly> cipherText = this->EvalMult(ciphertext1, ciphertext2);
+
+	return this->Relinearize(cipherText, ek);
+
+}
+
 
 template <>
 LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReKeyGen(const LPPublicKey<DCRTPoly> newPK,
@@ -1168,7 +1253,6 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReKeyGen(const LPPublicKey<
 			std::dynamic_pointer_cast<LPCryptoParametersBFVrnsB<DCRTPoly>>(newPK->GetCryptoParameters());
 	const shared_ptr<DCRTPoly::Params> elementParams = cryptoParamsLWE->GetElementParams();
 
-	const DCRTPoly::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
 	DCRTPoly::DugType dug;
 	DCRTPoly::TugType tug;
 
@@ -1200,12 +1284,12 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReKeyGen(const LPPublicKey<
 				DCRTPoly u;
 
 				if (cryptoParamsLWE->GetMode() == RLWE)
-					u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+					u = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 				else
 					u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-				DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
-				DCRTPoly e2(dgg, elementParams, Format::EVALUATION);
+				DCRTPoly e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+				DCRTPoly e2(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 				DCRTPoly c0(elementParams);
 				DCRTPoly c1(elementParams);
@@ -1217,7 +1301,7 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReKeyGen(const LPPublicKey<
 				DCRTPoly a(dug, elementParams, Format::EVALUATION);
 				evalKeyElementsGenerated.push_back(c1);
 
-				DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+				DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 				evalKeyElements.push_back(c0);
 			}
 		}
@@ -1232,12 +1316,12 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReKeyGen(const LPPublicKey<
 			DCRTPoly u;
 
 			if (cryptoParamsLWE->GetMode() == RLWE)
-				u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+				u = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 			else
 				u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-			DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
-			DCRTPoly e2(dgg, elementParams, Format::EVALUATION);
+			DCRTPoly e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+			DCRTPoly e2(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 			DCRTPoly c0(elementParams);
 			DCRTPoly c1(elementParams);
@@ -1249,7 +1333,7 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReKeyGen(const LPPublicKey<
 			DCRTPoly a(dug, elementParams, Format::EVALUATION);
 			evalKeyElementsGenerated.push_back(c1);
 
-			DCRTPoly e(dgg, elementParams, Format::EVALUATION);
+			DCRTPoly e(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 			evalKeyElements.push_back(c0);
 		}
 
@@ -1324,7 +1408,6 @@ Ciphertext<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReEncrypt(const LPEvalKey<
 		Ciphertext<DCRTPoly> zeroCiphertext(new CiphertextImpl<DCRTPoly>(publicKey));
 		zeroCiphertext->SetEncodingType(encType);
 
-		const DCRTPoly::DggType &dgg = cryptoPars->GetDiscreteGaussianGenerator();
 		DCRTPoly::TugType tug;
 		// Scaling the distribution standard deviation by K for HRA-security
 		auto stdDev = cryptoPars->GetDistributionParameter();
@@ -1335,7 +1418,7 @@ Ciphertext<DCRTPoly> LPAlgorithmPREBFVrnsB<DCRTPoly>::ReEncrypt(const LPEvalKey<
 
 		DCRTPoly u;
 		if (cryptoPars->GetMode() == RLWE)
-			u = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+			u = cryptoPars->SampleNoise(elementParams, Format::EVALUATION);
 		else
 			u = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
@@ -260,6 +260,40 @@ Ciphertext<NativePoly> LPAlgorithmSHEBFVrnsB<NativePoly>::EvalMultAndRelinearize
 	NONATIVEPOLY
 }
 
+template <>
+Ciphertext<Poly> LPAlgorithmSHEBFVrnsB<Poly>::Relinearize(ConstCiphertext<Poly> ct,
+	const vector<LPEvalKey<Poly>> &ek) const{
+	NOPOLY
+}
+
+template <>
+Ciphertext<NativePoly> LPAlgorithmSHEBFVrnsB<NativePoly>::Relinearize(ConstCiphertext<NativePoly> ct,
+	const vector<LPEvalKey<NativePoly>> &ek) const{
+	NONATIVEPOLY
+}
+
+template <>
+shared_ptr<vector<Poly>> LPAlgorithmSHEBFVrnsB<Poly>::EvalFastRotationPrecompute(ConstCiphertext<Poly> ciphertext) const{
+	NOPOLY
+}
+
+template <>
+shared_ptr<vector<NativePoly>> LPAlgorithmSHEBFVrnsB<NativePoly>::EvalFastRotationPrecompute(ConstCiphertext<NativePoly> ciphertext) const{
+	NONATIVEPOLY
+}
+
+template <>
+Ciphertext<Poly> LPAlgorithmSHEBFVrnsB<Poly>::EvalFastAutomorphism(ConstCiphertext<Poly> ciphertext, usint i,
+	const shared_ptr<vector<Poly>> digits, const std::map<usint, LPEvalKey<Poly>> &evalKeys) const{
+	NOPOLY
+}
+
+template <>
+Ciphertext<NativePoly> LPAlgorithmSHEBFVrnsB<NativePoly>::EvalFastAutomorphism(ConstCiphertext<NativePoly> ciphertext, usint i,
+	const shared_ptr<vector<NativePoly>> digits, const std::map<usint, LPEvalKey<NativePoly>> &evalKeys) const{
+	NONATIVEPOLY
+}
+
 template <>
 DecryptResult LPAlgorithmMultipartyBFVrnsB<Poly>::MultipartyDecryptFusion(const vector<Ciphertext<Poly>>& ciphertextVec,
 		NativePoly *plaintext) const {
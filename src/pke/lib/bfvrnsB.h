@@ -526,6 +526,29 @@ namespace lbcrypto {
 		Ciphertext<Element> KeySwitch(const LPEvalKey<Element> keySwitchHint,
 			ConstCiphertext<Element> cipherText) const;
 
+		/**
+		* Computes the CRT digits of the second element of a ciphertext, in evaluation representation,
+		* once for several rotations of the ciphertext
+		*
+		* @param ciphertext the input ciphertext, with two elements.
+		* @return the digits.
+		*/
+		shared_ptr<vector<Element>> EvalFastRotationPrecompute(ConstCiphertext<Element> ciphertext) const;
+
+		/**
+		* Evaluates the automorphism of a ciphertext at index i from its precomputed digits.
+		* The automorphism of the digits of the second element is applied in evaluation
+		* representation, as a permutation, so no NTTs are needed.
+		*
+		* @param ciphertext the input ciphertext.
+		* @param i automorphism index
+		* @param digits the digits of the ciphertext computed by EvalFastRotationPrecompute.
+		* @param &evalKeys - reference to the map of evaluation keys generated by EvalAutomorphismKeyGen.
+		* @return resulting ciphertext
+		*/
+		Ciphertext<Element> EvalFastAutomorphism(ConstCiphertext<Element> ciphertext, usint i,
+			const shared_ptr<vector<Element>> digits, const std::map<usint, LPEvalKey<Element>> &evalKeys) const;
+
 		/**
 		* Function for evaluating multiplication on ciphertext followed by relinearization operation.
 		* Currently it assumes that the input arguments have total depth smaller than the supported depth. Otherwise, it throws an error.
@@ -539,6 +562,17 @@ namespace lbcrypto {
 		Ciphertext<Element> EvalMultAndRelinearize(ConstCiphertext<Element> ct1,
 			ConstCiphertext<Element> ct, const vector<LPEvalKey<Element>> &ek) const;
 
+		/**
+		* Function for relinearization of a ciphertext with more than two elements, for instance the sum
+		* of several products computed by EvalMult without an evaluation key.
+		*
+		* @param ct input ciphertext.
+		* @param ek the evaluation keys for the powers of the secret key, from s^2 on.
+		* @return new ciphertext with two elements.
+		*/
+		Ciphertext<Element> Relinearize(ConstCiphertext<Element> ct,
+			const vector<LPEvalKey<Element>> &ek) const;
+
 
 	};
 
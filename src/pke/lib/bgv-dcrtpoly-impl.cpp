@@ -79,7 +79,6 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBGV<DCRTPoly>::ReKeyGen(const LPPublicKey<DCRT
 		}
 
 		const auto p = cryptoParamsLWE->GetPlaintextModulus();
-		const DCRTPoly::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
 
 		DCRTPoly::TugType tug;
 
@@ -93,12 +92,12 @@ LPEvalKey<DCRTPoly> LPAlgorithmPREBGV<DCRTPoly>::ReKeyGen(const LPPublicKey<DCRT
 		DCRTPoly v;
 
 		if (cryptoParamsLWE->GetMode() == RLWE)
-			v = DCRTPoly(dgg, elementParams, Format::EVALUATION);
+			v = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 		else
 			v = DCRTPoly(tug, elementParams, Format::EVALUATION);
 
-		DCRTPoly e0(dgg, elementParams, Format::EVALUATION);
-		DCRTPoly e1(dgg, elementParams, Format::EVALUATION);
+		DCRTPoly e0(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+		DCRTPoly e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 		DCRTPoly c0(pk0*v + p*e0 - s.Times(b));
 
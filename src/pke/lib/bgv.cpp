@@ -95,14 +95,14 @@ namespace lbcrypto {
 
 		const auto p = cryptoParams->GetPlaintextModulus();
 
-		const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
-
-		typename Element::DugType dug;
 
 		typename Element::TugType tug;
 
-		//Generate the element "a" of the public key
-		Element a(dug, elementParams, Format::EVALUATION);
+		//Generate the element "a" of the public key, expanded from a seed if seeded uniform components are enabled
+		PRNGSeed seed{};
+		if (cryptoParams->GetSeededUniform())
+			seed = UniformSeed::Generate();
+		Element a(cryptoParams->SampleUniform(elementParams, seed, 0));
 
 		//Generate the secret key
 		Element s;
@@ -110,7 +110,7 @@ namespace lbcrypto {
 		//Done in two steps not to use a random polynomial from a pre-computed pool
 		//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 		if (cryptoParams->GetMode() == RLWE) {
-			s = Element(dgg, elementParams, Format::COEFFICIENT);
+			s = cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT);
 		}
 		else {
 			s = Element(tug, elementParams, Format::COEFFICIENT);
@@ -119,7 +119,7 @@ namespace lbcrypto {
 
 		//public key is generated and set
 		//privateKey->MakePublicKey(a, publicKey);
-		Element e(dgg, elementParams, Format::COEFFICIENT);
+		Element e(cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT));
 		e.SwitchFormat();
 
 		Element b = a*s + p*e;
@@ -130,6 +130,9 @@ namespace lbcrypto {
 
 		kp.publicKey->SetPublicElementAtIndex(1, std::move(b));
 
+		if (cryptoParams->GetSeededUniform())
+			kp.publicKey->SetUniformSeed(seed, 0);
+
 		return kp;
 	}
 
@@ -143,7 +146,6 @@ namespace lbcrypto {
 
 		const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 		const auto p = cryptoParams->GetPlaintextModulus();
-		const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 
 		typename Element::TugType tug;
 
@@ -158,12 +160,12 @@ namespace lbcrypto {
 
 		//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 		if (cryptoParams->GetMode() == RLWE)
-			v = Element(dgg, elementParams, Format::EVALUATION);
+			v = cryptoParams->SampleNoise(elementParams, Format::EVALUATION);
 		else
 			v = Element(tug, elementParams, Format::EVALUATION);
 
-		Element e0(dgg, elementParams, Format::EVALUATION);
-		Element e1(dgg, elementParams, Format::EVALUATION);
+		Element e0(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
+		Element e1(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
 		Element c0(b*v + p*e0 + ptxt);
 
@@ -189,17 +191,17 @@ namespace lbcrypto {
 
 		const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 		const auto p = cryptoParams->GetPlaintextModulus();
-		const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
-
-		typename Element::DugType dug;
 
 		ptxt.SwitchFormat();
 
 		std::vector<Element> cVector;
 
-		Element a(dug, elementParams, Format::EVALUATION);
+		PRNGSeed seed{};
+		if (cryptoParams->GetSeededUniform())
+			seed = UniformSeed::Generate();
+		Element a(cryptoParams->SampleUniform(elementParams, seed, 0));
 		const Element &s = privateKey->GetPrivateElement();
-		Element e(dgg, elementParams, Format::EVALUATION);
+		Element e(cryptoParams->SampleNoise(elementParams, Format::EVALUATION));
 
 		Element c0(a*s + p*e + ptxt);
 		Element c1(a);
@@ -208,6 +210,8 @@ namespace lbcrypto {
 		cVector.push_back(std::move(c1));
 
 		ciphertext->SetElements(std::move(cVector));
+		if (cryptoParams->GetSeededUniform())
+			ciphertext->SetUniformSeed(seed, 1);
 
 		return ciphertext;
 	}
@@ -415,7 +419,7 @@ namespace lbcrypto {
 
 		auto p = cryptoParams->GetPlaintextModulus();
 
-		LPEvalKey<Element> keySwitchHintRelin(new LPEvalKeyRelinImpl<Element>(originalPrivateKey->GetCryptoContext()));
+		LPEvalKeyRelin<Element> keySwitchHintRelin(new LPEvalKeyRelinImpl<Element>(originalPrivateKey->GetCryptoContext()));
 
 		//Getting a reference to the polynomials of new private key.
 		const Element &sNew = newPrivateKey->GetPrivateElement();
@@ -424,10 +428,11 @@ namespace lbcrypto {
 		const Element &s = originalPrivateKey->GetPrivateElement();
 
 		//Getting a refernce to discrete gaussian distribution generator.
-		const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 
-		//Getting a reference to discrete uniform generator.
-		typename Element::DugType dug;
+		//Seed of the uniform vector, used if seeded uniform components are enabled.
+		PRNGSeed seed{};
+		if (cryptoParams->GetSeededUniform())
+			seed = UniformSeed::Generate();
 
 		//Relinearization window is used to calculate the base exponent.
 		usint relinWindow = cryptoParams->GetRelinWindow();
@@ -441,12 +446,12 @@ namespace lbcrypto {
 		for (usint i = 0; i < (evalKeyElements.size()); i++)
 		{
 			// Generate a_i vectors
-			Element a(dug, originalKeyParams, Format::EVALUATION);
+			Element a(cryptoParams->SampleUniform(originalKeyParams, seed, i));
 
 			evalKeyElementsGenerated.push_back(a); //alpha's of i
 
 												   // Generate a_i * newSK + p * e - PowerOfBase(oldSK)
-			Element e(dgg, originalKeyParams, Format::EVALUATION);
+			Element e(cryptoParams->SampleNoise(originalKeyParams, Format::EVALUATION));
 
 			evalKeyElements[i] = (a*sNew + p*e) - evalKeyElements[i];
 
@@ -456,6 +461,9 @@ namespace lbcrypto {
 
 		keySwitchHintRelin->SetBVector(std::move(evalKeyElements));
 
+		if (cryptoParams->GetSeededUniform())
+			keySwitchHintRelin->SetUniformSeed(seed, 0);
+
 		return keySwitchHintRelin;
 	}
 
@@ -624,7 +632,6 @@ namespace lbcrypto {
 			NativeInteger bb = NativeInteger(1) << i*relinWin;
 
 			const auto p = cryptoParamsLWE->GetPlaintextModulus();
-			const typename Element::DggType &dgg = cryptoParamsLWE->GetDiscreteGaussianGenerator();
 
 			typename Element::TugType tug;
 
@@ -638,12 +645,12 @@ namespace lbcrypto {
 			Element v;
 
 			if (cryptoParamsLWE->GetMode() == RLWE)
-				v = Element(dgg, elementParams, Format::EVALUATION);
+				v = cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION);
 			else
 				v = Element(tug, elementParams, Format::EVALUATION);
 
-			Element e0(dgg, elementParams, Format::EVALUATION);
-			Element e1(dgg, elementParams, Format::EVALUATION);
+			Element e0(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
+			Element e1(cryptoParamsLWE->SampleNoise(elementParams, Format::EVALUATION));
 
 			Element c0(b*v + p*e0 - s*bb);
 
@@ -699,7 +706,6 @@ namespace lbcrypto {
 			zeroCiphertext->SetEncodingType(encType);
 
 			const auto p = cryptoPars->GetPlaintextModulus();
-			const typename Element::DggType &dgg = cryptoPars->GetDiscreteGaussianGenerator();
 			typename Element::TugType tug;
 			// Scaling the distribution standard deviation by K for HRA-security
 			auto stdDev = cryptoPars->GetDistributionParameter();
@@ -712,7 +718,7 @@ namespace lbcrypto {
 
 			Element v;
 			if (cryptoPars->GetMode() == RLWE)
-				v = Element(dgg, elementParams, Format::EVALUATION);
+				v = cryptoPars->SampleNoise(elementParams, Format::EVALUATION);
 			else
 				v = Element(tug, elementParams, Format::EVALUATION);
 
@@ -764,7 +770,6 @@ namespace lbcrypto {
 		const shared_ptr<LPCryptoParametersBGV<Element>> cryptoParams = std::static_pointer_cast<LPCryptoParametersBGV<Element>>(cc->GetCryptoParameters());
 		const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 		const auto p = cryptoParams->GetPlaintextModulus();
-		const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 		typename Element::DugType dug;
 		typename Element::TugType tug;
 
@@ -784,7 +789,7 @@ namespace lbcrypto {
 
 		//public key is generated and set
 		//privateKey->MakePublicKey(a, publicKey);
-		Element e(dgg, elementParams, Format::COEFFICIENT);
+		Element e(cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT));
 		e.SwitchFormat();
 
 		Element b = a*s + p*e;
@@ -807,7 +812,6 @@ LPKeyPair<Element> LPAlgorithmMultipartyBGV<Element>::MultipartyKeyGen(CryptoCon
 		const shared_ptr<LPCryptoParametersBGV<Element>> cryptoParams = std::static_pointer_cast<LPCryptoParametersBGV<Element>>(cc->GetCryptoParameters());
 		const shared_ptr<typename Element::Params> elementParams = cryptoParams->GetElementParams();
 		const auto p = cryptoParams->GetPlaintextModulus();
-		const typename Element::DggType &dgg = cryptoParams->GetDiscreteGaussianGenerator();
 		typename Element::DugType dug;
 		typename Element::TugType tug;
 
@@ -818,7 +822,7 @@ LPKeyPair<Element> LPAlgorithmMultipartyBGV<Element>::MultipartyKeyGen(CryptoCon
 
 		//Supports both discrete Gaussian (RLWE) and ternary uniform distribution (OPTIMIZED) cases
 		if (cryptoParams->GetMode() == RLWE) {
-			s = Element(dgg, elementParams, Format::COEFFICIENT);
+			s = cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT);
 		}
 		else {
 			s = Element(tug, elementParams, Format::COEFFICIENT);
@@ -827,7 +831,7 @@ LPKeyPair<Element> LPAlgorithmMultipartyBGV<Element>::MultipartyKeyGen(CryptoCon
 
 		//public key is generated and set
 		//privateKey->MakePublicKey(a, publicKey);
-		Element e(dgg, elementParams, Format::COEFFICIENT);
+		Element e(cryptoParams->SampleNoise(elementParams, Format::COEFFICIENT));
 		e.SwitchFormat();
 		//a.SwitchFormat();
 
@@ -373,6 +373,19 @@ namespace lbcrypto {
 			throw std::runtime_error(errMsg);
 		}
 
+		/**
+		* Unimplemented function to relinearize a ciphertext for the BGV scheme.
+		*
+		* @param ciphertext The input ciphertext.
+		* @param ek The evaluation keys input.
+		* @return A shared pointer to the relinearized ciphertext.
+		*/
+		Ciphertext<Element> Relinearize(ConstCiphertext<Element> ciphertext,
+			const vector<LPEvalKey<Element>> &ek) const {
+			std::string errMsg = "LPAlgorithmSHEBGV::Relinearize is not implemented for the BGV Scheme.";
+			throw std::runtime_error(errMsg);
+		}
+
 		/**
 		* Function for homomorphic negation of ciphertexts.
 		*
@@ -24,21 +24,38 @@
  *
  */
 
+#include "cryptocontext.h"
 #include "ciphertext.h"
 
 namespace lbcrypto {
 
 template <typename Element>
 bool CiphertextImpl<Element>::Serialize(Serialized* serObj) const {
+	return SerializeCiphertext(serObj, true);
+}
+
+template <typename Element>
+bool CiphertextImpl<Element>::SerializeWithoutContext(Serialized* serObj) const {
+	return SerializeCiphertext(serObj, false);
+}
+
+template <typename Element>
+bool CiphertextImpl<Element>::SerializeCiphertext(Serialized* serObj, bool includeContext) const {
 	serObj->SetObject();
 
-	if( !this->SerializeCryptoObject(serObj) )
+	if( !this->SerializeCryptoObject(serObj, includeContext) )
 		return false;
 
 	serObj->AddMember("Object", "Ciphertext", serObj->GetAllocator());
 	serObj->AddMember("Depth", std::to_string(m_depth), serObj->GetAllocator());
 	serObj->AddMember("EncodingType", std::to_string(this->encodingType), serObj->GetAllocator());
-	SerializeVector("Elements", Element::GetElementName(), this->m_elements, serObj);
+	// an element expanded from a seed is stored as the seed only
+	if( m_uniformSeed.IsSet() ) {
+		SerializeVector("Elements", Element::GetElementName(), m_uniformSeed.Stored(this->GetElements()), serObj);
+		m_uniformSeed.Serialize(serObj);
+	}
+	else
+		SerializeVector("Elements", Element::GetElementName(), this->GetElements(), serObj);
 
 	return true;
 }
@@ -72,10 +89,58 @@ bool CiphertextImpl<Element>::Deserialize(const Serialized& serObj) {
 	if( mIter == serObj.MemberEnd() )
 		return false;
 
-	if( !DeserializeVector<Element>("Elements", this->m_elements[0].GetElementName(), mIter, &this->m_elements) )
+	if( !DeserializeVector<Element>("Elements", Element::GetElementName(), mIter, &this->m_elements) )
+		return false;
+
+	if( !m_uniformSeed.Deserialize(serObj) )
 		return false;
 
+	// the element stored as a seed is expanded on first use
+	if( m_uniformSeed.IsSet() ) {
+		if( this->m_elements.size() != 1 )
+			return false;
+		m_uniformSeed.Restore(this->m_elements);
+	}
+
 	return true;
 }
 
+template <typename Element>
+void CiphertextImpl<Element>::SerializeBinary(std::ostream &out) const {
+	BinaryWriter writer(BINARY_CIPHERTEXT);
+	this->GetCryptoContext()->SerializeBinary(writer);
+	SerializeBinaryWithoutContext(writer);
+	writer.WriteTo(out);
+}
+
+template <typename Element>
+void CiphertextImpl<Element>::SerializeBinaryWithoutContext(BinaryWriter &writer) const {
+	this->SerializeBinaryCryptoObject(writer);
+	writer.WriteU32(m_depth);
+	writer.WriteU32(this->encodingType);
+	m_uniformSeed.SerializeBinary(writer);
+	// an element expanded from a seed is stored as the seed only
+	SerializeBinaryVector(writer, m_uniformSeed.Stored(this->GetElements()));
+}
+
+template <typename Element>
+void CiphertextImpl<Element>::DeserializeBinary(BinaryReader &reader) {
+	// deserialization must be done in a crypto context; the context must be initialized before deserializing the elements
+	if( !this->GetCryptoContext() )
+		PALISADE_THROW(deserialize_error, "Ciphertext must be deserialized in a crypto context");
+
+	this->DeserializeBinaryCryptoObject(reader);
+	m_depth = reader.ReadU32();
+	this->encodingType = (PlaintextEncodings)reader.ReadU32();
+	m_uniformSeed.DeserializeBinary(reader);
+	DeserializeBinaryVector(reader, &this->m_elements);
+
+	// the element stored as a seed is expanded on first use
+	if( m_uniformSeed.IsSet() ) {
+		if( this->m_elements.size() != 1 )
+			PALISADE_THROW(deserialize_error, "Ciphertext with a seed must have exactly one stored element");
+		m_uniformSeed.Restore(this->m_elements);
+	}
+}
+
 }
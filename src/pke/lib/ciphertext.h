@@ -71,13 +71,15 @@ class CiphertextImpl;
 		* Copy constructor
 		*/
 		CiphertextImpl(const CiphertextImpl<Element> &ciphertext) : CryptoObject<Element>(ciphertext) {
-			m_elements = ciphertext.m_elements;
+			m_elements = ciphertext.GetElements();
+			m_uniformSeed = ciphertext.m_uniformSeed;
 			m_depth = ciphertext.m_depth;
 			encodingType = ciphertext.encodingType;
 		}
 
 		CiphertextImpl(Ciphertext<Element> ciphertext) : CryptoObject<Element>(*ciphertext) {
-			m_elements = ciphertext->m_elements;
+			m_elements = static_cast<const CiphertextImpl<Element>&>(*ciphertext).GetElements();
+			m_uniformSeed = ciphertext->m_uniformSeed;
 			m_depth = ciphertext->m_depth;
 			encodingType = ciphertext->encodingType;
 		}
@@ -85,14 +87,12 @@ class CiphertextImpl;
 		/**
 		* Move constructor
 		*/
-		CiphertextImpl(CiphertextImpl<Element> &&ciphertext) : CryptoObject<Element>(ciphertext) {
-			m_elements = std::move(ciphertext.m_elements);
-			m_depth = std::move(ciphertext.m_depth);
-			encodingType = std::move(ciphertext.encodingType);
-		}
+		CiphertextImpl(CiphertextImpl<Element> &&ciphertext) : CryptoObject<Element>(std::move(ciphertext)),
+			m_elements(std::move(ciphertext.m_elements)), m_uniformSeed(ciphertext.m_uniformSeed), m_depth(ciphertext.m_depth), encodingType(ciphertext.encodingType) {}
 
 		CiphertextImpl(Ciphertext<Element> &&ciphertext) : CryptoObject<Element>(*ciphertext) {
 			m_elements = std::move(ciphertext->m_elements);
+			m_uniformSeed = ciphertext->m_uniformSeed;
 			m_depth = std::move(ciphertext->m_depth);
 			encodingType = std::move(ciphertext->encodingType);
 		}
@@ -128,7 +128,8 @@ class CiphertextImpl;
 		CiphertextImpl<Element>& operator=(const CiphertextImpl<Element> &rhs) {
 			if (this != &rhs) {
 				CryptoObject<Element>::operator=(rhs);
-				this->m_elements = rhs.m_elements;
+				this->m_elements = rhs.GetElements();
+				this->m_uniformSeed = rhs.m_uniformSeed;
 				this->m_depth = rhs.m_depth;
 				this->encodingType = rhs.encodingType;
 			}
@@ -144,10 +145,11 @@ class CiphertextImpl;
 		*/
 		CiphertextImpl<Element>& operator=(CiphertextImpl<Element> &&rhs) {
 			if (this != &rhs) {
-				CryptoObject<Element>::operator=(rhs);
+				CryptoObject<Element>::operator=(std::move(rhs));
 				this->m_elements = std::move(rhs.m_elements);
-				this->m_depth = std::move(rhs.m_depth);
-				this->encodingType = std::move(rhs.encodingType);
+				this->m_uniformSeed = rhs.m_uniformSeed;
+				this->m_depth = rhs.m_depth;
+				this->encodingType = rhs.encodingType;
 			}
 
 			return *this;
@@ -171,7 +173,22 @@ class CiphertextImpl;
 		* GetElements: get all of the ring elements in the CiphertextImpl
 		* @return vector of ring elements
 		*/
-		const std::vector<Element> &GetElements() const { return m_elements; }
+		const std::vector<Element> &GetElements() const {
+			m_uniformSeed.ExpandPending(m_elements);
+			return m_elements;
+		}
+
+		/**
+		* GetElementsForUpdate: get all of the ring elements in the CiphertextImpl for in-place modification,
+		* or to move them out of a CiphertextImpl that is about to be discarded. The seed of the uniform
+		* element is forgotten, so it is serialized in full; use GetElements to only read the elements.
+		* @return vector of ring elements
+		*/
+		std::vector<Element> &GetElementsForUpdate() {
+			m_uniformSeed.ExpandPending(m_elements);
+			m_uniformSeed.Clear();
+			return m_elements;
+		}
 
 		/**
 		* SetElement - sets the ring element for the cases that use only one element in the vector
@@ -179,6 +196,7 @@ class CiphertextImpl;
 		* @param &element is a polynomial ring element.
 		*/
 		void SetElement(const Element &element) {
+			m_uniformSeed.Clear();
 			if (m_elements.size() == 0)
 				m_elements.push_back(element);
 			else if (m_elements.size() == 1)
@@ -187,19 +205,56 @@ class CiphertextImpl;
 				throw std::logic_error("SetElement should only be used in cases with a Ciphertext with a single element");
 		}
 
+		/**
+		* SetElement - moves the ring element into the CiphertextImpl for the cases that use only one element in the vector
+		* this method will throw an exception if it's ever called in cases with other than 1 element
+		* @param &&element is a polynomial ring element.
+		*/
+		void SetElement(Element &&element) {
+			m_uniformSeed.Clear();
+			if (m_elements.size() == 0)
+				m_elements.push_back(std::move(element));
+			else if (m_elements.size() == 1)
+				m_elements[0] = std::move(element);
+			else
+				throw std::logic_error("SetElement should only be used in cases with a Ciphertext with a single element");
+		}
+
 		/**
 		* Sets the data elements.
 		*
 		* @param &element is a polynomial ring element.
 		*/
-		void SetElements(const std::vector<Element> &elements) { m_elements = elements; }
+		void SetElements(const std::vector<Element> &elements) {
+			m_elements = elements;
+			m_uniformSeed.Clear();
+		}
 
 		/**
 		* Sets the data elements by std::move.
 		*
-		* @param &&element is a polynomial ring element.
+		* @param &&elements are the polynomial ring elements.
+		*/
+		void SetElements(std::vector<Element> &&elements) {
+			m_elements = std::move(elements);
+			m_uniformSeed.Clear();
+		}
+
+		/**
+		* Records that the ring element at index idx was expanded from a seed with UniformSeed::Expand,
+		* so that only the seed is serialized. Replacing or modifying the elements forgets the seed.
+		*
+		* @param &seed the seed.
+		* @param idx the index of the element.
+		*/
+		void SetUniformSeed(const PRNGSeed &seed, usint idx) { m_uniformSeed.Set(seed, idx); }
+
+		/**
+		* Gets the seed of the uniformly random element of the ciphertext, if it was recorded.
+		*
+		* @return the seed.
 		*/
-		void SetElements(const std::vector<Element> &&elements) { m_elements = std::move(elements); }
+		const UniformSeed &GetUniformSeed() const { return m_uniformSeed; }
 
 		/**
 		* Get the depth of the ciphertext.
@@ -224,6 +279,13 @@ class CiphertextImpl;
 		*/
 		bool Serialize(Serialized* serObj) const;
 
+		/**
+		* Serialize the object into a Serialized, without its crypto context
+		* @param serObj is used to store the serialized result. It MUST be a rapidjson Object (SetObject());
+		* @return true if successfully serialized
+		*/
+		bool SerializeWithoutContext(Serialized* serObj) const;
+
 		/**
 		* Populate the object from the deserialization of the Serialized
 		* @param serObj contains the serialized object
@@ -231,6 +293,25 @@ class CiphertextImpl;
 		*/
 		bool Deserialize(const Serialized& serObj);
 
+		/**
+		* Writes the ciphertext in the compact binary format, with its crypto context
+		* @param out the stream
+		*/
+		void SerializeBinary(std::ostream &out) const;
+
+		/**
+		* Writes the ciphertext in the compact binary format, without its crypto context
+		* @param writer the binary object being written
+		*/
+		void SerializeBinaryWithoutContext(BinaryWriter &writer) const;
+
+		/**
+		* Populates the ciphertext from the compact binary format; the crypto context must be set
+		* @param reader the binary object being read
+		* @throws deserialize_error if the ciphertext is malformed
+		*/
+		void DeserializeBinary(BinaryReader &reader);
+
 		bool operator==(const CiphertextImpl<Element>& rhs) const {
 			if( !CryptoObject<Element>::operator==(rhs) )
 				return false;
@@ -259,9 +340,10 @@ class CiphertextImpl;
 
 		friend ostream& operator<<(ostream& out, const CiphertextImpl<Element>& c) {
 			out << "enc=" << c.encodingType << " depth=" << c.m_depth << endl;
-			for( size_t i=0; i<c.m_elements.size(); i++ ) {
+			const std::vector<Element> &elements = c.GetElements();
+			for( size_t i=0; i<elements.size(); i++ ) {
 				if( i != 0 ) out << endl;
-				out << "Element " << i << ": " << c.m_elements[i];
+				out << "Element " << i << ": " << elements[i];
 			}
 			return out;
 		}
@@ -272,10 +354,14 @@ class CiphertextImpl;
 
 	private:
 
+		// serializes the ciphertext, with or without its crypto context
+		bool SerializeCiphertext(Serialized* serObj, bool includeContext) const;
+
 		//FUTURE ENHANCEMENT: current value of error norm
 		//BigInteger m_norm;
 
-		std::vector<Element> m_elements;		/*!< vector of ring elements for this Ciphertext */
+		mutable std::vector<Element> m_elements;		/*!< vector of ring elements for this Ciphertext; mutable for the lazy expansion of an element stored as a seed */
+		UniformSeed m_uniformSeed;		/*!< seed of the uniformly random element, if it was recorded */
 		size_t m_depth; // holds the multiplicative depth of the ciphertext.
 		PlaintextEncodings	encodingType;	/*!< how was this Ciphertext encoded? */
 	};
@@ -30,12 +30,15 @@ namespace lbcrypto {
 template class CryptoContextFactory<Poly>;
 template class CryptoContextImpl<Poly>;
 template class CryptoObject<Poly>;
+template class CiphertextArchive<Poly>;
 
 template class CryptoContextFactory<NativePoly>;
 template class CryptoContextImpl<NativePoly>;
 template class CryptoObject<NativePoly>;
+template class CiphertextArchive<NativePoly>;
 
 template class CryptoContextFactory<DCRTPoly>;
 template class CryptoContextImpl<DCRTPoly>;
 template class CryptoObject<DCRTPoly>;
+template class CiphertextArchive<DCRTPoly>;
 }
@@ -27,6 +27,8 @@
 
 #include "cryptocontext.h"
 #include "utils/serializablehelper.h"
+#include "utils/mappedfile.h"
+#include "utils/parallel.h"
 
 namespace lbcrypto {
 
@@ -39,6 +41,12 @@ std::map<string,shared_ptr<std::map<usint,LPEvalKey<Element>>>>	CryptoContextImp
 template <typename Element>
 std::map<string,shared_ptr<std::map<usint,LPEvalKey<Element>>>>	CryptoContextImpl<Element>::evalAutomorphismKeyMap;
 
+// checks that a binary object was entirely consumed
+static void RequireBinaryEnd(const BinaryReader &reader) {
+	if( !reader.AtEnd() )
+		PALISADE_THROW(deserialize_error, "Unexpected data at the end of a binary object");
+}
+
 template <typename Element>
 void CryptoContextImpl<Element>::EvalMultKeyGen(const LPPrivateKey<Element> key) {
 
@@ -147,6 +155,35 @@ void CryptoContextImpl<Element>::EvalSumKeyGen(
 	evalSumKeyMap[privateKey->GetKeyTag()] = evalKeys;
 }
 
+template <typename Element>
+void CryptoContextImpl<Element>::EvalSumKeyGenBSGS(
+	const LPPrivateKey<Element> privateKey,
+	usint babySteps,
+	const LPPublicKey<Element> publicKey) {
+
+	if( privateKey == NULL || Mismatched(privateKey->GetCryptoContext()) ) {
+		throw std::logic_error("Private key passed to EvalSumKeyGenBSGS were not generated with this crypto context");
+	}
+
+	if( publicKey != NULL && privateKey->GetKeyTag() != publicKey->GetKeyTag() ) {
+		throw std::logic_error("Public key passed to EvalSumKeyGenBSGS does not match private key");
+	}
+
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto evalKeys = GetEncryptionAlgorithm()->EvalSumKeyGenBSGS(privateKey,publicKey,babySteps);
+
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalSumKeyGen, currentDateTime() - start) );
+	}
+
+	// keep the keys of EvalSum, so that both can be used
+	auto ekv = evalSumKeyMap.find(privateKey->GetKeyTag());
+	if( ekv != evalSumKeyMap.end() )
+		evalKeys->insert(ekv->second->begin(), ekv->second->end());
+	evalSumKeyMap[privateKey->GetKeyTag()] = evalKeys;
+}
+
 template <typename Element>
 const std::map<usint, LPEvalKey<Element>>& CryptoContextImpl<Element>::GetEvalSumKeyMap(const string& keyID) {
 	auto ekv = evalSumKeyMap.find(keyID);
@@ -221,6 +258,33 @@ void CryptoContextImpl<Element>::EvalAtIndexKeyGen(const LPPrivateKey<Element> p
 	evalAutomorphismKeyMap[privateKey->GetKeyTag()] = evalKeys;
 }
 
+template <typename Element>
+void CryptoContextImpl<Element>::EvalLinearTransformKeyGen(const LPPrivateKey<Element> privateKey,
+				usint dimension, usint babySteps, const LPPublicKey<Element> publicKey) {
+
+	if( privateKey == NULL || Mismatched(privateKey->GetCryptoContext()) ) {
+		throw std::logic_error("Private key passed to EvalLinearTransformKeyGen were not generated with this crypto context");
+	}
+
+	if( publicKey != NULL && privateKey->GetKeyTag() != publicKey->GetKeyTag() ) {
+		throw std::logic_error("Public key passed to EvalLinearTransformKeyGen does not match private key");
+	}
+
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto evalKeys = GetEncryptionAlgorithm()->EvalLinearTransformKeyGen(publicKey,privateKey,dimension,babySteps);
+
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalAtIndexKeyGen, currentDateTime() - start) );
+	}
+
+	// keep the other rotation keys
+	auto ekv = evalAutomorphismKeyMap.find(privateKey->GetKeyTag());
+	if( ekv != evalAutomorphismKeyMap.end() )
+		evalKeys->insert(ekv->second->begin(), ekv->second->end());
+	evalAutomorphismKeyMap[privateKey->GetKeyTag()] = evalKeys;
+}
+
 template <typename Element>
 const std::map<usint, LPEvalKey<Element>>& CryptoContextImpl<Element>::GetEvalAutomorphismKeyMap(const string& keyID) {
 	auto ekv = evalAutomorphismKeyMap.find(keyID);
@@ -638,6 +702,22 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalSum(ConstCiphertext<Element>
 	return rv;
 }
 
+template <typename Element>
+Ciphertext<Element> CryptoContextImpl<Element>::EvalSumBSGS(ConstCiphertext<Element> ciphertext, usint batchSize, usint babySteps) const {
+
+	if( ciphertext == NULL || Mismatched(ciphertext->GetCryptoContext()) )
+		throw std::logic_error("Information passed to EvalSumBSGS was not generated with this crypto context");
+
+	auto evalSumKeys = CryptoContextImpl<Element>::GetEvalSumKeyMap(ciphertext->GetKeyTag());
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto rv = GetEncryptionAlgorithm()->EvalSumBSGS(ciphertext, batchSize, babySteps, evalSumKeys);
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalSum, currentDateTime() - start) );
+	}
+	return rv;
+}
+
 /**
  * SerializeEvalAutomorphismKey for all EvalAutomorphism keys
  * method will serialize each CryptoContext only once
@@ -808,6 +888,315 @@ bool CryptoContextImpl<Element>::DeserializeEvalAutomorphismKey(const Serialized
 	return true;
 }
 
+// reads the value of a CryptoContext member from a stream, and creates the context
+template <typename Element>
+static CryptoContext<Element> ReadCryptoContext(SerializedStreamReader& reader) {
+	Serialized value;
+	if( !reader.ReadValue(&value) )
+		return 0;
+
+	Serialized serObj(rapidjson::kObjectType);
+	serObj.AddMember("CryptoContext", SerialItem(value, serObj.GetAllocator()), serObj.GetAllocator());
+	return CryptoContextFactory<Element>::DeserializeAndCreateContext(serObj);
+}
+
+// reads the serialization of a vector or a map of pointers from a stream, and passes its members
+// to read one at a time, with their index
+static bool ReadContainerMembers(SerializedStreamReader& reader, const std::function<bool(usint,const Serialized&)>& read) {
+	if( !reader.StartObject() )
+		return false;
+
+	string name;
+	while( reader.NextMember(&name) ) {
+		if( name != "Members" ) {
+			if( !reader.SkipValue() )
+				return false;
+			continue;
+		}
+
+		if( !reader.StartObject() )
+			return false;
+		while( reader.NextMember(&name) ) {
+			Serialized member;
+			if( !reader.ReadValue(&member) || !read(std::stoi(name), member) )
+				return false;
+		}
+		if( reader.HasParseError() )
+			return false;
+	}
+	return !reader.HasParseError();
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::deserializeEvalKeys(SerializedStreamReader& reader, const string& objectName,
+		const std::function<void(std::map<usint,LPEvalKey<Element>>&)>& store) {
+	if( !reader.StartObject() )
+		return false;
+
+	// the context of a key set comes before its keys
+	CryptoContext<Element> cc;
+	string name;
+	while( reader.NextMember(&name) ) {
+		if( name == "CryptoContext" ) {
+			cc = ReadCryptoContext<Element>(reader);
+			if( cc == 0 )
+				return false;
+		}
+		else if( name == "Object" ) {
+			string object;
+			if( !reader.ReadString(&object) )
+				return false;
+			if( object != objectName && object != objectName + "OneContext" && object != objectName + "s" )
+				throw std::logic_error("Deserialize" + objectName + " passed an unknown object type " + object);
+		}
+		else if( name == objectName + "s" ) {
+			if( cc == 0 )
+				return false;
+
+			std::map<usint,LPEvalKey<Element>> keys;
+			bool read = ReadContainerMembers(reader, [&](usint i, const Serialized& kser) {
+				keys[i] = CryptoContextImpl<Element>::deserializeEvalKeyInContext(kser, cc);
+				return keys[i] != 0;
+			});
+			if( !read )
+				return false;
+			if( !keys.empty() )
+				store(keys);
+		}
+		else if( name.find_first_not_of("0123456789") == string::npos ) {
+			// one of the key sets of a serialization of all contexts
+			if( !deserializeEvalKeys(reader, objectName, store) )
+				return false;
+		}
+		else if( !reader.SkipValue() )
+			return false;
+	}
+	return !reader.HasParseError();
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::DeserializeEvalMultKey(std::istream& in) {
+	SerializedStreamReader reader(in);
+	return deserializeEvalKeys(reader, "EvalMultKey", [](std::map<usint,LPEvalKey<Element>>& keys) {
+		vector<LPEvalKey<Element>> evalMultKeys;
+		for( const auto& k : keys )
+			evalMultKeys.push_back(k.second);
+		evalMultKeyMap[evalMultKeys[0]->GetKeyTag()] = evalMultKeys;
+	});
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::DeserializeEvalSumKey(std::istream& in) {
+	SerializedStreamReader reader(in);
+	return deserializeEvalKeys(reader, "EvalSumKey", [](std::map<usint,LPEvalKey<Element>>& keys) {
+		string keyTag = keys.begin()->second->GetKeyTag();
+		evalSumKeyMap[keyTag] = std::make_shared<std::map<usint,LPEvalKey<Element>>>(std::move(keys));
+	});
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::DeserializeEvalAutomorphismKey(std::istream& in) {
+	SerializedStreamReader reader(in);
+	return deserializeEvalKeys(reader, "EvalAutomorphismKey", [](std::map<usint,LPEvalKey<Element>>& keys) {
+		string keyTag = keys.begin()->second->GetKeyTag();
+		evalAutomorphismKeyMap[keyTag] = std::make_shared<std::map<usint,LPEvalKey<Element>>>(std::move(keys));
+	});
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::SerializeCiphertexts(Serialized* serObj, const vector<Ciphertext<Element>>& ciphertexts) {
+	if( ciphertexts.empty() )
+		return false;
+
+	CryptoContext<Element> cc = ciphertexts[0]->GetCryptoContext();
+	for( const auto& ct : ciphertexts )
+		if( ct->GetCryptoContext() != cc )
+			return false;
+
+	serObj->SetObject();
+	cc->Serialize(serObj);
+	serObj->AddMember("Object", "Ciphertexts", serObj->GetAllocator());
+	SerializeVectorOfPointers<CiphertextImpl<Element>>("Ciphertexts", "Ciphertext", ciphertexts, serObj);
+	return true;
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::DeserializeCiphertexts(std::istream& in, vector<Ciphertext<Element>>* ciphertexts) {
+	ciphertexts->clear();
+
+	SerializedStreamReader reader(in);
+	if( !reader.StartObject() )
+		return false;
+
+	// the context comes before the ciphertexts
+	CryptoContext<Element> cc;
+	string name;
+	while( reader.NextMember(&name) ) {
+		if( name == "CryptoContext" ) {
+			cc = ReadCryptoContext<Element>(reader);
+			if( cc == 0 )
+				return false;
+		}
+		else if( name == "Object" ) {
+			string object;
+			if( !reader.ReadString(&object) || object != "Ciphertexts" )
+				return false;
+		}
+		else if( name == "Ciphertexts" ) {
+			if( cc == 0 )
+				return false;
+
+			bool read = ReadContainerMembers(reader, [&](usint i, const Serialized& cser) {
+				Ciphertext<Element> ct( new CiphertextImpl<Element>(cc) );
+				if( i != ciphertexts->size() || !ct->Deserialize(cser) )
+					return false;
+				ciphertexts->push_back(ct);
+				return true;
+			});
+			if( !read )
+				return false;
+		}
+		else if( !reader.SkipValue() )
+			return false;
+	}
+	return !reader.HasParseError();
+}
+
+// the key caches a key store entry belongs to
+enum EvalKeyStoreCache { STORE_EVAL_MULT = 0, STORE_EVAL_SUM = 1, STORE_EVAL_AUTOMORPHISM = 2 };
+
+// an entry of the index of a key store; offsets are from the end of the index
+struct EvalKeyStoreEntry {
+	EvalKeyStoreCache	cache;
+	string				keyTag;
+	usint				index;
+	uint64_t			offset;
+	uint64_t			size;
+};
+
+template <typename Element>
+void CryptoContextImpl<Element>::SerializeEvalKeyStore(std::ostream& out, const CryptoContext<Element> cc) {
+	// each key is written on its own, so that it can be read from the store without the others;
+	// the index comes first, so the keys are kept in memory until it is written
+	std::vector<EvalKeyStoreEntry> entries;
+	std::vector<BinaryWriter> keys;
+	uint64_t offset = 0;
+	auto addKey = [&](EvalKeyStoreCache cache, usint i, const LPEvalKey<Element> &key) {
+		keys.emplace_back(BINARY_EVAL_KEY);
+		key->SerializeBinaryWithoutContext(keys.back());
+		keys.back().FlushBits();
+		entries.push_back({ cache, key->GetKeyTag(), i, offset, keys.back().GetSize() });
+		offset += keys.back().GetSize();
+	};
+
+	for( const auto& k : evalMultKeyMap ) {
+		if( k.second[0]->GetCryptoContext() != cc )
+			continue;
+		for( usint i = 0; i < k.second.size(); i++ )
+			addKey(STORE_EVAL_MULT, i, k.second[i]);
+	}
+
+	const std::map<string,shared_ptr<std::map<usint,LPEvalKey<Element>>>> *maps[] = { &evalSumKeyMap, &evalAutomorphismKeyMap };
+	const EvalKeyStoreCache caches[] = { STORE_EVAL_SUM, STORE_EVAL_AUTOMORPHISM };
+	for( usint m = 0; m < 2; m++ ) {
+		for( const auto& k : *maps[m] ) {
+			if( k.second->empty() || k.second->begin()->second->GetCryptoContext() != cc )
+				continue;
+			for( const auto& key : *k.second )
+				addKey(caches[m], key.first, key.second);
+		}
+	}
+
+	BinaryWriter index(BINARY_EVAL_KEY_STORE);
+	cc->SerializeBinary(index);
+	index.WriteU32(entries.size());
+	for( const auto& e : entries ) {
+		index.WriteU8(e.cache);
+		index.WriteString(e.keyTag);
+		index.WriteU32(e.index);
+		index.WriteU64(e.offset);
+		index.WriteU64(e.size);
+	}
+
+	index.WriteTo(out);
+	for( auto& key : keys )
+		key.WriteTo(out);
+}
+
+template <typename Element>
+CryptoContext<Element> CryptoContextImpl<Element>::DeserializeEvalKeyStore(const string& filename) {
+	shared_ptr<const MappedFile> file = MappedFile::Open(filename);
+
+	BinaryReader index(file->GetData(), file->GetSize(), BINARY_EVAL_KEY_STORE);
+	CryptoContext<Element> cc = CryptoContextFactory<Element>::DeserializeAndCreateContext(index);
+
+	const char *keys = file->GetData() + index.GetSize();
+	size_t keysSize = file->GetSize() - index.GetSize();
+
+	std::map<string,std::vector<LPEvalKey<Element>>> multKeys;
+	std::map<string,shared_ptr<std::map<usint,LPEvalKey<Element>>>> sumKeys, automorphismKeys;
+
+	usint count = index.ReadU32();
+	for( usint n = 0; n < count; n++ ) {
+		uint8_t cache = index.ReadU8();
+		string keyTag = index.ReadString();
+		usint i = index.ReadU32();
+		uint64_t offset = index.ReadU64();
+		uint64_t size = index.ReadU64();
+		if( offset > keysSize || size > keysSize - offset )
+			PALISADE_THROW(deserialize_error, "Key store entry is out of the file");
+
+		// relinearization keys are read on first use; the other kinds are rare and read now
+		LPEvalKey<Element> key;
+		BinaryReader reader(keys + offset, size, BINARY_EVAL_KEY);
+		if( reader.PeekU8() == BINARY_EVAL_KEY_RELIN ) {
+			LPEvalKeyRelin<Element> relin( new LPEvalKeyRelinImpl<Element>(cc) );
+			relin->SetKeyTag(keyTag);
+			relin->SetDeferredBinary(keys + offset, size, file);
+			key = relin;
+		}
+		else
+			key = CryptoContextImpl<Element>::deserializeEvalKeyInContext(reader, cc);
+
+		switch( cache ) {
+		case STORE_EVAL_MULT: {
+			// the indices of a tag are dense, so none can reach the number of entries
+			if( i >= count )
+				PALISADE_THROW(deserialize_error, "Key store EvalMult key index is out of range");
+			std::vector<LPEvalKey<Element>> &v = multKeys[keyTag];
+			if( v.size() <= i )
+				v.resize(i + 1);
+			v[i] = key;
+			break;
+		}
+		case STORE_EVAL_SUM:
+		case STORE_EVAL_AUTOMORPHISM: {
+			shared_ptr<std::map<usint,LPEvalKey<Element>>> &m = cache == STORE_EVAL_SUM ? sumKeys[keyTag] : automorphismKeys[keyTag];
+			if( !m )
+				m = std::make_shared<std::map<usint,LPEvalKey<Element>>>();
+			(*m)[i] = key;
+			break;
+		}
+		default:
+			PALISADE_THROW(deserialize_error, "Unknown key cache in a key store");
+		}
+	}
+	RequireBinaryEnd(index);
+
+	for( auto& k : multKeys ) {
+		for( const auto& key : k.second )
+			if( !key )
+				PALISADE_THROW(deserialize_error, "Key store is missing an EvalMult key");
+		evalMultKeyMap[k.first] = k.second;
+	}
+	for( auto& k : sumKeys )
+		evalSumKeyMap[k.first] = k.second;
+	for( auto& k : automorphismKeys )
+		evalAutomorphismKeyMap[k.first] = k.second;
+
+	return cc;
+}
+
 template <typename Element>
 Ciphertext<Element> CryptoContextImpl<Element>::EvalAtIndex(ConstCiphertext<Element> ciphertext, int32_t index) const {
 
@@ -824,6 +1213,91 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalAtIndex(ConstCiphertext<Elem
 	return rv;
 }
 
+template <typename Element>
+shared_ptr<vector<Element>> CryptoContextImpl<Element>::EvalFastRotationPrecompute(ConstCiphertext<Element> ciphertext) const {
+
+	if( ciphertext == NULL || Mismatched(ciphertext->GetCryptoContext()) )
+		throw std::logic_error("Information passed to EvalFastRotationPrecompute was not generated with this crypto context");
+
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto rv = GetEncryptionAlgorithm()->EvalFastRotationPrecompute(ciphertext);
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalFastRotationPrecompute, currentDateTime() - start) );
+	}
+	return rv;
+}
+
+template <typename Element>
+Ciphertext<Element> CryptoContextImpl<Element>::EvalFastRotation(ConstCiphertext<Element> ciphertext, int32_t index,
+		const shared_ptr<vector<Element>> digits) const {
+
+	if( ciphertext == NULL || Mismatched(ciphertext->GetCryptoContext()) )
+		throw std::logic_error("Information passed to EvalFastRotation was not generated with this crypto context");
+
+	auto evalAutomorphismKeys = CryptoContextImpl<Element>::GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag());
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto rv = GetEncryptionAlgorithm()->EvalFastRotation(ciphertext, index, digits, evalAutomorphismKeys);
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalFastRotation, currentDateTime() - start) );
+	}
+	return rv;
+}
+
+template <typename Element>
+LinearTransformDiagonals CryptoContextImpl<Element>::EvalLinearTransformPrecompute(const vector<vector<int64_t>> &diagonals,
+		usint babySteps) const {
+
+	usint m = GetCyclotomicOrder();
+	if( m & (m-1) )
+		throw std::logic_error("EvalLinearTransform is only supported for power-of-two cyclotomics");
+
+	// the slots are two rows of n/2, which rotations shift cyclically
+	usint slots = GetRingDimension();
+	usint dimension = diagonals.size();
+	babySteps = LPSHEAlgorithm<Element>::LinearTransformBabySteps(dimension, babySteps);
+	if( (slots/2) % dimension != 0 )
+		throw std::logic_error("EvalLinearTransform: the dimension " + std::to_string(dimension) +
+				" does not divide the rotation length " + std::to_string(slots/2));
+
+	LinearTransformDiagonals encoded;
+	encoded.diagonals.resize(dimension);
+	encoded.babySteps = babySteps;
+	encoded.cyclotomicOrder = m;
+	encoded.slots = slots;
+	vector<int64_t> values(slots);
+	for( usint k = 0; k < dimension; k++ ) {
+		if( diagonals[k].size() != dimension )
+			throw std::logic_error("EvalLinearTransform: diagonal " + std::to_string(k) + " should have " +
+					std::to_string(dimension) + " elements");
+		// diagonal k is used in giant step k/babySteps, before the rotation by that step
+		usint shift = dimension - (k - k % babySteps) % dimension;
+		for( usint s = 0; s < slots; s++ )
+			values[s] = diagonals[k][(s + shift) % dimension];
+		encoded.diagonals[k] = MakePackedPlaintext(values);
+		encoded.diagonals[k]->SetFormat(EVALUATION);
+	}
+	return encoded;
+}
+
+template <typename Element>
+Ciphertext<Element> CryptoContextImpl<Element>::EvalLinearTransform(ConstCiphertext<Element> ciphertext,
+		const LinearTransformDiagonals &diagonals) const {
+
+	if( ciphertext == NULL || Mismatched(ciphertext->GetCryptoContext()) )
+		throw std::logic_error("Information passed to EvalLinearTransform was not generated with this crypto context");
+
+	auto evalAutomorphismKeys = CryptoContextImpl<Element>::GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag());
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto rv = GetEncryptionAlgorithm()->EvalLinearTransform(ciphertext, diagonals, evalAutomorphismKeys);
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalLinearTransform, currentDateTime() - start) );
+	}
+	return rv;
+}
+
 template <typename Element>
 Ciphertext<Element> CryptoContextImpl<Element>::EvalMerge(const vector<Ciphertext<Element>> &ciphertextVector) const {
 
@@ -859,6 +1333,26 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalInnerProduct(ConstCiphertext
 	return rv;
 }
 
+template <typename Element>
+Ciphertext<Element> CryptoContextImpl<Element>::EvalInnerProductBSGS(ConstCiphertext<Element> ct1, ConstCiphertext<Element> ct2,
+		usint batchSize, usint babySteps) const {
+
+	if( ct1 == NULL || ct2 == NULL || ct1->GetKeyTag() != ct2->GetKeyTag() ||
+			Mismatched(ct1->GetCryptoContext()) )
+		throw std::logic_error("Information passed to EvalInnerProductBSGS was not generated with this crypto context");
+
+	auto evalSumKeys = CryptoContextImpl<Element>::GetEvalSumKeyMap(ct1->GetKeyTag());
+	auto ek = GetEvalMultKeyVector(ct1->GetKeyTag());
+
+	double start = 0;
+	if( doTiming ) start = currentDateTime();
+	auto rv = GetEncryptionAlgorithm()->EvalInnerProductBSGS(ct1, ct2, batchSize, babySteps, evalSumKeys, ek[0]);
+	if( doTiming ) {
+		timeSamples->push_back( TimingInfo(OpEvalInnerProduct, currentDateTime() - start) );
+	}
+	return rv;
+}
+
 template <typename Element>
 Ciphertext<Element> CryptoContextImpl<Element>::EvalInnerProduct(ConstCiphertext<Element> ct1, ConstPlaintext ct2, usint batchSize) const {
 
@@ -936,6 +1430,28 @@ CryptoContextImpl<Element>::Serialize(Serialized* serObj) const
 	return true;
 }
 
+template <typename Element>
+void
+CryptoContextImpl<Element>::SerializeBinary(BinaryWriter &writer) const
+{
+	// the parameters are small next to the elements of the objects, so they are kept as compact JSON
+	Serialized serObj;
+	string json;
+	if( !Serialize(&serObj) || !SerializableHelper::SerializationToString(serObj, json) )
+		PALISADE_THROW(serialize_error, "Unable to serialize the crypto context");
+
+	writer.WriteString(json);
+}
+
+template <typename Element>
+void
+CryptoContextImpl<Element>::SerializeBinary(std::ostream &out) const
+{
+	BinaryWriter writer(BINARY_CRYPTO_CONTEXT);
+	SerializeBinary(writer);
+	writer.WriteTo(out);
+}
+
 template <typename Element>
 bool CryptoObject<Element>::SerializeCryptoObject(Serialized* serObj, bool includeContext) const
 {
@@ -1147,6 +1663,25 @@ CryptoContextFactory<Element>::DeserializeAndCreateContext(const Serialized& ser
 	return cc;
 }
 
+template <typename Element>
+CryptoContext<Element>
+CryptoContextFactory<Element>::DeserializeAndCreateContext(BinaryReader &reader) {
+	Serialized serObj;
+	if( !SerializableHelper::StringToSerialization(reader.ReadString(), &serObj) )
+		PALISADE_THROW(deserialize_error, "Malformed crypto context in a binary object");
+
+	return DeserializeAndCreateContext(serObj);
+}
+
+template <typename Element>
+CryptoContext<Element>
+CryptoContextFactory<Element>::DeserializeAndCreateContextBinary(std::istream &in) {
+	BinaryReader reader(in, BINARY_CRYPTO_CONTEXT);
+	CryptoContext<Element> cc = DeserializeAndCreateContext(reader);
+	RequireBinaryEnd(reader);
+	return cc;
+}
+
 // factory methods for the different schemes
 
 template <typename T>
@@ -1916,5 +2451,248 @@ CryptoContextImpl<T>::deserializeEvalKeyInContext(const Serialized& serObj, Cryp
 	return key;
 }
 
+// binary objects start with their context, so they are deserialized the same way as above
+
+template <typename T>
+LPPublicKey<T>
+CryptoContextImpl<T>::deserializePublicKeyBinary(std::istream &in)
+{
+	BinaryReader reader(in, BINARY_PUBLIC_KEY);
+	CryptoContext<T> cc = CryptoContextFactory<T>::DeserializeAndCreateContext(reader);
+
+	LPPublicKey<T> key( new LPPublicKeyImpl<T>(cc) );
+	key->DeserializeBinary(reader);
+	RequireBinaryEnd(reader);
+	return key;
+}
+
+template <typename T>
+LPPrivateKey<T>
+CryptoContextImpl<T>::deserializeSecretKeyBinary(std::istream &in)
+{
+	BinaryReader reader(in, BINARY_PRIVATE_KEY);
+	CryptoContext<T> cc = CryptoContextFactory<T>::DeserializeAndCreateContext(reader);
+
+	LPPrivateKey<T> key( new LPPrivateKeyImpl<T>(cc) );
+	key->DeserializeBinary(reader);
+	RequireBinaryEnd(reader);
+	return key;
+}
+
+template <typename T>
+Ciphertext<T>
+CryptoContextImpl<T>::deserializeCiphertextBinary(std::istream &in)
+{
+	BinaryReader reader(in, BINARY_CIPHERTEXT);
+	CryptoContext<T> cc = CryptoContextFactory<T>::DeserializeAndCreateContext(reader);
+
+	Ciphertext<T> ctxt( new CiphertextImpl<T>(cc) );
+	ctxt->DeserializeBinary(reader);
+	RequireBinaryEnd(reader);
+	return ctxt;
 }
 
+template <typename T>
+LPEvalKey<T>
+CryptoContextImpl<T>::deserializeEvalKeyBinary(std::istream &in)
+{
+	BinaryReader reader(in, BINARY_EVAL_KEY);
+	CryptoContext<T> cc = CryptoContextFactory<T>::DeserializeAndCreateContext(reader);
+
+	LPEvalKey<T> key = CryptoContextImpl<T>::deserializeEvalKeyInContext(reader, cc);
+	RequireBinaryEnd(reader);
+	return key;
+}
+
+template <typename T>
+LPEvalKey<T>
+CryptoContextImpl<T>::deserializeEvalKeyInContext(BinaryReader &reader, CryptoContext<T> cc)
+{
+	LPEvalKey<T> key;
+	switch( reader.PeekU8() ) {
+	case BINARY_EVAL_KEY_RELIN:
+		key.reset( new LPEvalKeyRelinImpl<T>(cc) );
+		break;
+	case BINARY_EVAL_KEY_NTRU_RELIN:
+		key.reset( new LPEvalKeyNTRURelinImpl<T>(cc) );
+		break;
+	case BINARY_EVAL_KEY_NTRU:
+		key.reset( new LPEvalKeyNTRUImpl<T>(cc) );
+		break;
+	default:
+		PALISADE_THROW(deserialize_error, "Unrecognized binary Eval Key type");
+	}
+
+	key->DeserializeBinary(reader);
+	return key;
+}
+
+template <typename Element>
+size_t CryptoContextImpl<Element>::EncryptStreamArchive(
+		const LPPublicKey<Element> publicKey,
+		std::istream& instream,
+		std::ostream& outstream) const
+{
+	// NOTE timing this operation is not supported
+
+	if( publicKey == NULL || Mismatched(publicKey->GetCryptoContext()) )
+		throw std::logic_error("key passed to EncryptStreamArchive was not generated with this crypto context");
+
+	// the archive is written in one pass, so the table of offsets follows the ciphertexts
+	BinaryWriter header(BINARY_CIPHERTEXT_ARCHIVE);
+	this->SerializeBinary(header);
+	header.WriteTo(outstream);
+
+	vector<uint64_t> offsets;
+	uint64_t offset = header.GetSize();
+
+	// the input is cut into chunks as in EncryptStream
+	bool padded = false;
+	size_t chunkSize = this->GetRingDimension();
+	std::vector<char> ptxt(chunkSize);
+
+	while (instream.good()) {
+		instream.read(ptxt.data(), chunkSize);
+		size_t nRead = instream.gcount();
+
+		if (nRead <= 0 && padded)
+			break;
+
+		Plaintext px = this->MakeStringPlaintext(std::string(ptxt.data(),nRead));
+
+		if (nRead < chunkSize) {
+			padded = true;
+		}
+
+		Ciphertext<Element> ciphertext = GetEncryptionAlgorithm()->Encrypt(publicKey, px->GetElement<Element>());
+		if (!ciphertext)
+			PALISADE_THROW(serialize_error, "Encryption failed while writing a ciphertext archive");
+		ciphertext->SetEncodingType( px->GetEncodingType() );
+
+		BinaryWriter writer(BINARY_CIPHERTEXT);
+		ciphertext->SerializeBinaryWithoutContext(writer);
+		writer.WriteTo(outstream);
+
+		offsets.push_back(offset);
+		offset += writer.GetSize();
+	}
+
+	BinaryWriter index(BINARY_CIPHERTEXT_ARCHIVE_INDEX);
+	index.WriteU64(offsets.size());
+	for( uint64_t o : offsets )
+		index.WriteU64(o);
+	index.WriteTo(outstream);
+
+	BinaryWriter end(BINARY_CIPHERTEXT_ARCHIVE_END);
+	end.WriteU64(offset);
+	end.WriteTo(outstream);
+
+	return offsets.size();
+}
+
+template <typename Element>
+size_t CryptoContextImpl<Element>::DecryptArchive(
+		const LPPrivateKey<Element> privateKey,
+		const CiphertextArchive<Element>& archive,
+		size_t first,
+		size_t count,
+		std::ostream& outstream)
+{
+	// NOTE timing this operation is not supported
+
+	// as in DecryptStream, the ciphertexts are decrypted with the parameters of this context: the context
+	// deserialized with the archive may be a distinct copy of it
+	if( privateKey == NULL || Mismatched(privateKey->GetCryptoContext()) )
+		throw std::logic_error("Information passed to DecryptArchive was not generated with this crypto context");
+
+	if( first > archive.GetCount() || count > archive.GetCount() - first )
+		throw std::logic_error("Range passed to DecryptArchive is out of the archive");
+
+	size_t tot = 0;
+	for( size_t i = first; i < first + count; i++ ) {
+		Ciphertext<Element> ct = archive.GetCiphertext(i);
+		if( ct->GetEncodingType() != String ) {
+			throw std::logic_error("Library can only stream string encodings");
+		}
+
+		Plaintext pt = GetPlaintextForDecrypt(ct->GetEncodingType(), this->GetElementParams(), this->GetEncodingParams());
+		DecryptResult res = GetEncryptionAlgorithm()->Decrypt(privateKey, ct, &pt->GetElement<NativePoly>());
+		if( !res.isValid )
+			return tot;
+		tot += res.messageLength;
+
+		pt->Decode();
+		outstream << pt->GetStringValue();
+	}
+
+	return tot;
+}
+
+template <typename Element>
+CiphertextArchive<Element>::CiphertextArchive(const string& filename) {
+	m_file = MappedFile::Open(filename);
+	const char *data = m_file->GetData();
+	size_t size = m_file->GetSize();
+
+	BinaryReader header(data, size, BINARY_CIPHERTEXT_ARCHIVE);
+	m_context = CryptoContextFactory<Element>::DeserializeAndCreateContext(header);
+	RequireBinaryEnd(header);
+
+	// the offset of the table is in the fixed-size object that ends the archive
+	const size_t endSize = BINARY_HEADER_SIZE + sizeof(uint64_t);
+	if( size < header.GetSize() + endSize )
+		PALISADE_THROW(deserialize_error, "Ciphertext archive is truncated");
+	BinaryReader end(data + size - endSize, endSize, BINARY_CIPHERTEXT_ARCHIVE_END);
+	uint64_t indexOffset = end.ReadU64();
+	if( indexOffset < header.GetSize() || indexOffset > size - endSize )
+		PALISADE_THROW(deserialize_error, "Ciphertext archive table is out of the file");
+
+	BinaryReader index(data + indexOffset, size - endSize - indexOffset, BINARY_CIPHERTEXT_ARCHIVE_INDEX);
+	uint64_t count = index.ReadU64();
+	if( count > (index.GetSize() - BINARY_HEADER_SIZE)/sizeof(uint64_t) )
+		PALISADE_THROW(deserialize_error, "Ciphertext archive table is truncated");
+	m_offsets.resize(count + 1);
+	for( uint64_t i = 0; i < count; i++ )
+		m_offsets[i] = index.ReadU64();
+	m_offsets[count] = indexOffset;
+	RequireBinaryEnd(index);
+
+	for( uint64_t i = 0; i < count; i++ )
+		if( m_offsets[i] < header.GetSize() || m_offsets[i] > m_offsets[i+1] )
+			PALISADE_THROW(deserialize_error, "Ciphertext archive entry is out of the file");
+}
+
+template <typename Element>
+Ciphertext<Element> CiphertextArchive<Element>::GetCiphertext(size_t i) const {
+	if( i >= GetCount() )
+		PALISADE_THROW(deserialize_error, "Ciphertext " + std::to_string(i) + " is out of the archive");
+
+	BinaryReader reader(m_file->GetData() + m_offsets[i], m_offsets[i+1] - m_offsets[i], BINARY_CIPHERTEXT);
+	Ciphertext<Element> ciphertext( new CiphertextImpl<Element>(m_context) );
+	ciphertext->DeserializeBinary(reader);
+	RequireBinaryEnd(reader);
+	return ciphertext;
+}
+
+template <typename Element>
+vector<Ciphertext<Element>> CiphertextArchive<Element>::GetCiphertexts(size_t first, size_t count) const {
+	if( first > GetCount() || count > GetCount() - first )
+		PALISADE_THROW(deserialize_error, "Ciphertext range is out of the archive");
+
+	// the ciphertexts are independent
+	vector<Ciphertext<Element>> ciphertexts(count);
+	ParallelException error;
+#pragma omp parallel for
+	for( size_t i = 0; i < count; i++ ) {
+		try {
+			ciphertexts[i] = GetCiphertext(first + i);
+		}
+		catch( ... ) {
+			error.Capture();
+		}
+	}
+	error.Rethrow();
+	return ciphertexts;
+}
+
+}
@@ -32,6 +32,7 @@
 #include "palisade.h"
 #include "cryptocontexthelper.h"
 #include "cryptotiming.h"
+#include "utils/mappedfile.h"
 
 namespace lbcrypto {
 
@@ -44,6 +45,9 @@ class CryptoContextImpl;
 template<typename Element>
 using CryptoContext = shared_ptr<CryptoContextImpl<Element>>;
 
+template<typename Element>
+class CiphertextArchive;
+
 /**
  * @brief CryptoContextImpl
  *
@@ -298,6 +302,22 @@ public:
 		throw std::logic_error("Deserialize by using CryptoContextFactory::DeserializeAndCreateContext");
 	}
 
+	/**
+	 * Writes the CryptoContextImpl into a binary object, for objects that are written with their context
+	 *
+	 * @param writer - the binary object being written
+	 * @throws serialize_error if the parameters cannot be serialized
+	 */
+	void SerializeBinary(BinaryWriter &writer) const;
+
+	/**
+	 * Writes the CryptoContextImpl in the compact binary format
+	 *
+	 * @param out - the stream
+	 * @throws serialize_error if the parameters cannot be serialized
+	 */
+	void SerializeBinary(std::ostream &out) const;
+
 	/**
 	 * SerializeEvalMultKey for all EvalMult keys
 	 * method will serialize each CryptoContextImpl only once
@@ -337,6 +357,18 @@ public:
 	 */
 	static bool DeserializeEvalMultKey(const Serialized& serObj);
 
+	/**
+	 * DeserializeEvalMultKey deserialize all keys in a serialization read from a stream
+	 * the stream is parsed incrementally and each key is deserialized as soon as it is read,
+	 * so that the whole serialization is never held in memory
+	 * deserialized keys silently replace any existing matching keys
+	 * deserialization will create CryptoContextImpl if necessary
+	 *
+	 * @param in - stream with a serialization made by SerializeEvalMultKey
+	 * @return true on success
+	 */
+	static bool DeserializeEvalMultKey(std::istream& in);
+
 	/**
 	 * ClearEvalMultKeys - flush EvalMultKey cache
 	 */
@@ -399,6 +431,18 @@ public:
 	 */
 	static bool DeserializeEvalSumKey(const Serialized& serObj);
 
+	/**
+	 * DeserializeEvalSumKey deserialize all keys in a serialization read from a stream
+	 * the stream is parsed incrementally and each key is deserialized as soon as it is read,
+	 * so that the whole serialization is never held in memory
+	 * deserialized keys silently replace any existing matching keys
+	 * deserialization will create CryptoContextImpl if necessary
+	 *
+	 * @param in - stream with a serialization made by SerializeEvalSumKey
+	 * @return true on success
+	 */
+	static bool DeserializeEvalSumKey(std::istream& in);
+
 	/**
 	 * ClearEvalSumKeys - flush EvalSumKey cache
 	 */
@@ -461,6 +505,18 @@ public:
 	 */
 	static bool DeserializeEvalAutomorphismKey(const Serialized& serObj);
 
+	/**
+	 * DeserializeEvalAutomorphismKey deserialize all keys in a serialization read from a stream
+	 * the stream is parsed incrementally and each key is deserialized as soon as it is read,
+	 * so that the whole serialization is never held in memory
+	 * deserialized keys silently replace any existing matching keys
+	 * deserialization will create CryptoContextImpl if necessary
+	 *
+	 * @param in - stream with a serialization made by SerializeEvalAutomorphismKey
+	 * @return true on success
+	 */
+	static bool DeserializeEvalAutomorphismKey(std::istream& in);
+
 	/**
 	 * ClearEvalAutomorphismKeys - flush EvalAutomorphismKey cache
 	 */
@@ -484,6 +540,52 @@ public:
 	 */
 	static void InsertEvalAutomorphismKey(const shared_ptr<std::map<usint,LPEvalKey<Element>>> mapToInsert);
 
+	/**
+	 * SerializeEvalKeyStore writes all EvalMult, EvalSum and EvalAutomorphism keys made in a given
+	 * context into a key store, in the compact binary format: the context and an index of the keys,
+	 * then each key as a separate binary object
+	 *
+	 * @param out - the stream, usually a file opened in binary mode
+	 * @param cc whose keys should be written
+	 * @throws serialize_error if the keys cannot be written
+	 */
+	static void SerializeEvalKeyStore(std::ostream& out, const CryptoContext<Element> cc);
+
+	/**
+	 * DeserializeEvalKeyStore maps a key store file into memory and adds its keys to the EvalMult,
+	 * EvalSum and EvalAutomorphism key caches; loaded keys silently replace any existing matching keys.
+	 * Only the index is read: each relinearization key is read from the mapping on its first use,
+	 * so that loading takes the same time whatever the number of keys.
+	 * The mapping is released once all its keys are read or dropped.
+	 *
+	 * @param filename - the key store file
+	 * @return the context of the keys, created if necessary
+	 * @throws deserialize_error if the file cannot be mapped or the store is malformed
+	 */
+	static CryptoContext<Element> DeserializeEvalKeyStore(const string& filename);
+
+	/**
+	 * SerializeCiphertexts serializes a vector of ciphertexts made in the same context
+	 * method will serialize the context only once
+	 *
+	 * @param serObj - serialization
+	 * @param ciphertexts to serialize
+	 * @return true on success (false on failure or no ciphertexts)
+	 */
+	static bool SerializeCiphertexts(Serialized* serObj, const vector<Ciphertext<Element>>& ciphertexts);
+
+	/**
+	 * DeserializeCiphertexts deserialize a vector of ciphertexts from a stream
+	 * the stream is parsed incrementally and each ciphertext is deserialized as soon as it is read,
+	 * so that the whole serialization is never held in memory
+	 * deserialization will create CryptoContextImpl if necessary
+	 *
+	 * @param in - stream with a serialization made by SerializeCiphertexts
+	 * @param ciphertexts - receives the ciphertexts
+	 * @return true on success
+	 */
+	static bool DeserializeCiphertexts(std::istream& in, vector<Ciphertext<Element>>* ciphertexts);
+
 
 	// TURN FEATURES ON
 	/**
@@ -1026,6 +1128,21 @@ public:
 		return;
 	}
 
+	/**
+	* Perform an encryption by reading plaintext from a stream, like EncryptStream, and write the ciphertexts
+	* to an archive: the context, each ciphertext in the compact binary format, then a table of their offsets,
+	* so that any range of ciphertexts can be read back with CiphertextArchive without reading the others
+	* @param publicKey - the encryption key in use
+	* @param instream - where to read the input from
+	* @param outstream - where to write the archive to, usually a file opened in binary mode
+	* @return the number of ciphertexts written
+	* @throws serialize_error if the archive cannot be written
+	*/
+	size_t EncryptStreamArchive(
+		const LPPublicKey<Element> publicKey,
+		std::istream& instream,
+		std::ostream& outstream) const;
+
 	// PLAINTEXT FACTORY METHODS
 	// FIXME to be deprecated in 2.0
 	/**
@@ -1412,6 +1529,23 @@ public:
 		return tot;
 	}
 
+	/**
+	* decrypt a range of the ciphertexts of an archive written by EncryptStreamArchive, and write the plaintext to outstream;
+	* only the ciphertexts in the range are read from the archive
+	* @param privateKey - reference to the decryption key
+	* @param archive - the archive
+	* @param first - index of the first ciphertext to decrypt
+	* @param count - number of ciphertexts to decrypt
+	* @param outstream - output stream for plaintext
+	* @return total bytes processed
+	*/
+	size_t DecryptArchive(
+		const LPPrivateKey<Element> privateKey,
+		const CiphertextArchive<Element>& archive,
+		size_t first,
+		size_t count,
+		std::ostream& outstream);
+
 	/**
 	* ReEncrypt - Proxy Re Encryption mechanism for PALISADE
 	* @param evalKey - evaluation key from the PRE keygen method
@@ -1750,6 +1884,31 @@ public:
 
 	}
 
+	/**
+	* Relinearize - PALISADE function for reducing a ciphertext to two elements by key switching.
+	* Together with EvalMultNoRelin, it lets a sum of products, such as an inner product, be
+	* computed with a single relinearization at the end: EvalAdd and EvalSub accept ciphertexts
+	* with different numbers of elements.
+	*
+	* @param ct the ciphertext, for instance a sum of results of EvalMultNoRelin.
+	*
+	* @return new ciphertext with two elements.
+	*/
+	Ciphertext<Element> Relinearize(ConstCiphertext<Element> ct) const {
+		if (ct == NULL || Mismatched(ct->GetCryptoContext()) )
+			throw std::logic_error("Information passed to Relinearize was not generated with this crypto context");
+
+		const auto ek = GetEvalMultKeyVector(ct->GetKeyTag());
+
+		TimeVar t;
+		if( doTiming ) TIC(t);
+		auto rv = GetEncryptionAlgorithm()->Relinearize(ct, ek);
+		if( doTiming ) {
+			timeSamples->push_back( TimingInfo(OpRelinearize, TOC_US(t)) );
+		}
+		return rv;
+	}
+
 	/**
 	 * EvalMult - PALISADE EvalMult method for plaintext * ciphertext
 	 * @param pt2
@@ -1988,6 +2147,31 @@ public:
 	*/
 	Ciphertext<Element> EvalSum(ConstCiphertext<Element> ciphertext, usint batchSize) const;
 
+	/**
+	* EvalSumKeyGenBSGS Generates the key map to be used by EvalSumBSGS; the keys are added to
+	* the EvalSum keys of the private key, if any
+	*
+	* @param privateKey private key.
+	* @param babySteps number of baby steps, a power of two; babySteps - 1 keys replace log2(babySteps) keys of EvalSum.
+	* @param publicKey public key (used in NTRU schemes).
+	*/
+	void EvalSumKeyGenBSGS(
+		const LPPrivateKey<Element> privateKey,
+		usint babySteps,
+		const LPPublicKey<Element> publicKey = nullptr);
+
+	/**
+	* Function for evaluating a sum of all components, like EvalSum, with the baby-step giant-step
+	* method: a round of babySteps - 1 hoisted rotations, which run in parallel, replaces
+	* log2(babySteps) sequential rotations of EvalSum
+	*
+	* @param ciphertext the input ciphertext.
+	* @param batchSize size of the batch
+	* @param babySteps number of baby steps, as passed to EvalSumKeyGenBSGS.
+	* @return resulting ciphertext
+	*/
+	Ciphertext<Element> EvalSumBSGS(ConstCiphertext<Element> ciphertext, usint batchSize, usint babySteps) const;
+
 	/**
 	* EvalSumKeyGen Generates the key map to be used by evalsum
 	*
@@ -2026,6 +2210,77 @@ public:
 	*/
 	Ciphertext<Element> EvalAtIndex(ConstCiphertext<Element> ciphertext, int32_t index) const;
 
+	/**
+	* Precomputes the digit decomposition of a ciphertext for several rotations of it with
+	* EvalFastRotation (hoisted rotations), so that it is decomposed only once
+	*
+	* @param ciphertext the ciphertext to be rotated.
+	* @return the digits of the ciphertext
+	*/
+	shared_ptr<vector<Element>> EvalFastRotationPrecompute(ConstCiphertext<Element> ciphertext) const;
+
+	/**
+	* Moves i-th slot to slot 0, like EvalAtIndex, using the digits precomputed by
+	* EvalFastRotationPrecompute for the same ciphertext
+	*
+	* @param ciphertext the ciphertext, as passed to EvalFastRotationPrecompute.
+	* @param index the index.
+	* @param digits the digits computed by EvalFastRotationPrecompute.
+	* @return resulting ciphertext
+	*/
+	Ciphertext<Element> EvalFastRotation(ConstCiphertext<Element> ciphertext, int32_t index,
+		const shared_ptr<vector<Element>> digits) const;
+
+	/**
+	* EvalLinearTransformKeyGen Generates the rotation keys used by EvalLinearTransform; they are
+	* added to the EvalAtIndex keys of the private key, if any
+	*
+	* @param privateKey private key.
+	* @param dimension the dimension of the transform.
+	* @param babySteps number of baby steps; 0 selects ceil(sqrt(dimension)).
+	* @param publicKey public key (used in NTRU schemes).
+	*/
+	void EvalLinearTransformKeyGen(const LPPrivateKey<Element> privateKey, usint dimension,
+		usint babySteps = 0, const LPPublicKey<Element> publicKey = nullptr);
+
+	/**
+	* Encodes the diagonals of a matrix for EvalLinearTransform, once for several products:
+	* the diagonals are repeated in all the slots, rotated for the giant steps and switched to
+	* EVALUATION format. Works only for power-of-two cyclotomics.
+	*
+	* @param diagonals the diagonals of a dimension x dimension matrix M: diagonals[k][i] = M[i][(i+k) % dimension].
+	* The dimension should divide half the ring dimension (the length of a rotation).
+	* @param babySteps number of baby steps; 0 selects ceil(sqrt(dimension)).
+	* @return the encoded diagonals, with the number of baby steps and the slot layout they are encoded for
+	*/
+	LinearTransformDiagonals EvalLinearTransformPrecompute(const vector<vector<int64_t>> &diagonals, usint babySteps = 0) const;
+
+	/**
+	* Multiplies an encrypted vector by a plaintext matrix with the diagonal method and
+	* baby-step giant-step rotations. The vector should be repeated with period dimension
+	* in the slots; so is the result.
+	*
+	* @param ciphertext the input vector.
+	* @param diagonals the diagonals of the matrix, encoded by EvalLinearTransformPrecompute.
+	* @return resulting ciphertext
+	* @throws config_error if the diagonals were encoded for other parameters.
+	*/
+	Ciphertext<Element> EvalLinearTransform(ConstCiphertext<Element> ciphertext,
+		const LinearTransformDiagonals &diagonals) const;
+
+	/**
+	* Multiplies an encrypted vector by a plaintext matrix given by its diagonals, encoding them first
+	*
+	* @param ciphertext the input vector.
+	* @param diagonals the diagonals of the matrix, as passed to EvalLinearTransformPrecompute.
+	* @param babySteps number of baby steps; 0 selects ceil(sqrt(dimension)).
+	* @return resulting ciphertext
+	*/
+	Ciphertext<Element> EvalLinearTransform(ConstCiphertext<Element> ciphertext,
+		const vector<vector<int64_t>> &diagonals, usint babySteps = 0) const {
+		return EvalLinearTransform(ciphertext, EvalLinearTransformPrecompute(diagonals, babySteps));
+	}
+
 	/**
 	* Evaluates inner product in batched encoding
 	*
@@ -2046,6 +2301,18 @@ public:
 	*/
 	Ciphertext<Element> EvalInnerProduct(ConstCiphertext<Element> ciphertext1, ConstPlaintext ciphertext2, usint batchSize) const;
 
+	/**
+	* Evaluates inner product in batched encoding, summing the products with EvalSumBSGS
+	*
+	* @param ciphertext1 first vector.
+	* @param ciphertext2 second vector.
+	* @param batchSize size of the batch to be summed up
+	* @param babySteps number of baby steps, as passed to EvalSumKeyGenBSGS.
+	* @return resulting ciphertext
+	*/
+	Ciphertext<Element> EvalInnerProductBSGS(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+		usint batchSize, usint babySteps) const;
+
 	/**
 	* EvalCrossCorrelation - Computes the sliding sum of inner products (known as
 	* as cross-correlation, sliding inner product, or sliding dot product in
@@ -2288,6 +2555,57 @@ public:
 	* @return deserialized object
 	*/
 	static LPEvalKey<Element>		deserializeEvalKeyInContext(const Serialized& serObj, CryptoContext<Element> cc);
+
+	/**
+	* Deserialize the eval keys of a serialization read from a stream, one key at a time
+	* @param reader the stream, positioned at the start of a serialization made by Serialize<objectName>
+	* @param objectName the name of the object, EvalMultKey, EvalSumKey or EvalAutomorphismKey
+	* @param store called with the keys of each map or vector of keys, by index
+	* @return true on success
+	*/
+	static bool deserializeEvalKeys(SerializedStreamReader& reader, const string& objectName,
+			const std::function<void(std::map<usint,LPEvalKey<Element>>&)>& store);
+
+	/**
+	* Deserialize a Public Key written in the compact binary format
+	* @param in - the stream
+	* @return deserialized object
+	* @throws deserialize_error if the object is malformed
+	*/
+	static LPPublicKey<Element>	deserializePublicKeyBinary(std::istream &in);
+
+	/**
+	* Deserialize a Private Key written in the compact binary format
+	* @param in - the stream
+	* @return deserialized object
+	* @throws deserialize_error if the object is malformed
+	*/
+	static LPPrivateKey<Element>	deserializeSecretKeyBinary(std::istream &in);
+
+	/**
+	* Deserialize a Ciphertext written in the compact binary format
+	* @param in - the stream
+	* @return deserialized object
+	* @throws deserialize_error if the object is malformed
+	*/
+	static Ciphertext<Element>		deserializeCiphertextBinary(std::istream &in);
+
+	/**
+	* Deserialize an Eval Key written in the compact binary format
+	* @param in - the stream
+	* @return deserialized object
+	* @throws deserialize_error if the object is malformed
+	*/
+	static LPEvalKey<Element>		deserializeEvalKeyBinary(std::istream &in);
+
+	/**
+	* Deserialize an Eval Key written in the compact binary format without its context
+	* @param reader - the binary object being read, positioned at the key
+	* @param cc - the context of the key
+	* @return deserialized object
+	* @throws deserialize_error if the object is malformed
+	*/
+	static LPEvalKey<Element>		deserializeEvalKeyInContext(BinaryReader &reader, CryptoContext<Element> cc);
 };
 
 /**
@@ -2309,10 +2627,7 @@ public:
 		keyTag = rhs.keyTag;
 	}
 
-	CryptoObject(const CryptoObject&& rhs) {
-		context = std::move(rhs.context);
-		keyTag = std::move(rhs.keyTag);
-	}
+	CryptoObject(CryptoObject&& rhs) : context(std::move(rhs.context)), keyTag(std::move(rhs.keyTag)) {}
 
 	virtual ~CryptoObject() {}
 
@@ -2322,7 +2637,7 @@ public:
 		return *this;
 	}
 
-	const CryptoObject& operator=(const CryptoObject&& rhs) {
+	const CryptoObject& operator=(CryptoObject&& rhs) {
 		this->context = std::move(rhs.context);
 		this->keyTag = std::move(rhs.keyTag);
 		return *this;
@@ -2356,6 +2671,18 @@ public:
 	* @return true on success
 	*/
 	bool DeserializeCryptoObject(const Serialized& serObj, bool includesContext = true);
+
+	/**
+	* SerializeBinaryCryptoObject writes this header, without the context, into a binary object
+	* @param writer the binary object being written
+	*/
+	void SerializeBinaryCryptoObject(BinaryWriter &writer) const { writer.WriteString(keyTag); }
+
+	/**
+	* DeserializeBinaryCryptoObject populates this header from a binary object
+	* @param reader the binary object being read
+	*/
+	void DeserializeBinaryCryptoObject(BinaryReader &reader) { keyTag = reader.ReadString(); }
 };
 
 /**
@@ -2796,6 +3123,76 @@ public:
 	* @return new context
 	*/
 	static CryptoContext<Element> DeserializeAndCreateContext(const Serialized& serObj);
+
+	/**
+	* Create a PALISADE CryptoContextImpl from the context at the start of a binary object
+	* @param reader - the binary object being read
+	* @return new context
+	* @throws deserialize_error if the context is malformed
+	*/
+	static CryptoContext<Element> DeserializeAndCreateContext(BinaryReader &reader);
+
+	/**
+	* Create a PALISADE CryptoContextImpl written in the compact binary format
+	* @param in - the stream
+	* @return new context
+	* @throws deserialize_error if the context is malformed
+	*/
+	static CryptoContext<Element> DeserializeAndCreateContextBinary(std::istream &in);
+};
+
+/**
+* @brief CiphertextArchive
+*
+* An archive of ciphertexts written by CryptoContextImpl::EncryptStreamArchive, mapped into memory
+*
+* The archive holds the context, each ciphertext in the compact binary format, a table of the offsets of the
+* ciphertexts, and the offset of the table. Only the context and the table are read when the archive is opened;
+* a ciphertext is read from the mapping when it is asked for, so that reading a range of ciphertexts takes
+* the same time whatever the size of the archive
+*/
+template<typename Element>
+class CiphertextArchive {
+public:
+	/**
+	* Map an archive into memory
+	* @param filename - the archive file
+	* @throws deserialize_error if the file cannot be mapped or the archive is malformed
+	*/
+	explicit CiphertextArchive(const string& filename);
+
+	/**
+	* @return the context of the ciphertexts, created if necessary
+	*/
+	CryptoContext<Element> GetCryptoContext() const { return m_context; }
+
+	/**
+	* @return the number of ciphertexts in the archive
+	*/
+	size_t GetCount() const { return m_offsets.size() - 1; }
+
+	/**
+	* Read a ciphertext from the archive
+	* @param i - the index of the ciphertext
+	* @return the ciphertext
+	* @throws deserialize_error if the index is out of range or the ciphertext is malformed
+	*/
+	Ciphertext<Element> GetCiphertext(size_t i) const;
+
+	/**
+	* Read a range of ciphertexts from the archive
+	* @param first - the index of the first ciphertext
+	* @param count - the number of ciphertexts
+	* @return the ciphertexts
+	* @throws deserialize_error if the range is out of the archive or a ciphertext is malformed
+	*/
+	vector<Ciphertext<Element>> GetCiphertexts(size_t first, size_t count) const;
+
+private:
+	shared_ptr<const MappedFile>	m_file;
+	CryptoContext<Element>			m_context;
+	// the offsets of the ciphertexts, then the offset of the table, which ends the last one
+	vector<uint64_t>				m_offsets;
 };
 
 
@@ -86,6 +86,7 @@ static struct FeatureMap FeatureMap[] = {
 		{ OpLinRegression, "LinRegression", SHE },
 		{ OpKeySwitch, "KeySwitch", SHE },
 		{ OpKeySwitchGen, "KeySwitchGen", SHE },
+		{ OpRelinearize, "Relinearize", SHE },
 		{ OpModReduce, "ModReduce", LEVELEDSHE },
 		{ OpModReduceRational, "ModReduceRational", LEVELEDSHE },
 		{ OpModReduceMatrix, "ModReduceMatrix", LEVELEDSHE },
@@ -96,6 +97,9 @@ static struct FeatureMap FeatureMap[] = {
 		{ OpEvalAtIndexKeyGen, "EvalAtIndexKeyGen", SHE },
 		{ OpEvalSum, "EvalSum", SHE },
 		{ OpEvalAtIndex, "EvalAtIndex", SHE },
+		{ OpEvalFastRotationPrecompute, "EvalFastRotationPrecompute", SHE },
+		{ OpEvalFastRotation, "EvalFastRotation", SHE },
+		{ OpEvalLinearTransform, "EvalLinearTransform", SHE },
 		{ OpEvalInnerProduct, "EvalInnerProduct", SHE },
 		{ OpEvalCrossCorrelation, "EvalCrossCorrelation", SHE },
 		{ OpEvalLinRegressionBatched, "EvalLinRegressionBatched", SHE },
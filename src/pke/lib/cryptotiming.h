@@ -59,10 +59,10 @@ enum OpType {
 	OpEvalAutomorphismKeyGen,
 	OpEvalAutomorphismI,
 	OpEvalAutomorphismK,
-	OpLinRegression, OpKeySwitch,
+	OpLinRegression, OpKeySwitch, OpRelinearize,
 	OpModReduce, OpModReduceRational, OpModReduceMatrix, OpLevelReduce, OpRingReduce, OpComposedEvalMult,
 	OpEvalSumKeyGen, OpEvalSum, OpEvalInnerProduct, OpEvalCrossCorrelation, OpEvalLinRegressionBatched,
-	OpEvalAtIndexKeyGen,OpEvalAtIndex,
+	OpEvalAtIndexKeyGen,OpEvalAtIndex,OpEvalFastRotationPrecompute,OpEvalFastRotation,OpEvalLinearTransform,
 	OpEvalMerge, OpEvalRightShift,
 };
 
@@ -546,6 +546,19 @@ public:
 		throw std::runtime_error(errMsg);
 	}
 
+	/**
+	* Unimplemented function to relinearize a ciphertext for the LTV scheme.
+	*
+	* @param ciphertext The input ciphertext.
+	* @param ek is the evaluation keys input.
+	* @return A shared pointer to the relinearized ciphertext.
+	*/
+	Ciphertext<Element> Relinearize(ConstCiphertext<Element> ciphertext,
+		const vector<LPEvalKey<Element>> &ek) const {
+		std::string errMsg = "LPAlgorithmLTV::Relinearize is not implemented for the LTV Scheme.";
+		throw std::runtime_error(errMsg);
+	}
+
 	/**
 	* Function for homomorphic negation of ciphertexts.
 	* At a high level, this operation substracts the plaintext value encrypted in the ciphertext from the
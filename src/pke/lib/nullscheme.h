@@ -645,6 +645,19 @@ class LPAlgorithmSHENull : public LPSHEAlgorithm<Element> {
 			return EvalMult(ciphertext1, ciphertext2);
 		}
 
+		/**
+		* Relinearization for the NULL scheme, where ciphertexts have a single element.
+		*
+		* @param ciphertext The input ciphertext.
+		* @param evalKey The evaluation key input.
+		* @return A copy of the input ciphertext.
+		*/
+		Ciphertext<Element> Relinearize(ConstCiphertext<Element> ciphertext,
+			const vector<LPEvalKey<Element>> &evalKey) const {
+			// since there's no relinearize needed in NULL:
+			return Ciphertext<Element>(new CiphertextImpl<Element>(*ciphertext));
+		}
+
 		/**
 		* Function for homomorpic negation of ciphertext.
 		*
@@ -846,7 +859,7 @@ class LPAlgorithmSHENull : public LPSHEAlgorithm<Element> {
 			else
 				PALISADE_THROW( lbcrypto::math_error, "Polynomial multiplication in coefficient representation is not currently supported for non-power-of-two polynomials");
 
-			return std::move( cResult );
+			return cResult;
 		}
 };
 
@@ -32,6 +32,7 @@ extern template class CryptoContextImpl<DCRTPoly>;
 
 template class LPPublicKeyImpl<DCRTPoly>;
 template class LPPrivateKeyImpl<DCRTPoly>;
+template class LPEvalKeyImpl<DCRTPoly>;
 template class LPEvalKeyRelinImpl<DCRTPoly>;
 template class LPEvalKeyNTRUImpl<DCRTPoly>;
 template class LPEvalKeyNTRURelinImpl<DCRTPoly>;
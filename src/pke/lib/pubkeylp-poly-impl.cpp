@@ -32,6 +32,7 @@ extern template class CryptoContextImpl<Poly>;
 
 template class LPPublicKeyImpl<Poly>;
 template class LPPrivateKeyImpl<Poly>;
+template class LPEvalKeyImpl<Poly>;
 template class LPEvalKeyRelinImpl<Poly>;
 template class LPEvalKeyNTRUImpl<Poly>;
 template class LPEvalKeyNTRURelinImpl<Poly>;
@@ -41,6 +42,7 @@ extern template class CryptoContextImpl<NativePoly>;
 
 template class LPPublicKeyImpl<NativePoly>;
 template class LPPrivateKeyImpl<NativePoly>;
+template class LPEvalKeyImpl<NativePoly>;
 template class LPEvalKeyRelinImpl<NativePoly>;
 template class LPEvalKeyNTRUImpl<NativePoly>;
 template class LPEvalKeyNTRURelinImpl<NativePoly>;
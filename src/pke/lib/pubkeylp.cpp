@@ -37,7 +37,13 @@ bool LPPublicKeyImpl<Element>::Serialize(Serialized *serObj) const {
 		return false;
 
 	serObj->AddMember("Object", "PublicKey", serObj->GetAllocator());
-	SerializeVector<Element>("Vectors", Element::GetElementName(), this->GetPublicElements(), serObj);
+	// an element expanded from a seed is stored as the seed only
+	if( m_uniformSeed.IsSet() ) {
+		SerializeVector<Element>("Vectors", Element::GetElementName(), m_uniformSeed.Stored(this->GetPublicElements()), serObj);
+		m_uniformSeed.Serialize(serObj);
+	}
+	else
+		SerializeVector<Element>("Vectors", Element::GetElementName(), this->GetPublicElements(), serObj);
 
 	return true;
 }
@@ -65,7 +71,17 @@ bool LPPublicKeyImpl<Element>::Deserialize(const Serialized &serObj) {
 
 	bool ret = DeserializeVector<Element>("Vectors", Element::GetElementName(), mIt, &this->m_h);
 
-	return ret;
+	if( !ret || !m_uniformSeed.Deserialize(serObj) )
+		return false;
+
+	// the element stored as a seed is expanded on first use
+	if( m_uniformSeed.IsSet() ) {
+		if( this->m_h.size() != 1 )
+			return false;
+		m_uniformSeed.Restore(this->m_h);
+	}
+
+	return true;
 }
 
 template<typename Element>
@@ -76,8 +92,14 @@ static bool EvalKeyRelinSerializer(const LPEvalKeyRelinImpl<Element> *item, Seri
 		return false;
 
 	serObj->AddMember("Object", "EvalKeyRelin", serObj->GetAllocator());
-	SerializeVector<Element>("AVector", Element::GetElementName(), item->GetAVector(), serObj);
-	SerializeVector<Element>("BVector", Element::GetElementName(), item->GetBVector(), serObj);
+
+	// a vector expanded from a seed is stored as the seed only
+	const UniformSeed &seed = item->GetUniformSeed();
+	if( !seed.IsSet() || seed.GetIndex() != 0 )
+		SerializeVector<Element>("AVector", Element::GetElementName(), item->GetAVector(), serObj);
+	if( !seed.IsSet() || seed.GetIndex() != 1 )
+		SerializeVector<Element>("BVector", Element::GetElementName(), item->GetBVector(), serObj);
+	seed.Serialize(serObj);
 
 	return true;
 }
@@ -107,28 +129,33 @@ bool LPEvalKeyRelinImpl<Element>::Deserialize(const Serialized &serObj) {
 	if( mIt == serObj.MemberEnd() || string(mIt->value.GetString()) != "EvalKeyRelin" )
 		return false;
 
-	mIt = serObj.FindMember("AVector");
-
-	if( mIt == serObj.MemberEnd() ) {
+	m_deferred.Clear();
+	if( !m_uniformSeed.Deserialize(serObj) )
 		return false;
-	}
 
-	std::vector<Element> deserElem;
-	bool ret = DeserializeVector<Element>("AVector", Element::GetElementName(), mIt, &deserElem);
-	this->m_rKey.push_back(deserElem);
+	// the vector stored as a seed is expanded on first use
+	this->m_rKey.clear();
+	const char *names[] = { "AVector", "BVector" };
+	for( usint i = 0; i < 2; i++ ) {
+		if( m_uniformSeed.IsSet() && m_uniformSeed.GetIndex() == i )
+			continue;
 
-	if( !ret ) return ret;
+		mIt = serObj.FindMember(names[i]);
 
-	mIt = serObj.FindMember("BVector");
+		if( mIt == serObj.MemberEnd() ) {
+			return false;
+		}
 
-	if( mIt == serObj.MemberEnd() ) {
-		return false;
+		std::vector<Element> deserElem;
+		if( !DeserializeVector<Element>(names[i], Element::GetElementName(), mIt, &deserElem) )
+			return false;
+		this->m_rKey.push_back(std::move(deserElem));
 	}
 
-	ret = DeserializeVector<Element>("BVector", Element::GetElementName(), mIt, &deserElem);
-	this->m_rKey.push_back(deserElem);
+	if( m_uniformSeed.IsSet() )
+		m_uniformSeed.Restore(this->m_rKey);
 
-	return ret;
+	return true;
 }
 
 template<typename Element>
@@ -270,4 +297,158 @@ bool LPPrivateKeyImpl<Element>::Deserialize(const Serialized &serObj) {
 
 }
 
+// writes a standalone binary key: the crypto context, then the key
+template<typename Element>
+static void SerializeBinaryKey(const LPKey<Element> *key, BinaryObjectType type, std::ostream &out) {
+	BinaryWriter writer(type);
+	key->GetCryptoContext()->SerializeBinary(writer);
+	key->SerializeBinaryWithoutContext(writer);
+	writer.WriteTo(out);
+}
+
+// deserialization must be done in a crypto context; the context must be initialized before deserializing the elements
+template<typename Element>
+static void RequireBinaryContext(const LPKey<Element> *key) {
+	if( !key->GetCryptoContext() )
+		PALISADE_THROW(deserialize_error, "Key must be deserialized in a crypto context");
+}
+
+// reads the type of an eval key and checks it
+static inline void ReadBinaryEvalKeyType(BinaryReader &reader, BinaryEvalKeyType type) {
+	if( reader.ReadU8() != type )
+		PALISADE_THROW(deserialize_error, "Binary object is not of the expected eval key type");
+}
+
+template<typename Element>
+void LPPublicKeyImpl<Element>::SerializeBinary(std::ostream &out) const {
+	SerializeBinaryKey<Element>(this, BINARY_PUBLIC_KEY, out);
+}
+
+template<typename Element>
+void LPPublicKeyImpl<Element>::SerializeBinaryWithoutContext(BinaryWriter &writer) const {
+	this->SerializeBinaryCryptoObject(writer);
+	m_uniformSeed.SerializeBinary(writer);
+	// an element expanded from a seed is stored as the seed only
+	SerializeBinaryVector(writer, m_uniformSeed.Stored(this->GetPublicElements()));
+}
+
+template<typename Element>
+void LPPublicKeyImpl<Element>::DeserializeBinary(BinaryReader &reader) {
+	RequireBinaryContext<Element>(this);
+
+	this->DeserializeBinaryCryptoObject(reader);
+	m_uniformSeed.DeserializeBinary(reader);
+	DeserializeBinaryVector(reader, &this->m_h);
+
+	// the element stored as a seed is expanded on first use
+	if( m_uniformSeed.IsSet() ) {
+		if( this->m_h.size() != 1 )
+			PALISADE_THROW(deserialize_error, "Public key with a seed must have exactly one stored element");
+		m_uniformSeed.Restore(this->m_h);
+	}
+}
+
+template<typename Element>
+void LPEvalKeyImpl<Element>::SerializeBinary(std::ostream &out) const {
+	SerializeBinaryKey<Element>(this, BINARY_EVAL_KEY, out);
+}
+
+template<typename Element>
+void LPEvalKeyRelinImpl<Element>::SerializeBinaryWithoutContext(BinaryWriter &writer) const {
+	const UniformSeed &seed = GetUniformSeed();
+	writer.WriteU8(BINARY_EVAL_KEY_RELIN);
+	this->SerializeBinaryCryptoObject(writer);
+	seed.SerializeBinary(writer);
+
+	// a vector expanded from a seed is stored as the seed only
+	for( usint i = 0; i < 2; i++ ) {
+		if( seed.IsSet() && seed.GetIndex() == i )
+			continue;
+		SerializeBinaryVector(writer, i == 0 ? this->GetAVector() : this->GetBVector());
+	}
+}
+
+template<typename Element>
+void LPEvalKeyRelinImpl<Element>::DeserializeBinary(BinaryReader &reader) {
+	RequireBinaryContext<Element>(this);
+
+	m_deferred.Clear();
+	ReadBinary(reader);
+}
+
+template<typename Element>
+void LPEvalKeyRelinImpl<Element>::ReadBinary(BinaryReader &reader) {
+	ReadBinaryEvalKeyType(reader, BINARY_EVAL_KEY_RELIN);
+	this->DeserializeBinaryCryptoObject(reader);
+	m_uniformSeed.DeserializeBinary(reader);
+
+	// the vector stored as a seed is expanded on first use
+	this->m_rKey.clear();
+	for( usint i = 0; i < 2; i++ ) {
+		if( m_uniformSeed.IsSet() && m_uniformSeed.GetIndex() == i )
+			continue;
+		std::vector<Element> deserElem;
+		DeserializeBinaryVector(reader, &deserElem);
+		this->m_rKey.push_back(std::move(deserElem));
+	}
+
+	if( m_uniformSeed.IsSet() )
+		m_uniformSeed.Restore(this->m_rKey);
+}
+
+template<typename Element>
+void LPEvalKeyNTRUImpl<Element>::SerializeBinaryWithoutContext(BinaryWriter &writer) const {
+	writer.WriteU8(BINARY_EVAL_KEY_NTRU);
+	this->SerializeBinaryCryptoObject(writer);
+	this->GetA().SerializeBinary(writer);
+}
+
+template<typename Element>
+void LPEvalKeyNTRUImpl<Element>::DeserializeBinary(BinaryReader &reader) {
+	RequireBinaryContext<Element>(this);
+
+	ReadBinaryEvalKeyType(reader, BINARY_EVAL_KEY_NTRU);
+	this->DeserializeBinaryCryptoObject(reader);
+	m_Key.DeserializeBinary(reader);
+}
+
+template<typename Element>
+void LPEvalKeyNTRURelinImpl<Element>::SerializeBinaryWithoutContext(BinaryWriter &writer) const {
+	writer.WriteU8(BINARY_EVAL_KEY_NTRU_RELIN);
+	this->SerializeBinaryCryptoObject(writer);
+	SerializeBinaryVector(writer, this->GetAVector());
+}
+
+template<typename Element>
+void LPEvalKeyNTRURelinImpl<Element>::DeserializeBinary(BinaryReader &reader) {
+	RequireBinaryContext<Element>(this);
+
+	ReadBinaryEvalKeyType(reader, BINARY_EVAL_KEY_NTRU_RELIN);
+	this->DeserializeBinaryCryptoObject(reader);
+	std::vector<Element> newElements;
+	DeserializeBinaryVector(reader, &newElements);
+	this->SetAVector(newElements);
+}
+
+template<typename Element>
+void LPPrivateKeyImpl<Element>::SerializeBinary(std::ostream &out) const {
+	SerializeBinaryKey<Element>(this, BINARY_PRIVATE_KEY, out);
+}
+
+template<typename Element>
+void LPPrivateKeyImpl<Element>::SerializeBinaryWithoutContext(BinaryWriter &writer) const {
+	this->SerializeBinaryCryptoObject(writer);
+	this->GetPrivateElement().SerializeBinary(writer);
+}
+
+template<typename Element>
+void LPPrivateKeyImpl<Element>::DeserializeBinary(BinaryReader &reader) {
+	RequireBinaryContext<Element>(this);
+
+	this->DeserializeBinaryCryptoObject(reader);
+	Element element;
+	element.DeserializeBinary(reader);
+	this->SetPrivateElement(element);
+}
+
 }
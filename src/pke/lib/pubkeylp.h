@@ -36,9 +36,11 @@
 #include "lattice/ilelement.h"
 #include "utils/inttypes.h"
 #include "utils/hashutil.h"
+#include "utils/parallel.h"
 #include "math/distrgen.h"
 #include "utils/serializablehelper.h"
 #include "encoding/encodingparams.h"
+#include "uniformseed.h"
 
 
 /**
@@ -121,6 +123,19 @@ namespace lbcrypto {
 		LPKey(shared_ptr<CryptoObject<Element>> co) : CryptoObject<Element>(co) {}
 
 		virtual ~LPKey() {}
+
+		/**
+		* Writes the key in the compact binary format, without its crypto context
+		* @param writer the binary object being written
+		*/
+		virtual void SerializeBinaryWithoutContext(BinaryWriter &writer) const = 0;
+
+		/**
+		* Populates the key from the compact binary format; the crypto context must be set
+		* @param reader the binary object being read
+		* @throws deserialize_error if the key is malformed
+		*/
+		virtual void DeserializeBinary(BinaryReader &reader) = 0;
 	};
 
 	template<typename Element>
@@ -150,7 +165,8 @@ namespace lbcrypto {
 			*@param &rhs LPPublicKeyImpl to copy from
 			*/
 			explicit LPPublicKeyImpl(const LPPublicKeyImpl<Element> &rhs) : LPKey<Element>(rhs.GetCryptoContext(), rhs.GetKeyTag()) {
-				m_h = rhs.m_h;
+				m_h = rhs.GetPublicElements();
+				m_uniformSeed = rhs.m_uniformSeed;
 			}
 
 			/**
@@ -160,6 +176,7 @@ namespace lbcrypto {
 			*/
 			explicit LPPublicKeyImpl(LPPublicKeyImpl<Element> &&rhs) : LPKey<Element>(rhs.GetCryptoContext(), rhs.GetKeyTag()) {
 				m_h = std::move(rhs.m_h);
+				m_uniformSeed = rhs.m_uniformSeed;
 			}
 
 			/**
@@ -169,7 +186,8 @@ namespace lbcrypto {
 			*/
 			const LPPublicKeyImpl<Element>& operator=(const LPPublicKeyImpl<Element> &rhs) {
 				this->context = rhs.context;
-				this->m_h = rhs.m_h;
+				this->m_h = rhs.GetPublicElements();
+				this->m_uniformSeed = rhs.m_uniformSeed;
 				return *this;
 			}
 
@@ -182,6 +200,7 @@ namespace lbcrypto {
 				this->context = rhs.context;
 				rhs.context = 0;
 				m_h = std::move(rhs.m_h);
+				m_uniformSeed = rhs.m_uniformSeed;
 				return *this;
 			}
 
@@ -192,8 +211,17 @@ namespace lbcrypto {
 			 * @return the public key element.
 			 */
 			const std::vector<Element> &GetPublicElements() const {
+				m_uniformSeed.ExpandPending(m_h);
 				return this->m_h;
 			}
+
+			/**
+			 * Gets the seed of the uniformly random element of the public key, if it was recorded.
+			 * @return the seed.
+			 */
+			const UniformSeed &GetUniformSeed() const {
+				return m_uniformSeed;
+			}
 			
 			//@Set Properties
 
@@ -203,6 +231,7 @@ namespace lbcrypto {
 			 */
 			void SetPublicElements(const std::vector<Element> &element) {
 				m_h = element;
+				m_uniformSeed.Clear();
 			}
 
 			/**
@@ -211,6 +240,7 @@ namespace lbcrypto {
 			*/
 			void SetPublicElements(std::vector<Element> &&element) {
 				m_h = std::move(element);
+				m_uniformSeed.Clear();
 			}
 
 			/**
@@ -218,6 +248,8 @@ namespace lbcrypto {
 			* @param &element is the public key Element to be copied.
 			*/
 			void SetPublicElementAtIndex(usint idx, const Element &element) {
+				m_uniformSeed.ExpandPending(m_h);
+				m_uniformSeed.Clear();
 				m_h.insert(m_h.begin() + idx, element);
 			}
 
@@ -226,8 +258,20 @@ namespace lbcrypto {
 			* @param &&element is the public key Element to be moved.
 			*/
 			void SetPublicElementAtIndex(usint idx, Element &&element) {
+				m_uniformSeed.ExpandPending(m_h);
+				m_uniformSeed.Clear();
 				m_h.insert(m_h.begin() + idx, std::move(element));
 			}
+
+			/**
+			* Records that the public key Element at index idx was expanded from a seed with
+			* UniformSeed::Expand, so that only the seed is serialized.
+			* @param &seed the seed.
+			* @param idx the index of the element.
+			*/
+			void SetUniformSeed(const PRNGSeed &seed, usint idx) {
+				m_uniformSeed.Set(seed, idx);
+			}
 			
 			/**
 			* Serialize the object into a Serialized
@@ -244,15 +288,28 @@ namespace lbcrypto {
 			*/
 			bool Deserialize(const Serialized &serObj);
 
+			/**
+			* Writes the key in the compact binary format, with its crypto context
+			* @param out the stream
+			*/
+			void SerializeBinary(std::ostream &out) const;
+
+			void SerializeBinaryWithoutContext(BinaryWriter &writer) const;
+
+			void DeserializeBinary(BinaryReader &reader);
+
 			bool operator==(const LPPublicKeyImpl& other) const {
 				if( !CryptoObject<Element>::operator ==(other) )
 					return false;
 
-				if( m_h.size() != other.m_h.size() )
+				const std::vector<Element> &h = GetPublicElements();
+				const std::vector<Element> &otherH = other.GetPublicElements();
+
+				if( h.size() != otherH.size() )
 					return false;
 
-				for( size_t i = 0; i < m_h.size(); i++ )
-					if( m_h[i] != other.m_h[i] )
+				for( size_t i = 0; i < h.size(); i++ )
+					if( h[i] != otherH[i] )
 						return false;
 
 				return true;
@@ -261,7 +318,9 @@ namespace lbcrypto {
 			bool operator!=(const LPPublicKeyImpl& other) const { return ! (*this == other); }
 
 	private:
-		std::vector<Element> m_h;
+		// mutable for the lazy expansion of an element stored as a seed
+		mutable std::vector<Element> m_h;
+		UniformSeed m_uniformSeed;
 	};
 
 	template<typename Element>
@@ -274,6 +333,15 @@ namespace lbcrypto {
 	* @brief Abstract interface for LP evaluation/proxy keys
 	* @tparam Element a ring element.
 	*/
+	/**
+	 * @brief Types of eval keys, written first in their binary format.
+	 */
+	enum BinaryEvalKeyType {
+		BINARY_EVAL_KEY_RELIN = 1,
+		BINARY_EVAL_KEY_NTRU_RELIN = 2,
+		BINARY_EVAL_KEY_NTRU = 3
+	};
+
 	template <class Element>
 	class LPEvalKeyImpl : public LPKey<Element> {
 	public:
@@ -393,6 +461,12 @@ namespace lbcrypto {
 		friend bool operator!=(const LPEvalKeyImpl& a, LPEvalKeyImpl& b) { return ! (a == b); }
 
 		virtual bool key_compare(const LPEvalKeyImpl& other) const = 0;
+
+		/**
+		* Writes the key in the compact binary format, with its crypto context
+		* @param out the stream
+		*/
+		void SerializeBinary(std::ostream &out) const;
 	};
 
 	template<typename Element>
@@ -424,7 +498,9 @@ namespace lbcrypto {
 		*@param &rhs key to copy from
 		*/
 		explicit LPEvalKeyRelinImpl(const LPEvalKeyRelinImpl<Element> &rhs) : LPEvalKeyImpl<Element>(rhs.GetCryptoContext()) {
+			rhs.Materialize();
 			m_rKey = rhs.m_rKey;
+			m_uniformSeed = rhs.m_uniformSeed;
 		}
 
 		/**
@@ -434,6 +510,8 @@ namespace lbcrypto {
 		*/
 		explicit LPEvalKeyRelinImpl(LPEvalKeyRelinImpl<Element> &&rhs) : LPEvalKeyImpl<Element>(rhs.GetCryptoContext()) {
 			m_rKey = std::move(rhs.m_rKey);
+			m_uniformSeed = rhs.m_uniformSeed;
+			m_deferred = rhs.m_deferred;
 		}
 
 		/**
@@ -443,7 +521,10 @@ namespace lbcrypto {
 		*/
 		const LPEvalKeyRelinImpl<Element>& operator=(const LPEvalKeyRelinImpl<Element> &rhs) {
 			this->context = rhs.context;
+			rhs.Materialize();
 			this->m_rKey = rhs.m_rKey;
+			this->m_uniformSeed = rhs.m_uniformSeed;
+			this->m_deferred.Clear();
 			return *this;
 		}
 
@@ -456,6 +537,8 @@ namespace lbcrypto {
 			this->context = rhs.context;
 			rhs.context = 0;
 			m_rKey = std::move(rhs.m_rKey);
+			m_uniformSeed = rhs.m_uniformSeed;
+			m_deferred = rhs.m_deferred;
 			return *this;
 		}
 
@@ -466,6 +549,8 @@ namespace lbcrypto {
 		* @param &a is the Element vector to be copied.
 		*/
 		virtual void SetAVector(const std::vector<Element> &a) {
+			m_deferred.Clear();
+			m_uniformSeed.Clear();
 			m_rKey.insert(m_rKey.begin() + 0, a);
 		}
 
@@ -476,6 +561,8 @@ namespace lbcrypto {
 		* @param &&a is the Element vector to be moved.
 		*/
 		virtual void SetAVector(std::vector<Element> &&a) {
+			m_deferred.Clear();
+			m_uniformSeed.Clear();
 			m_rKey.insert(m_rKey.begin() + 0, std::move(a));
 		}
 
@@ -486,6 +573,7 @@ namespace lbcrypto {
 		* @return Element vector A.
 		*/
 		virtual const std::vector<Element> &GetAVector() const {
+			Materialize();
 			return m_rKey.at(0);
 		}
 
@@ -496,6 +584,8 @@ namespace lbcrypto {
 		* @param &b is the Element vector to be copied.
 		*/
 		virtual void SetBVector(const std::vector<Element> &b) {
+			m_deferred.Clear();
+			m_uniformSeed.Clear();
 			m_rKey.insert(m_rKey.begin() + 1, b);
 		}
 
@@ -506,6 +596,8 @@ namespace lbcrypto {
 		* @param &&b is the Element vector to be moved.
 		*/
 		virtual void SetBVector(std::vector<Element> &&b) {
+			m_deferred.Clear();
+			m_uniformSeed.Clear();
 			m_rKey.insert(m_rKey.begin() + 1, std::move(b));
 		}
 
@@ -516,9 +608,51 @@ namespace lbcrypto {
 		* @return Element vector B.
 		*/
 		virtual const std::vector<Element> &GetBVector() const {
+			Materialize();
 			return m_rKey.at(1);
 		}
 
+		/**
+		* Records that the Element vector at index idx (0 for A, 1 for B) was expanded from a seed,
+		* its element i with UniformSeed::Expand(seed, i, ...), so that only the seed is serialized.
+		*
+		* @param &seed the seed.
+		* @param idx the index of the vector.
+		*/
+		void SetUniformSeed(const PRNGSeed &seed, usint idx) {
+			m_uniformSeed.Set(seed, idx);
+		}
+
+		/**
+		* Gets the seed of the uniformly random vector of the key, if it was recorded.
+		*
+		* @return the seed.
+		*/
+		const UniformSeed &GetUniformSeed() const {
+			ReadDeferred();
+			return m_uniformSeed;
+		}
+
+		/**
+		* Defers the deserialization of the key to the first access to its vectors or its seed: the
+		* key is then read from a binary object in memory, written by SerializeBinaryWithoutContext.
+		* The key tag must be set by the caller.
+		*
+		* @param data the binary object.
+		* @param size the number of bytes available at data.
+		* @param owner keeps the memory alive until the key is read.
+		*/
+		void SetDeferredBinary(const char *data, size_t size, std::shared_ptr<const void> owner) {
+			m_deferred.Set(data, size, BINARY_EVAL_KEY, owner);
+		}
+
+		/**
+		* @return whether the key was not read from its deferred binary object yet.
+		*/
+		bool IsDeferred() const {
+			return m_deferred.IsPending();
+		}
+
 		/**
 		* Serialize the object into a Serialized
 		* @param *serObj is used to store the serialized result. It MUST be a rapidjson Object (SetObject());
@@ -540,12 +674,19 @@ namespace lbcrypto {
 		 */
 		bool Deserialize(const Serialized &serObj);
 
+		void SerializeBinaryWithoutContext(BinaryWriter &writer) const;
+
+		void DeserializeBinary(BinaryReader &reader);
+
 		bool key_compare(const LPEvalKeyImpl<Element>& other) const {
 			const LPEvalKeyRelinImpl<Element> &oth = dynamic_cast<const LPEvalKeyRelinImpl<Element> &>(other);
 
 			if( !CryptoObject<Element>::operator==(other) )
 				return false;
 
+			Materialize();
+			oth.Materialize();
+
 			if( this->m_rKey.size() != oth.m_rKey.size() ) return false;
 			for( size_t i=0; i<this->m_rKey.size(); i++ ) {
 				if( this->m_rKey[i].size() != oth.m_rKey[i].size() ) return false;
@@ -558,8 +699,26 @@ namespace lbcrypto {
 		}
 
 	private:
-		//private member to store vector of vector of Element.
-		std::vector< std::vector<Element> > m_rKey;
+		// reads the body of a binary object, without checking for a context
+		void ReadBinary(BinaryReader &reader);
+
+		// reads the key from its deferred binary object, if it was not read yet
+		void ReadDeferred() const {
+			m_deferred.ReadPending([this](BinaryReader &reader) {
+				const_cast<LPEvalKeyRelinImpl<Element>*>(this)->ReadBinary(reader);
+			});
+		}
+
+		// reads a deferred key, then expands a vector stored as a seed
+		void Materialize() const {
+			ReadDeferred();
+			m_uniformSeed.ExpandPending(m_rKey);
+		}
+
+		//private member to store vector of vector of Element; mutable for the lazy expansion of a vector stored as a seed
+		mutable std::vector< std::vector<Element> > m_rKey;
+		UniformSeed m_uniformSeed;
+		DeferredBinary m_deferred;
 	};
 
 	template<typename Element>
@@ -680,6 +839,10 @@ namespace lbcrypto {
 		 * @return true on success
 		 */
 		bool Deserialize(const Serialized &serObj);
+
+		void SerializeBinaryWithoutContext(BinaryWriter &writer) const;
+
+		void DeserializeBinary(BinaryReader &reader);
 		
 		bool key_compare(const LPEvalKeyImpl<Element>& other) const {
 			const LPEvalKeyNTRURelinImpl<Element> &oth = dynamic_cast<const LPEvalKeyNTRURelinImpl<Element> &>(other);
@@ -820,6 +983,10 @@ namespace lbcrypto {
 		 */
 		bool Deserialize(const Serialized &serObj);
 
+		void SerializeBinaryWithoutContext(BinaryWriter &writer) const;
+
+		void DeserializeBinary(BinaryReader &reader);
+
 		bool key_compare(const LPEvalKeyImpl<Element>& other) const {
 			const LPEvalKeyNTRUImpl<Element> &oth = dynamic_cast<const LPEvalKeyNTRUImpl<Element> &>(other);
 
@@ -936,6 +1103,16 @@ namespace lbcrypto {
 		*/
 		bool Deserialize(const Serialized &serObj);
 
+		/**
+		* Writes the key in the compact binary format, with its crypto context
+		* @param out the stream
+		*/
+		void SerializeBinary(std::ostream &out) const;
+
+		void SerializeBinaryWithoutContext(BinaryWriter &writer) const;
+
+		void DeserializeBinary(BinaryReader &reader);
+
 		bool operator==(const LPPrivateKeyImpl& other) const {
 			return CryptoObject<Element>::operator ==(other) &&
 					m_sk == other.m_sk;
@@ -1216,6 +1393,17 @@ namespace lbcrypto {
 
 	};
 
+	/**
+	 * @brief The diagonals of a matrix encoded for EvalLinearTransform, with the parameters their
+	 * encoding depends on, so that EvalLinearTransform can check them.
+	 */
+	struct LinearTransformDiagonals {
+		std::vector<Plaintext> diagonals;	/**< diagonal j*babySteps+i, rotated by -j*babySteps */
+		usint babySteps;		/**< the number of baby steps of the rotations */
+		usint cyclotomicOrder;	/**< the cyclotomic order of the slot encoding */
+		usint slots;			/**< the number of slots, in which the diagonals are repeated */
+	};
+
 	/**
 	 * @brief Abstract interface class for LBC SHE algorithms
 	 * @tparam Element a ring element.
@@ -1335,6 +1523,17 @@ namespace lbcrypto {
 		virtual Ciphertext<Element> EvalMultAndRelinearize(ConstCiphertext<Element> ct1,
 			ConstCiphertext<Element> ct2, const vector<LPEvalKey<Element>> &ek) const = 0;
 
+		/**
+		* Virtual function to define the interface for relinearization of a ciphertext with more than two elements,
+		* such as the result of EvalMult without an evaluation key or a sum of such results.
+		*
+		* @param ciphertext the input ciphertext.
+		* @param ek the evaluation keys for the powers of the secret key, from s^2 on.
+		* @return the ciphertext with two elements, decryptable by the same secret key.
+		*/
+		virtual Ciphertext<Element> Relinearize(ConstCiphertext<Element> ciphertext,
+			const vector<LPEvalKey<Element>> &ek) const = 0;
+
 		/**
 		* EvalLinRegression - Computes the parameter vector for linear regression using the least squares method
 		* @param x - matrix of regressors
@@ -1551,19 +1750,175 @@ namespace lbcrypto {
 		Ciphertext<Element> EvalAtIndex(ConstCiphertext<Element> ciphertext,
 			int32_t index, const std::map<usint, LPEvalKey<Element>> &evalAtIndexKeys) const {
 
-			const auto cryptoParams = ciphertext->GetCryptoParameters();
-			const auto encodingParams = cryptoParams->GetEncodingParams();
-			const auto elementParams = cryptoParams->GetElementParams();
-			uint32_t m = elementParams->GetCyclotomicOrder();
+			return EvalAutomorphism(ciphertext,FindAutomorphismIndex(ciphertext,index),evalAtIndexKeys);
+
+		}
+
+		/**
+		* Virtual function to precompute the digit decomposition of a ciphertext shared by several
+		* rotations of it (hoisted rotations). Schemes without hoisted rotations return no digits,
+		* and EvalFastAutomorphism then falls back to EvalAutomorphism.
+		*
+		* @param ciphertext the input ciphertext.
+		* @return the digits of the ciphertext.
+		*/
+		virtual shared_ptr<vector<Element>> EvalFastRotationPrecompute(ConstCiphertext<Element> ciphertext) const {
+			return shared_ptr<vector<Element>>(new vector<Element>());
+		}
+
+		/**
+		* Virtual function for evaluating automorphism of ciphertext at index i, using the digits
+		* computed by EvalFastRotationPrecompute for the same ciphertext.
+		*
+		* @param ciphertext the input ciphertext.
+		* @param i automorphism index
+		* @param digits the digits of the ciphertext computed by EvalFastRotationPrecompute.
+		* @param &evalKeys - reference to the map of evaluation keys generated by EvalAutomorphismKeyGen.
+		* @return resulting ciphertext
+		*/
+		virtual Ciphertext<Element> EvalFastAutomorphism(ConstCiphertext<Element> ciphertext, usint i,
+			const shared_ptr<vector<Element>> digits, const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
+			return EvalAutomorphism(ciphertext, i, evalKeys);
+		}
+
+		/**
+		* Moves i-th slot to slot 0, using the digits computed by EvalFastRotationPrecompute for the
+		* same ciphertext, so that several rotations of a ciphertext decompose it only once
+		*
+		* @param ciphertext.
+		* @param i the index.
+		* @param digits the digits of the ciphertext computed by EvalFastRotationPrecompute.
+		* @param &evalAtIndexKeys - reference to the map of evaluation keys generated by EvalAtIndexKeyGen.
+		* @return resulting ciphertext
+		*/
+		Ciphertext<Element> EvalFastRotation(ConstCiphertext<Element> ciphertext, int32_t index,
+			const shared_ptr<vector<Element>> digits, const std::map<usint, LPEvalKey<Element>> &evalAtIndexKeys) const {
+
+			return EvalFastAutomorphism(ciphertext,FindAutomorphismIndex(ciphertext,index),digits,evalAtIndexKeys);
 
-			uint32_t autoIndex;
+		}
+
+		/**
+		* Returns the number of baby steps used by EvalLinearTransform
+		*
+		* @param dimension the dimension of the transform (number of diagonals).
+		* @param babySteps the requested number of baby steps; 0 selects ceil(sqrt(dimension)),
+		* which minimizes the number of rotations.
+		* @return the number of baby steps, at most dimension
+		*/
+		static usint LinearTransformBabySteps(usint dimension, usint babySteps) {
+			if (dimension == 0)
+				PALISADE_THROW(config_error, "EvalLinearTransform: the dimension should be positive");
+			if (babySteps == 0)
+				babySteps = ceil(sqrt(dimension));
+			return std::min(babySteps, dimension);
+		}
+
+		/**
+		* Generates the rotation keys for EvalLinearTransform: the baby steps 1, ..., babySteps-1 and
+		* the giant steps that are multiples of babySteps
+		*
+		* @param publicKey encryption key for the new ciphertext.
+		* @param origPrivateKey original private key used for decryption.
+		* @param dimension the dimension of the transform (number of diagonals).
+		* @param babySteps number of baby steps; 0 selects ceil(sqrt(dimension)).
+		* @return returns the evaluation keys
+		*/
+		shared_ptr<std::map<usint, LPEvalKey<Element>>> EvalLinearTransformKeyGen(const LPPublicKey<Element> publicKey,
+			const LPPrivateKey<Element> origPrivateKey, usint dimension, usint babySteps) const
+		{
+
+			babySteps = LinearTransformBabySteps(dimension, babySteps);
+
+			std::vector<int32_t> indexList;
+			for (usint i = 1; i < babySteps; i++)
+				indexList.push_back(i);
+			for (usint j = babySteps; j < dimension; j += babySteps)
+				indexList.push_back(j);
+
+			return EvalAtIndexKeyGen(publicKey, origPrivateKey, indexList);
+
+		}
 
-			if (!(m & (m-1)))  // power-of-two cyclotomics
-				autoIndex = FindAutomorphismIndex2n(index,m);
-			else // cyclyc-group cyclotomics
-				autoIndex = FindAutomorphismIndexCyclic(index,m,encodingParams->GetPlaintextGenerator());
+		/**
+		* Multiplies a packed vector by a plaintext matrix given by its diagonals, with the diagonal
+		* method of Halevi and Shoup and baby-step giant-step rotations: the sum over k of
+		* diagonal k times the vector rotated by k is split as k = j*babySteps + i, the rotations by i
+		* are hoisted, and each giant step j rotates the sum of its products once. So there are about
+		* babySteps + dimension/babySteps rotations instead of dimension.
+		*
+		* @param ciphertext the input vector, repeated with period dimension in the slots.
+		* @param diagonals the dimension diagonals, encoded by EvalLinearTransformPrecompute of the
+		* crypto context: diagonal j*babySteps+i is rotated by -j*babySteps.
+		* @param &evalAtIndexKeys - reference to the map of evaluation keys generated by EvalLinearTransformKeyGen.
+		* @return resulting ciphertext
+		* @throws config_error if the diagonals were not encoded for the parameters of the ciphertext.
+		*/
+		Ciphertext<Element> EvalLinearTransform(ConstCiphertext<Element> ciphertext,
+			const LinearTransformDiagonals &diagonals,
+			const std::map<usint, LPEvalKey<Element>> &evalAtIndexKeys) const {
+
+			usint dimension = diagonals.diagonals.size();
+			usint babySteps = diagonals.babySteps;
+			if (babySteps != LinearTransformBabySteps(dimension, babySteps))
+				PALISADE_THROW(config_error, "EvalLinearTransform: the diagonals were not encoded for " +
+					std::to_string(babySteps) + " baby steps");
+
+			const auto elementParams = ciphertext->GetCryptoParameters()->GetElementParams();
+			if (diagonals.cyclotomicOrder != elementParams->GetCyclotomicOrder() ||
+					diagonals.slots != elementParams->GetRingDimension() || (diagonals.slots/2) % dimension != 0)
+				PALISADE_THROW(config_error, "EvalLinearTransform: the diagonals were not encoded for the slots of the ciphertext");
+
+			usint giantSteps = (dimension + babySteps - 1) / babySteps;
+
+			for (usint k = 1; k < dimension; k++) {
+				if (k >= babySteps && k % babySteps != 0)
+					continue;
+				usint autoIndex = FindAutomorphismIndex(ciphertext, k);
+				if (evalAtIndexKeys.find(autoIndex) == evalAtIndexKeys.end())
+					PALISADE_THROW(config_error, "Could not find an EvalKey for index " + std::to_string(autoIndex));
+			}
 
-			return EvalAutomorphism(ciphertext,autoIndex,evalAtIndexKeys);
+			// the rotations and the giant steps are independent
+			ParallelException error;
+
+			auto digits = EvalFastRotationPrecompute(ciphertext);
+
+			std::vector<Ciphertext<Element>> rotated(babySteps);
+			rotated[0] = Ciphertext<Element>(new CiphertextImpl<Element>(*ciphertext));
+#pragma omp parallel for
+			for (usint i = 1; i < babySteps; i++) {
+				try {
+					rotated[i] = EvalFastRotation(ciphertext, i, digits, evalAtIndexKeys);
+				}
+				catch (...) {
+					error.Capture();
+				}
+			}
+			error.Rethrow();
+
+			std::vector<Ciphertext<Element>> giant(giantSteps);
+#pragma omp parallel for
+			for (usint j = 0; j < giantSteps; j++) {
+				try {
+					Ciphertext<Element> sum;
+					for (usint i = 0; i < babySteps && j*babySteps + i < dimension; i++) {
+						auto product = EvalMult(rotated[i], diagonals.diagonals[j*babySteps + i]);
+						sum = sum ? EvalAdd(sum, product) : product;
+					}
+					giant[j] = j > 0 ? EvalAtIndex(sum, j*babySteps, evalAtIndexKeys) : sum;
+				}
+				catch (...) {
+					error.Capture();
+				}
+			}
+			error.Rethrow();
+
+			Ciphertext<Element> result = giant[0];
+			for (usint j = 1; j < giantSteps; j++)
+				result = EvalAdd(result, giant[j]);
+
+			return result;
 
 		}
 
@@ -1670,6 +2025,99 @@ namespace lbcrypto {
 
 		}
 
+		/**
+		* Generates the automorphism keys for EvalSumBSGS; works only for packed encoding.
+		* More baby steps mean more keys and fewer sequential key switches.
+		*
+		* @param privateKey private key.
+		* @param publicKey public key (used in NTRU schemes).
+		* @param babySteps number of baby steps, a power of two.
+		* @return returns the evaluation keys
+		*/
+		shared_ptr<std::map<usint, LPEvalKey<Element>>> EvalSumKeyGenBSGS(const LPPrivateKey<Element> privateKey,
+			const LPPublicKey<Element> publicKey, usint babySteps) const
+		{
+
+			const auto cryptoParams = privateKey->GetCryptoParameters();
+			const auto encodingParams = cryptoParams->GetEncodingParams();
+
+			std::vector<usint> babyIndices, giantIndices;
+			GenerateIndicesBSGS(cryptoParams, encodingParams->GetBatchSize(), babySteps, &babyIndices, &giantIndices);
+
+			std::vector<usint> indices(babyIndices);
+			indices.insert(indices.end(), giantIndices.begin(), giantIndices.end());
+
+			if (publicKey)
+				// NTRU-based scheme
+				return EvalAutomorphismKeyGen(publicKey, privateKey, indices);
+			else
+				// Regular RLWE scheme
+				return EvalAutomorphismKeyGen(privateKey, indices);
+
+		}
+
+		/**
+		* Sums all elements like EvalSum, with the baby-step giant-step method: the sum of the first
+		* babySteps rotations is computed with hoisted rotations of the ciphertext, which run in parallel,
+		* and the rest of the sum by doubling, as in EvalSum. So babySteps - 1 hoisted key switches
+		* replace log2(babySteps) sequential ones; babySteps = 1 is EvalSum.
+		*
+		* @param ciphertext the input ciphertext.
+		* @param batchSize size of the batch to be summed up
+		* @param babySteps number of baby steps, as passed to EvalSumKeyGenBSGS.
+		* @param &evalKeys - reference to the map of evaluation keys generated by EvalSumKeyGenBSGS.
+		* @return resulting ciphertext
+		*/
+		Ciphertext<Element> EvalSumBSGS(ConstCiphertext<Element> ciphertext, usint batchSize, usint babySteps,
+			const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
+
+			const auto cryptoParams = ciphertext->GetCryptoParameters();
+
+			if (cryptoParams->GetEncodingParams()->GetBatchSize() == 0)
+				throw std::runtime_error("EvalSumBSGS: Packed encoding parameters 'batch size' is not set; Please check the EncodingParams passed to the crypto context.");
+
+			std::vector<usint> babyIndices, giantIndices;
+			GenerateIndicesBSGS(cryptoParams, batchSize, babySteps, &babyIndices, &giantIndices);
+
+			for (usint i : giantIndices)
+				if (evalKeys.find(i) == evalKeys.end())
+					PALISADE_THROW(config_error, "Could not find an EvalKey for index " + std::to_string(i));
+
+			Ciphertext<Element> newCiphertext = SumFastAutomorphisms(ciphertext, babyIndices, evalKeys);
+
+			for (usint i : giantIndices)
+				newCiphertext = EvalAdd(newCiphertext, EvalAutomorphism(newCiphertext, i, evalKeys));
+
+			return newCiphertext;
+
+		}
+
+		/**
+		* Evaluates inner product in batched encoding, summing the products with EvalSumBSGS
+		*
+		* @param ciphertext1 first vector.
+		* @param ciphertext2 second vector.
+		* @param batchSize size of the batch to be summed up
+		* @param babySteps number of baby steps, as passed to EvalSumKeyGenBSGS.
+		* @param &evalSumKeys - reference to the map of evaluation keys generated by EvalSumKeyGenBSGS.
+		* @param &evalMultKey - reference to the evaluation key generated by EvalMultKeyGen.
+		* @return resulting ciphertext
+		*/
+		Ciphertext<Element> EvalInnerProductBSGS(ConstCiphertext<Element> ciphertext1,
+			ConstCiphertext<Element> ciphertext2, usint batchSize, usint babySteps,
+			const std::map<usint, LPEvalKey<Element>> &evalSumKeys,
+			const LPEvalKey<Element> evalMultKey) const {
+
+			Ciphertext<Element> result = EvalMult(ciphertext1, ciphertext2, evalMultKey);
+
+			result = EvalSumBSGS(result, batchSize, babySteps, evalSumKeys);
+
+			// add a random number to all slots except for the first one so that no information is leaked
+			result = AddRandomNoise(result);
+
+			return result;
+		}
+
 		/**
 		* Evaluates inner product in batched encoding
 		*
@@ -1852,6 +2300,97 @@ namespace lbcrypto {
 
 		private:
 
+			// automorphism index that moves slot index to slot 0
+			usint FindAutomorphismIndex(ConstCiphertext<Element> ciphertext, int32_t index) const {
+				const auto cryptoParams = ciphertext->GetCryptoParameters();
+				const auto encodingParams = cryptoParams->GetEncodingParams();
+				const auto elementParams = cryptoParams->GetElementParams();
+				uint32_t m = elementParams->GetCyclotomicOrder();
+
+				if (!(m & (m-1)))  // power-of-two cyclotomics
+					return FindAutomorphismIndex2n(index,m);
+				else // cyclyc-group cyclotomics
+					return FindAutomorphismIndexCyclic(index,m,encodingParams->GetPlaintextGenerator());
+			}
+
+			// Splits the automorphisms summed by EvalSum into baby steps and giant steps. EvalSum sums
+			// the automorphisms g^k, 0 <= k < K, and for power-of-two cyclotomics also their products
+			// with m-1. The baby steps are g^i, 0 < i < b; the giant steps g^(b*2^j), 0 <= j < log2(K/b),
+			// are applied by doubling, followed by m-1 for power-of-two cyclotomics.
+			void GenerateIndicesBSGS(const shared_ptr<LPCryptoParameters<Element>> cryptoParams, usint batchSize,
+				usint babySteps, std::vector<usint> *babyIndices, std::vector<usint> *giantIndices) const {
+
+				if (babySteps == 0 || (babySteps & (babySteps-1)))
+					PALISADE_THROW(config_error, "EvalSumBSGS: the number of baby steps should be a power of two");
+
+				const auto encodingParams = cryptoParams->GetEncodingParams();
+				uint64_t m = cryptoParams->GetElementParams()->GetCyclotomicOrder();
+				bool powerOfTwo = !(m & (m-1));
+
+				uint64_t g = powerOfTwo ? 5 : encodingParams->GetPlaintextGenerator();
+				if (g == 0)
+					throw std::runtime_error("EvalSumBSGS: Packed encoding parameters 'plaintext generator' is not set; Please check the EncodingParams passed to the crypto context.");
+
+				// the number of powers of g in the sum, as in EvalSum and EvalSum_2n
+				int logBatchSize = floor(log2(batchSize));
+				usint rotations;
+				if (powerOfTwo)
+					rotations = (1 << std::max(logBatchSize - 1, 0)) * (2*batchSize < m ? 2 : 1);
+				else
+					rotations = 1 << logBatchSize;
+
+				babySteps = std::min(babySteps, rotations);
+
+				uint64_t gi = 1;
+				for (usint i = 0; i < babySteps; i++) {
+					if (i > 0)
+						babyIndices->push_back(gi);
+					gi = gi * g % m;
+				}
+
+				// gi is now g^babySteps
+				for (usint j = babySteps; j < rotations; j *= 2) {
+					giantIndices->push_back(gi);
+					gi = gi * gi % m;
+				}
+				if (powerOfTwo)
+					giantIndices->push_back(m-1);
+			}
+
+			// Adds to a ciphertext its automorphisms at the given indices, computed in parallel with hoisting
+			Ciphertext<Element> SumFastAutomorphisms(ConstCiphertext<Element> ciphertext,
+				const std::vector<usint> &indices, const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
+
+				Ciphertext<Element> sum(new CiphertextImpl<Element>(*ciphertext));
+				if (indices.empty())
+					return sum;
+
+				for (usint i : indices)
+					if (evalKeys.find(i) == evalKeys.end())
+						PALISADE_THROW(config_error, "Could not find an EvalKey for index " + std::to_string(i));
+
+				auto digits = EvalFastRotationPrecompute(ciphertext);
+
+				// keys loaded from a key store are read on first use, in the loop, and may throw
+				std::vector<Ciphertext<Element>> automorphisms(indices.size());
+				ParallelException error;
+#pragma omp parallel for
+				for (usint i = 0; i < indices.size(); i++) {
+					try {
+						automorphisms[i] = EvalFastAutomorphism(ciphertext, indices[i], digits, evalKeys);
+					}
+					catch (...) {
+						error.Capture();
+					}
+				}
+				error.Rethrow();
+
+				for (usint i = 0; i < indices.size(); i++)
+					sum = EvalAdd(sum, automorphisms[i]);
+
+				return sum;
+			}
+
 			std::vector<usint> GenerateIndices_2n(usint batchSize, usint m) const {
 				// stores automorphism indices needed for EvalSum
 				std::vector<usint> indices;
@@ -2420,6 +2959,45 @@ namespace lbcrypto {
 				throw std::logic_error("EvalAtIndex operation has not been enabled");
 		}
 
+		shared_ptr<vector<Element>> EvalFastRotationPrecompute(ConstCiphertext<Element> ciphertext) const {
+
+			if (this->m_algorithmSHE)
+				return this->m_algorithmSHE->EvalFastRotationPrecompute(ciphertext);
+			else
+				throw std::logic_error("EvalFastRotationPrecompute operation has not been enabled");
+		}
+
+		Ciphertext<Element> EvalFastRotation(ConstCiphertext<Element> ciphertext, int32_t index,
+			const shared_ptr<vector<Element>> digits, const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
+
+			if (this->m_algorithmSHE)
+				return this->m_algorithmSHE->EvalFastRotation(ciphertext, index, digits, evalKeys);
+			else
+				throw std::logic_error("EvalFastRotation operation has not been enabled");
+		}
+
+		shared_ptr<std::map<usint, LPEvalKey<Element>>> EvalLinearTransformKeyGen(const LPPublicKey<Element> publicKey,
+			const LPPrivateKey<Element> origPrivateKey, usint dimension, usint babySteps) const {
+
+			if (this->m_algorithmSHE) {
+				auto km = this->m_algorithmSHE->EvalLinearTransformKeyGen(publicKey,origPrivateKey,dimension,babySteps);
+				for( auto& k : *km )
+					k.second->SetKeyTag( origPrivateKey->GetKeyTag() );
+				return km;
+			} else
+				throw std::logic_error("EvalLinearTransformKeyGen operation has not been enabled");
+		}
+
+		Ciphertext<Element> EvalLinearTransform(ConstCiphertext<Element> ciphertext,
+			const LinearTransformDiagonals &diagonals,
+			const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
+
+			if (this->m_algorithmSHE)
+				return this->m_algorithmSHE->EvalLinearTransform(ciphertext, diagonals, evalKeys);
+			else
+				throw std::logic_error("EvalLinearTransform operation has not been enabled");
+		}
+
 		shared_ptr<std::map<usint, LPEvalKey<Element>>> EvalAutomorphismKeyGen(const LPPrivateKey<Element> privateKey,
 			const std::vector<usint> &indexList) const {
 
@@ -2471,6 +3049,45 @@ namespace lbcrypto {
 
 		}
 
+		shared_ptr<std::map<usint, LPEvalKey<Element>>> EvalSumKeyGenBSGS(
+			const LPPrivateKey<Element> privateKey,
+			const LPPublicKey<Element> publicKey, usint babySteps) const {
+
+			if (this->m_algorithmSHE) {
+				auto km = this->m_algorithmSHE->EvalSumKeyGenBSGS(privateKey,publicKey,babySteps);
+				for( auto& k : *km ) {
+					k.second->SetKeyTag( privateKey->GetKeyTag() );
+				}
+				return km;
+			} else
+				throw std::logic_error("EvalSumKeyGenBSGS operation has not been enabled");
+		}
+
+		Ciphertext<Element> EvalSumBSGS(ConstCiphertext<Element> ciphertext, usint batchSize, usint babySteps,
+			const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
+
+			if (this->m_algorithmSHE) {
+				auto ct = this->m_algorithmSHE->EvalSumBSGS(ciphertext, batchSize, babySteps, evalKeys);
+				return ct;
+			} else
+				throw std::logic_error("EvalSumBSGS operation has not been enabled");
+
+		}
+
+		Ciphertext<Element> EvalInnerProductBSGS(ConstCiphertext<Element> ciphertext1,
+			ConstCiphertext<Element> ciphertext2, usint batchSize, usint babySteps,
+			const std::map<usint, LPEvalKey<Element>> &evalSumKeys,
+			const LPEvalKey<Element> evalMultKey) const {
+
+			if (this->m_algorithmSHE) {
+				auto ct = this->m_algorithmSHE->EvalInnerProductBSGS(ciphertext1, ciphertext2, batchSize, babySteps, evalSumKeys, evalMultKey);
+				ct->SetKeyTag( evalSumKeys.begin()->second->GetKeyTag() );
+				return ct;
+			} else
+				throw std::logic_error("EvalInnerProductBSGS operation has not been enabled");
+
+		}
+
 		Ciphertext<Element> EvalMerge(const vector<Ciphertext<Element>> &ciphertextVector,
 			const std::map<usint, LPEvalKey<Element>> &evalKeys) const {
 
@@ -2627,6 +3244,15 @@ namespace lbcrypto {
 				}
 		}
 
+		Ciphertext<Element> Relinearize(ConstCiphertext<Element> ciphertext,
+			const vector<LPEvalKey<Element>> &ek) const {
+				if(this->m_algorithmSHE)
+					return this->m_algorithmSHE->Relinearize(ciphertext, ek);
+				else {
+					throw std::logic_error("Relinearize operation has not been enabled");
+				}
+		}
+
 		/////////////////////////////////////////
 		// the functions below are wrappers for things in LPFHEAlgorithm (FHE)
 		//
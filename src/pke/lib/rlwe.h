@@ -32,6 +32,7 @@
 #include "lattice/stdlatticeparms.h"
 #include <string>
 #include "../../core/lib/lattice/dcrtpoly.h"
+#include "uniformseed.h"
 
 namespace lbcrypto {
 
@@ -52,6 +53,8 @@ public:
 		m_securityLevel = 0.0f;
 		m_relinWindow = 1;
 		m_dgg.SetStd(m_distributionParameter);
+		m_noiseDistribution = GAUSSIAN;
+		m_seededUniform = false;
 		m_depth = 0;
 		m_maxDepth = 1;
 		m_mode = RLWE;
@@ -68,6 +71,9 @@ public:
 		m_securityLevel = rhs.m_securityLevel;
 		m_relinWindow = rhs.m_relinWindow;
 		m_dgg.SetStd(m_distributionParameter);
+		m_cbg.SetEta(rhs.m_cbg.GetEta());
+		m_noiseDistribution = rhs.m_noiseDistribution;
+		m_seededUniform = rhs.m_seededUniform;
 		m_depth = rhs.m_depth;
 		m_maxDepth = rhs.m_maxDepth;
 		m_mode = rhs.m_mode;
@@ -103,6 +109,8 @@ public:
 		m_securityLevel = securityLevel;
 		m_relinWindow = relinWindow;
 		m_dgg.SetStd(m_distributionParameter);
+		m_noiseDistribution = GAUSSIAN;
+		m_seededUniform = false;
 		m_depth = depth;
 		m_maxDepth = maxDepth;
 		m_mode = mode;
@@ -138,6 +146,8 @@ public:
 		m_securityLevel = 0;
 		m_relinWindow = relinWindow;
 		m_dgg.SetStd(m_distributionParameter);
+		m_noiseDistribution = GAUSSIAN;
+		m_seededUniform = false;
 		m_depth = depth;
 		m_maxDepth = maxDepth;
 		m_mode = mode;
@@ -212,17 +222,91 @@ public:
 	 */
 	const typename Element::DggType &GetDiscreteGaussianGenerator() const { return m_dgg; }
 
+	/**
+	 * Returns reference to Centered Binomial Generator
+	 *
+	 * @return reference to Centered Binomial Generator.
+	 */
+	const typename Element::CbgType &GetCenteredBinomialGenerator() const { return m_cbg; }
+
+	/**
+	 * Gets the distribution the noise is drawn from.
+	 *
+	 * @return GAUSSIAN or CENTERED_BINOMIAL.
+	 */
+	NoiseDistribution GetNoiseDistribution() const { return m_noiseDistribution; }
+
+	/**
+	 * Draws a noise element from the selected distribution: the discrete Gaussian of standard deviation
+	 * r, or the centered binomial distribution of parameter round(2*r^2), which has about the same variance.
+	 *
+	 * @param params the parameters of the element.
+	 * @param format the format of the element.
+	 * @return the noise element.
+	 */
+	Element SampleNoise(const shared_ptr<typename Element::Params> params, Format format) const {
+		if (m_noiseDistribution == CENTERED_BINOMIAL)
+			return Element(m_cbg, params, format);
+		return Element(m_dgg, params, format);
+	}
+
+	/**
+	 * Gets whether the uniformly random components of keys and ciphertexts are expanded from seeds.
+	 *
+	 * @return true if they are.
+	 */
+	bool GetSeededUniform() const { return m_seededUniform; }
+
+	/**
+	 * Draws element number i of a uniformly random component of a key or ciphertext, in EVALUATION
+	 * format. When seeded uniform components are enabled, it is expanded from seed with
+	 * UniformSeed::Expand, so the key or ciphertext can store the seed instead; otherwise the seed is not used.
+	 *
+	 * @param params the parameters of the element.
+	 * @param seed the seed of the component.
+	 * @param i the number of the element in the component.
+	 * @return the uniform element.
+	 */
+	Element SampleUniform(const shared_ptr<typename Element::Params> params, const PRNGSeed &seed, usint i) const {
+		if (m_seededUniform)
+			return UniformSeed::Expand<Element>(seed, i, params);
+		typename Element::DugType dug;
+		return Element(dug, params, Format::EVALUATION);
+	}
+
 	//@Set Properties
 
 	/**
 	 * Sets the value of standard deviation r for discrete Gaussian distribution
 	 * @param distributionParameter
+	 * @throws config_error if the centered binomial distribution is selected and r > 4.
 	 */
 	void SetDistributionParameter(float distributionParameter) {
+		if (m_noiseDistribution == CENTERED_BINOMIAL)
+			m_cbg.SetEta(Element::CbgType::EtaForStd(distributionParameter));
 		m_distributionParameter = distributionParameter;
 		m_dgg.SetStd(m_distributionParameter);
 	}
 
+	/**
+	 * Selects the distribution the noise is drawn from
+	 * @param noiseDistribution GAUSSIAN or CENTERED_BINOMIAL.
+	 * @throws config_error for CENTERED_BINOMIAL if r > 4, as its parameter round(2*r^2) is at most CBD_MAX_ETA.
+	 */
+	void SetNoiseDistribution(NoiseDistribution noiseDistribution) {
+		if (noiseDistribution == CENTERED_BINOMIAL)
+			m_cbg.SetEta(Element::CbgType::EtaForStd(m_distributionParameter));
+		m_noiseDistribution = noiseDistribution;
+	}
+
+	/**
+	 * Selects whether the uniformly random component of public keys, key switching keys and ciphertexts
+	 * encrypted with the secret key is expanded from a 256-bit seed, and stored and serialized as the seed.
+	 * The component is expanded again on first use after deserialization.
+	 * @param seededUniform true to use seeds.
+	 */
+	void SetSeededUniform(bool seededUniform) { m_seededUniform = seededUniform; }
+
 	/**
 	 * Sets the values of assurance measure alpha
 	 * @param assuranceMeasure
@@ -283,6 +367,8 @@ public:
 				m_securityLevel == el->GetSecurityLevel() &&
 				m_relinWindow == el->GetRelinWindow() &&
 				m_mode == el->GetMode() &&
+				m_noiseDistribution == el->GetNoiseDistribution() &&
+				m_seededUniform == el->GetSeededUniform() &&
 				m_stdLevel == el->GetStdLevel();
 	}
 
@@ -295,6 +381,8 @@ public:
 				", Relin window " << GetRelinWindow() <<
 				", Depth " << GetDepth() <<
 				", Mode " << GetMode() <<
+				", Noise distribution " << GetNoiseDistribution() <<
+				", Seeded uniform " << GetSeededUniform() <<
 				", Standard security level " << GetStdLevel() <<
 				std::endl;
 	}
@@ -318,7 +406,13 @@ protected:
 	// Security level according in the HomomorphicEncryption.org standard
 	SecurityLevel m_stdLevel;
 
+	// distribution the noise is drawn from
+	NoiseDistribution m_noiseDistribution;
+	// whether uniform components of keys and ciphertexts are expanded from seeds
+	bool m_seededUniform;
+
 	typename Element::DggType m_dgg;
+	typename Element::CbgType m_cbg;
 
 	bool SerializeRLWE(Serialized* serObj, SerialItem& cryptoParamsMap) const {
 
@@ -343,6 +437,10 @@ protected:
 		cryptoParamsMap.AddMember("Mode", std::to_string(m_mode), serObj->GetAllocator());
 		cryptoParamsMap.AddMember("PlaintextModulus", std::to_string(this->GetPlaintextModulus()), serObj->GetAllocator());
 		cryptoParamsMap.AddMember("StdLevel", std::to_string(m_stdLevel), serObj->GetAllocator());
+		if (m_noiseDistribution != GAUSSIAN)
+			cryptoParamsMap.AddMember("NoiseDistribution", std::to_string(m_noiseDistribution), serObj->GetAllocator());
+		if (m_seededUniform)
+			cryptoParamsMap.AddMember("SeededUniform", "1", serObj->GetAllocator());
 
 		return true;
 	}
@@ -423,6 +521,15 @@ protected:
 			return false;
 		SecurityLevel stdLevel = (SecurityLevel)atoi(pIt->value.GetString());
 
+		// absent for the default (Gaussian) noise
+		NoiseDistribution noiseDistribution = GAUSSIAN;
+		if ((pIt = mIter->value.FindMember("NoiseDistribution")) != mIter->value.MemberEnd())
+			noiseDistribution = (NoiseDistribution)atoi(pIt->value.GetString());
+
+		// absent unless seeded uniform components are enabled
+		bool seededUniform = (pIt = mIter->value.FindMember("SeededUniform")) != mIter->value.MemberEnd() &&
+				atoi(pIt->value.GetString()) != 0;
+
 		this->SetPlaintextModulus(bbiPlaintextModulus);
 		this->SetDistributionParameter(distributionParameter);
 		this->SetAssuranceMeasure(assuranceMeasure);
@@ -432,6 +539,8 @@ protected:
 		this->SetMaxDepth(maxDepth);
 		this->SetMode(mode);
 		this->SetStdLevel(stdLevel);
+		this->SetNoiseDistribution(noiseDistribution);
+		this->SetSeededUniform(seededUniform);
 
 		return true;
 	}
@@ -0,0 +1,290 @@
+/**
+ * @file uniformseed.h -- Seeds of the uniformly random components of keys and ciphertexts.
+ * @author  TPOC: palisade@njit.edu
+ *
+ * @copyright Copyright (c) 2017, New Jersey Institute of Technology (NJIT)
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or other
+ * materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN
+ * IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef LBCRYPTO_CRYPTO_UNIFORMSEED_H
+#define LBCRYPTO_CRYPTO_UNIFORMSEED_H
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "math/distrgen.h"
+#include "utils/serializable.h"
+#include "utils/binaryserialization.h"
+#include "utils/exception.h"
+
+namespace lbcrypto {
+
+/**
+ * @brief Seed of the uniformly random component of a key or a ciphertext.
+ *
+ * The component at some index of a key or ciphertext (an element, or a vector of elements for
+ * key switching keys) can be expanded from a seed with Expand. The owner then records the seed
+ * here and serializes the seed instead of the component. After deserialization the component is
+ * missing (pending) and is expanded again on first use, once, by ExpandPending.
+ */
+class UniformSeed {
+public:
+	UniformSeed() : m_index(-1), m_pending(false) {}
+
+	UniformSeed(const UniformSeed &rhs)
+		: m_seed(rhs.m_seed), m_index(rhs.m_index), m_pending(rhs.m_pending.load()) {}
+
+	UniformSeed& operator=(const UniformSeed &rhs) {
+		m_seed = rhs.m_seed;
+		m_index = rhs.m_index;
+		m_pending = rhs.m_pending.load();
+		return *this;
+	}
+
+	/**
+	 * Draws a fresh seed from the PRNG of the calling thread.
+	 *
+	 * @return the seed.
+	 */
+	static PRNGSeed Generate() {
+		PRNGEngine &engine = PseudoRandomNumberGenerator::GetPRNG();
+		PRNGSeed seed;
+		for (size_t i = 0; i < seed.size(); i++)
+			seed[i] = engine();
+		return seed;
+	}
+
+	/**
+	 * Expands element number i of a component from its seed, in EVALUATION format.
+	 *
+	 * @param seed the seed of the component.
+	 * @param i the number of the element in the component (0 for single elements).
+	 * @param params the parameters of the element.
+	 * @return the element.
+	 */
+	template<typename Element>
+	static Element Expand(const PRNGSeed &seed, usint i, const shared_ptr<typename Element::Params> params) {
+		return Element(ChaCha20Engine::DeriveSeed(seed, i), params, EVALUATION);
+	}
+
+	/**
+	 * Records that the component at index was expanded from seed.
+	 *
+	 * @param seed the seed.
+	 * @param index the index of the component.
+	 */
+	void Set(const PRNGSeed &seed, usint index) {
+		m_seed = seed;
+		m_index = index;
+		m_pending = false;
+	}
+
+	/**
+	 * Forgets the seed, after the component was replaced or modified.
+	 */
+	void Clear() {
+		m_index = -1;
+		m_pending = false;
+	}
+
+	/**
+	 * @return whether a component is recorded as expanded from a seed.
+	 */
+	bool IsSet() const { return m_index >= 0; }
+
+	/**
+	 * @return the index of the component expanded from the seed.
+	 */
+	usint GetIndex() const { return m_index; }
+
+	/**
+	 * @return the seed.
+	 */
+	const PRNGSeed &GetSeed() const { return m_seed; }
+
+	/**
+	 * Expands the component at the recorded index of elements if it is pending; the other
+	 * elements give its parameters. Safe to call from several threads.
+	 *
+	 * @param elements the elements of a public key or a ciphertext.
+	 */
+	template<typename Element>
+	void ExpandPending(std::vector<Element> &elements) const {
+		if (!m_pending.load(std::memory_order_acquire))
+			return;
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_pending.load(std::memory_order_relaxed)) {
+			elements[m_index] = Expand<Element>(m_seed, 0, elements[OtherIndex()].GetParams());
+			m_pending.store(false, std::memory_order_release);
+		}
+	}
+
+	/**
+	 * Expands the vector at the recorded index of vectors if it is pending; it has as many
+	 * elements as the other vector, with the same parameters. Safe to call from several threads.
+	 *
+	 * @param vectors the vectors of a key switching key.
+	 */
+	template<typename Element>
+	void ExpandPending(std::vector<std::vector<Element>> &vectors) const {
+		if (!m_pending.load(std::memory_order_acquire))
+			return;
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_pending.load(std::memory_order_relaxed)) {
+			const std::vector<Element> &other = vectors[OtherIndex()];
+			std::vector<Element> expanded;
+			expanded.reserve(other.size());
+			for (usint i = 0; i < other.size(); i++)
+				expanded.push_back(Expand<Element>(m_seed, i, other[i].GetParams()));
+			vectors[m_index] = std::move(expanded);
+			m_pending.store(false, std::memory_order_release);
+		}
+	}
+
+	/**
+	 * Returns a copy of components without the one expanded from the seed, to be serialized.
+	 *
+	 * @param components the components.
+	 * @return the components to serialize.
+	 */
+	template<typename T>
+	std::vector<T> Stored(const std::vector<T> &components) const {
+		std::vector<T> stored;
+		for (usint i = 0; i < components.size(); i++)
+			if ((int)i != m_index)
+				stored.push_back(components[i]);
+		return stored;
+	}
+
+	/**
+	 * Puts a placeholder for the component expanded from the seed back into deserialized
+	 * components, and marks it pending.
+	 *
+	 * @param components the deserialized components.
+	 */
+	template<typename T>
+	void Restore(std::vector<T> &components) {
+		components.insert(components.begin() + m_index, T());
+		m_pending = true;
+	}
+
+	/**
+	 * Adds the seed and the index to a serialization, if a seed is set.
+	 *
+	 * @param serObj the serialization.
+	 */
+	void Serialize(Serialized *serObj) const {
+		if (!IsSet())
+			return;
+		serObj->AddMember("UniformSeed", SeedToString(m_seed), serObj->GetAllocator());
+		serObj->AddMember("UniformSeedIndex", std::to_string(m_index), serObj->GetAllocator());
+	}
+
+	/**
+	 * Reads the seed and the index from a serialization; the seed is cleared when there is none.
+	 *
+	 * @param serObj the serialization.
+	 * @return false if the seed is malformed.
+	 */
+	bool Deserialize(const Serialized &serObj) {
+		Clear();
+		Serialized::ConstMemberIterator mIt = serObj.FindMember("UniformSeed");
+		if (mIt == serObj.MemberEnd())
+			return true;
+		if (!SeedFromString(mIt->value.GetString(), &m_seed))
+			return false;
+		mIt = serObj.FindMember("UniformSeedIndex");
+		if (mIt == serObj.MemberEnd())
+			return false;
+		m_index = std::stoi(mIt->value.GetString());
+		return m_index == 0 || m_index == 1;
+	}
+
+	/**
+	 * Writes the index and, if a seed is set, the seed in the compact binary format.
+	 *
+	 * @param writer the binary object being written.
+	 */
+	void SerializeBinary(BinaryWriter &writer) const {
+		writer.WriteU8(IsSet() ? m_index : NO_INDEX);
+		if (!IsSet())
+			return;
+		for (size_t i = 0; i < m_seed.size(); i++)
+			writer.WriteU32(m_seed[i]);
+	}
+
+	/**
+	 * Reads the index and the seed from the compact binary format.
+	 *
+	 * @param reader the binary object being read.
+	 * @throws deserialize_error if the index is invalid.
+	 */
+	void DeserializeBinary(BinaryReader &reader) {
+		Clear();
+		uint8_t index = reader.ReadU8();
+		if (index == NO_INDEX)
+			return;
+		if (index > 1)
+			PALISADE_THROW(deserialize_error, "Invalid index of a uniform seed");
+		for (size_t i = 0; i < m_seed.size(); i++)
+			m_seed[i] = reader.ReadU32();
+		m_index = index;
+	}
+
+private:
+	static const uint8_t NO_INDEX = 0xFF;
+
+	// the components with a seed come in pairs; the other one gives the parameters
+	usint OtherIndex() const { return m_index == 0 ? 1 : 0; }
+
+	static std::string SeedToString(const PRNGSeed &seed) {
+		std::string s;
+		char word[9];
+		for (size_t i = 0; i < seed.size(); i++) {
+			snprintf(word, sizeof(word), "%08x", seed[i]);
+			s += word;
+		}
+		return s;
+	}
+
+	static bool SeedFromString(const std::string &s, PRNGSeed *seed) {
+		if (s.size() != 8*seed->size())
+			return false;
+		for (size_t i = 0; i < seed->size(); i++) {
+			const std::string word = s.substr(8*i, 8);
+			if (word.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+				return false;
+			(*seed)[i] = (uint32_t)std::stoul(word, nullptr, 16);
+		}
+		return true;
+	}
+
+	PRNGSeed m_seed;
+	int m_index;
+	mutable std::atomic<bool> m_pending;
+	mutable std::mutex m_mutex;
+};
+
+} // namespace lbcrypto
+
+#endif
@@ -194,3 +194,59 @@ EncryptionCoefPacked(const CryptoContext<Element> cc, const string& failmsg) {
 }
 
 GENERATE_TEST_CASES_FUNC(Encrypt_Decrypt, EncryptionCoefPacked, 128, 512)
+
+#define GENERATE_NOISE_TEST_CASES_FUNC(x,y,ORD,PTM) \
+GENERATE_PKE_TEST_CASE(x, y, Poly, BGV_rlwe, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, Poly, BFV_rlwe, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, NativePoly, BGV_opt, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, NativePoly, BFV_opt, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, DCRTPoly, BGV_rlwe, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, DCRTPoly, BFVrns_rlwe, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, DCRTPoly, BFVrns_opt, ORD, PTM) \
+GENERATE_PKE_TEST_CASE(x, y, DCRTPoly, BFVrnsB_rlwe, ORD, PTM)
+
+template <typename Element>
+void
+EncryptionCenteredBinomial(const CryptoContext<Element> cc, const string& failmsg) {
+
+	auto cryptoParams = std::dynamic_pointer_cast<LPCryptoParametersRLWE<Element>>(cc->GetCryptoParameters());
+	ASSERT_TRUE(cryptoParams != nullptr) << failmsg;
+	cryptoParams->SetNoiseDistribution(CENTERED_BINOMIAL);
+	EXPECT_EQ(CENTERED_BINOMIAL, cryptoParams->GetNoiseDistribution()) << failmsg;
+
+	size_t intSize = cc->GetRingDimension();
+	auto ptm = cc->GetCryptoParameters()->GetPlaintextModulus();
+	int half = ptm/2;
+
+	vector<int64_t> sintvec;
+	for( size_t ii=0; ii<intSize; ii++) {
+		int rnum = rand() % half;
+		if( rand()%2 ) rnum *= -1;
+		sintvec.push_back( rnum );
+	}
+	Plaintext plaintextSInt = cc->MakeCoefPackedPlaintext(sintvec);
+
+	LPKeyPair<Element> kp = cc->KeyGen();
+	EXPECT_EQ(kp.good(), true) << failmsg << " key generation with centered binomial noise failed";
+
+	Ciphertext<Element> ciphertext = cc->Encrypt(kp.publicKey, plaintextSInt);
+	Plaintext plaintextSIntNew;
+	cc->Decrypt(kp.secretKey, ciphertext, &plaintextSIntNew);
+	EXPECT_EQ(*plaintextSIntNew, *plaintextSInt) << failmsg << " encrypt/decrypt with centered binomial noise failed";
+
+	cryptoParams->SetNoiseDistribution(GAUSSIAN);
+
+	// the centered binomial distribution cannot have a standard deviation above 4
+	float distributionParameter = cryptoParams->GetDistributionParameter();
+	cryptoParams->SetDistributionParameter(5);
+	EXPECT_THROW(cryptoParams->SetNoiseDistribution(CENTERED_BINOMIAL), config_error) << failmsg;
+	EXPECT_EQ(GAUSSIAN, cryptoParams->GetNoiseDistribution()) << failmsg;
+	cryptoParams->SetDistributionParameter(distributionParameter);
+
+	cryptoParams->SetNoiseDistribution(CENTERED_BINOMIAL);
+	EXPECT_THROW(cryptoParams->SetDistributionParameter(5), config_error) << failmsg;
+	EXPECT_EQ(distributionParameter, cryptoParams->GetDistributionParameter()) << failmsg;
+	cryptoParams->SetNoiseDistribution(GAUSSIAN);
+}
+
+GENERATE_NOISE_TEST_CASES_FUNC(Encrypt_Decrypt, EncryptionCenteredBinomial, 128, 512)
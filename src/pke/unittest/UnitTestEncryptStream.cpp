@@ -25,6 +25,8 @@
  */
 
 #include "include/gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -87,3 +89,51 @@ TEST_F(UTEncryptStream, Stream_Encryptor_Test_BFVrns)
 
 	EXPECT_EQ(bigSource.str(), bigDest.str());
 }
+
+template<typename Element>
+static void UnitTestArchive(CryptoContext<Element> cc)
+{
+	string	base = "Strange women lying in ponds distributing swords is no basis for a system of government!";
+	stringstream		bigSource, bigDest;
+	for( size_t i = 0; i < 500; i++ )
+		bigSource << base;
+
+	LPKeyPair<Element> kp = cc->KeyGen();
+
+	const string filename = "UnitTestArchive.bin";
+	size_t count;
+	{
+		std::ofstream out(filename, std::ios::binary);
+		count = cc->EncryptStreamArchive(kp.publicKey, bigSource, out);
+	}
+
+	CiphertextArchive<Element> archive(filename);
+	std::remove(filename.c_str());
+	ASSERT_EQ(count, archive.GetCount());
+
+	cc->DecryptArchive(kp.secretKey, archive, 0, archive.GetCount(), bigDest);
+	EXPECT_EQ(bigSource.str(), bigDest.str());
+
+	// a range in the middle is read without the chunks before it
+	size_t chunkSize = cc->GetRingDimension();
+	stringstream middle;
+	cc->DecryptArchive(kp.secretKey, archive, 3, 2, middle);
+	EXPECT_EQ(bigSource.str().substr(3*chunkSize, 2*chunkSize), middle.str());
+
+	vector<Ciphertext<Element>> range = archive.GetCiphertexts(3, 2);
+	ASSERT_EQ(range.size(), 2U);
+	EXPECT_EQ(*archive.GetCiphertext(4), *range[1]);
+
+	EXPECT_THROW(archive.GetCiphertext(archive.GetCount()), deserialize_error);
+	EXPECT_THROW(archive.GetCiphertexts(archive.GetCount() - 1, 2), deserialize_error);
+}
+
+TEST_F(UTEncryptStream, Stream_Archive_Test_BFV)
+{
+	UnitTestArchive<Poly>(GenCryptoContextBFV<Poly>(1024, 256));
+}
+
+TEST_F(UTEncryptStream, Stream_Archive_Test_BFVrns)
+{
+	UnitTestArchive<DCRTPoly>(GenCryptoContextBFVrns<DCRTPoly>(256));
+}
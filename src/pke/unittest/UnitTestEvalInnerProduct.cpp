@@ -54,6 +54,7 @@ public:
 int64_t ArbLTVInnerProductPackedArray(std::vector<int64_t> &input1,std::vector<int64_t> &input2);
 int64_t ArbBGVInnerProductPackedArray(std::vector<int64_t> &input1, std::vector<int64_t> &input2);
 int64_t ArbBFVInnerProductPackedArray(std::vector<int64_t> &input1, std::vector<int64_t> &input2);
+int64_t BFVrnsInnerProductBSGSPackedArray(std::vector<int64_t> &input1, std::vector<int64_t> &input2, usint babySteps);
 
 TEST_F(UTEvalIP, Test_LTV_EvalInnerProduct) {
 
@@ -157,6 +158,37 @@ TEST_F(UTEvalIP, Test_BFV_EvalInnerProduct) {
 
 
 
+TEST_F(UTEvalIP, Test_BFVrns_EvalInnerProductBSGS) {
+
+	usint size = 16;
+	usint limit = 15;
+	usint plainttextMod = 65537;
+
+	random_device rnd_device;
+	mt19937 mersenne_engine(rnd_device());
+	uniform_int_distribution<usint> dist(0, limit);
+
+	auto gen = std::bind(dist, mersenne_engine);
+
+	for (usint babySteps : {1, 4, 16}) {
+		std::vector<int64_t> input1(size, 0);
+		std::vector<int64_t> input2(size, 0);
+		generate(input1.begin(), input1.end(), gen);
+		generate(input2.begin(), input2.end(), gen);
+
+		int64_t expectedResult = std::inner_product(input1.begin(), input1.end(), input2.begin(), 0);
+		expectedResult %= plainttextMod;
+
+		try {
+			int64_t result = BFVrnsInnerProductBSGSPackedArray(input1, input2, babySteps);
+
+			EXPECT_EQ(result, expectedResult) << "babySteps = " << babySteps;
+		} catch( const std::logic_error& e ) {
+			FAIL() << e.what();
+		}
+	}
+}
+
 int64_t ArbLTVInnerProductPackedArray(std::vector<int64_t> &input1, std::vector<int64_t> &input2) {
 
 	usint m = 22;
@@ -343,4 +375,39 @@ int64_t ArbBFVInnerProductPackedArray(std::vector<int64_t> &input1, std::vector<
 
 }
 
+int64_t BFVrnsInnerProductBSGSPackedArray(std::vector<int64_t> &input1, std::vector<int64_t> &input2, usint babySteps) {
+
+	PlaintextModulus p = 65537;
+	double sigma = 4;
+	double rootHermiteFactor = 1.006;
+
+	usint batchSize = input1.size();
+
+	EncodingParams encodingParams(new EncodingParamsImpl(p, batchSize));
 
+	CryptoContext<DCRTPoly> cc = CryptoContextFactory<DCRTPoly>::genCryptoContextBFVrns(
+			encodingParams, rootHermiteFactor, sigma, 0, 1, 0, OPTIMIZED, 2);
+
+	cc->Enable(ENCRYPTION);
+	cc->Enable(SHE);
+
+	LPKeyPair<DCRTPoly> kp = cc->KeyGen();
+
+	Plaintext intArray1 = cc->MakePackedPlaintext(input1);
+	Plaintext intArray2 = cc->MakePackedPlaintext(input2);
+
+	cc->EvalSumKeyGenBSGS(kp.secretKey, babySteps);
+	cc->EvalMultKeyGen(kp.secretKey);
+
+	Ciphertext<DCRTPoly> ciphertext1 = cc->Encrypt(kp.publicKey, intArray1);
+	Ciphertext<DCRTPoly> ciphertext2 = cc->Encrypt(kp.publicKey, intArray2);
+
+	auto result = cc->EvalInnerProductBSGS(ciphertext1, ciphertext2, batchSize, babySteps);
+
+	Plaintext intArrayNew;
+
+	cc->Decrypt(kp.secretKey, result, &intArrayNew);
+
+	return intArrayNew->GetPackedValue()[0];
+
+}
@@ -78,9 +78,27 @@ static CryptoContext<DCRTPoly> MakeBFVrnsDCRTPolyCC() {
 	return cryptoContext;
 }
 
+static CryptoContext<DCRTPoly> MakeBFVrnsBDCRTPolyCC() {
+	int plaintextModulus = 256;
+	double sigma = 4;
+	double rootHermiteFactor = 1.03;
+
+	//Set Crypto Parameters
+	CryptoContext<DCRTPoly> cryptoContext = CryptoContextFactory<DCRTPoly>::genCryptoContextBFVrnsB(
+			plaintextModulus, rootHermiteFactor, sigma, 0, 3, 0, OPTIMIZED,4);
+
+	cryptoContext->Enable(ENCRYPTION);
+	cryptoContext->Enable(SHE);
+
+	return cryptoContext;
+}
+
 template<typename Element>
 static void RunEvalMultManyTest(CryptoContext<Element> cc, string msg);
 
+template<typename Element>
+static void RunRelinearizeTest(CryptoContext<Element> cc, string msg);
+
 //Tests EvalMult w/o keyswitching and EvalMultMany for BFV in the OPTIMIZED mode
 TEST(UTBFVEVALMM, Poly_BFV_Eval_Mult_Many_Operations_VERY_LONG) {
 
@@ -95,6 +113,20 @@ TEST(UTBFVrnsEVALMM, Poly_BFVrns_Eval_Mult_Many_Operations) {
 
 }
 
+//Tests sums of products computed w/o keyswitching and relinearized once, for BFVrns
+TEST(UTBFVrnsEVALMM, Poly_BFVrns_Relinearize) {
+
+	RunRelinearizeTest(MakeBFVrnsDCRTPolyCC(), "BFVrns");
+
+}
+
+//Tests sums of products computed w/o keyswitching and relinearized once, for BFVrnsB
+TEST(UTBFVrnsEVALMM, Poly_BFVrnsB_Relinearize) {
+
+	RunRelinearizeTest(MakeBFVrnsBDCRTPolyCC(), "BFVrnsB");
+
+}
+
 template<typename Element>
 static void RunEvalMultManyTest(CryptoContext<Element> cryptoContext, string msg) {
 
@@ -196,3 +228,68 @@ static void RunEvalMultManyTest(CryptoContext<Element> cryptoContext, string msg
 
 }
 
+template<typename Element>
+static void RunRelinearizeTest(CryptoContext<Element> cryptoContext, string msg) {
+
+	auto keyPair = cryptoContext->KeyGen();
+
+	ASSERT_TRUE(keyPair.good()) << "Key generation failed!";
+
+	cryptoContext->EvalMultKeysGen(keyPair.secretKey);
+
+	std::vector<int64_t> vectorOfInts1 = {5,4,3,2,1,0,5,4,3,2,1,0};
+	std::vector<int64_t> vectorOfInts2 = {2,0,0,0,0,0,0,0,0,0,0,0};
+	std::vector<int64_t> vectorOfInts3 = {1,2,3,4,5,6,1,2,3,4,5,6};
+	std::vector<int64_t> vectorOfInts4 = {3,0,0,0,0,0,0,0,0,0,0,0};
+	std::vector<int64_t> vectorOfInts5 = {1,1,1,1,1,1,1,1,1,1,1,1};
+	std::vector<int64_t> vectorOfInts6 = {20,20,20,20,20,20,20,20,20,20,20,20};
+
+	// 1*2 + 3*4 + 5
+	std::vector<int64_t> vectorOfIntsSum = {14,15,16,17,18,19,14,15,16,17,18,19};
+	// 3*4 - 5
+	std::vector<int64_t> vectorOfIntsSub1 = {2,5,8,11,14,17,2,5,8,11,14,17};
+	// 6 - 1*2
+	std::vector<int64_t> vectorOfIntsSub2 = {10,12,14,16,18,20,10,12,14,16,18,20};
+	// 1*2*4
+	std::vector<int64_t> vectorOfIntsMul = {30,24,18,12,6,0,30,24,18,12,6,0};
+
+	auto ciphertext1 = cryptoContext->Encrypt(keyPair.publicKey, cryptoContext->MakeCoefPackedPlaintext(vectorOfInts1));
+	auto ciphertext2 = cryptoContext->Encrypt(keyPair.publicKey, cryptoContext->MakeCoefPackedPlaintext(vectorOfInts2));
+	auto ciphertext3 = cryptoContext->Encrypt(keyPair.publicKey, cryptoContext->MakeCoefPackedPlaintext(vectorOfInts3));
+	auto ciphertext4 = cryptoContext->Encrypt(keyPair.publicKey, cryptoContext->MakeCoefPackedPlaintext(vectorOfInts4));
+	auto ciphertext5 = cryptoContext->Encrypt(keyPair.publicKey, cryptoContext->MakeCoefPackedPlaintext(vectorOfInts5));
+	auto ciphertext6 = cryptoContext->Encrypt(keyPair.publicKey, cryptoContext->MakeCoefPackedPlaintext(vectorOfInts6));
+
+	auto ciphertextMul12 = cryptoContext->EvalMultNoRelin(ciphertext1, ciphertext2);
+	auto ciphertextMul34 = cryptoContext->EvalMultNoRelin(ciphertext3, ciphertext4);
+	auto ciphertextMul124 = cryptoContext->EvalMultNoRelin(ciphertextMul12, ciphertext4);
+
+	EXPECT_EQ(ciphertextMul12->GetElements().size(), 3U) << msg << ".EvalMultNoRelin does not give three elements.\n";
+
+	// sums and differences of ciphertexts with three and two elements, relinearized once
+	auto ciphertextSum = cryptoContext->Relinearize(
+			cryptoContext->EvalAdd(cryptoContext->EvalAdd(ciphertextMul12, ciphertextMul34), ciphertext5));
+	auto ciphertextSub1 = cryptoContext->Relinearize(cryptoContext->EvalSub(ciphertextMul34, ciphertext5));
+	auto ciphertextSub2 = cryptoContext->Relinearize(cryptoContext->EvalSub(ciphertext6, ciphertextMul12));
+	auto ciphertextMul = cryptoContext->Relinearize(ciphertextMul124);
+
+	EXPECT_EQ(ciphertextSum->GetElements().size(), 2U) << msg << ".Relinearize does not give two elements.\n";
+	EXPECT_EQ(ciphertextMul->GetElements().size(), 2U) << msg << ".Relinearize does not give two elements.\n";
+
+	Plaintext plaintextSum, plaintextSub1, plaintextSub2, plaintextMul;
+	cryptoContext->Decrypt(keyPair.secretKey, ciphertextSum, &plaintextSum);
+	cryptoContext->Decrypt(keyPair.secretKey, ciphertextSub1, &plaintextSub1);
+	cryptoContext->Decrypt(keyPair.secretKey, ciphertextSub2, &plaintextSub2);
+	cryptoContext->Decrypt(keyPair.secretKey, ciphertextMul, &plaintextMul);
+
+	plaintextSum->SetLength(vectorOfIntsSum.size());
+	plaintextSub1->SetLength(vectorOfIntsSub1.size());
+	plaintextSub2->SetLength(vectorOfIntsSub2.size());
+	plaintextMul->SetLength(vectorOfIntsMul.size());
+
+	EXPECT_EQ(plaintextSum->GetCoefPackedValue(), vectorOfIntsSum) << msg << ".Relinearize of a sum of products gives incorrect results.\n";
+	EXPECT_EQ(plaintextSub1->GetCoefPackedValue(), vectorOfIntsSub1) << msg << ".EvalSub of a product and a ciphertext gives incorrect results.\n";
+	EXPECT_EQ(plaintextSub2->GetCoefPackedValue(), vectorOfIntsSub2) << msg << ".EvalSub of a ciphertext and a product gives incorrect results.\n";
+	EXPECT_EQ(plaintextMul->GetCoefPackedValue(), vectorOfIntsMul) << msg << ".Relinearize of a product of three ciphertexts gives incorrect results.\n";
+
+}
@@ -56,6 +56,9 @@ int64_t ArbLTVEvalSumPackedArray(std::vector<int64_t> &clearVector, PlaintextMod
 int64_t ArbBGVEvalSumPackedArray(std::vector<int64_t> &clearVector, PlaintextModulus p);
 int64_t ArbBGVEvalSumPackedArrayPrime(std::vector<int64_t> &clearVector, PlaintextModulus p);
 int64_t ArbBFVEvalSumPackedArray(std::vector<int64_t> &clearVector, PlaintextModulus p);
+int64_t ArbBGVEvalSumBSGSPackedArrayPrime(std::vector<int64_t> &clearVector, PlaintextModulus p, usint babySteps);
+std::vector<int64_t> BFVrnsEvalSumBSGSPackedArray(std::vector<int64_t> &clearVector, usint batchSize, usint babySteps,
+	std::vector<int64_t> *evalSumResult);
 
 void EvalSumSetup(std::vector<int64_t>& input, int64_t& expectedSum, PlaintextModulus plaintextMod) {
 
@@ -132,6 +135,42 @@ TEST_F(UTEvalSum, Test_BFV_EvalSum) {
 
 }
 
+TEST_F(UTEvalSum, Test_BGV_EvalSumBSGS_Prime_Cyclotomics) {
+
+	for (usint babySteps : {1, 2, 4, 8}) {
+		usint size = 10;
+		std::vector<int64_t> input(size,0);
+		int64_t expectedSum;
+
+		EvalSumSetup(input,expectedSum, 23);
+
+		int64_t result = ArbBGVEvalSumBSGSPackedArrayPrime(input, 23, babySteps);
+
+		EXPECT_EQ(expectedSum, result) << "babySteps = " << babySteps;
+	}
+}
+
+TEST_F(UTEvalSum, Test_BFVrns_EvalSumBSGS) {
+
+	usint maxBatchSize = 64;
+
+	for (usint batchSize : {4, 16, 64}) {
+		for (usint babySteps : {1, 2, 8, 64}) {
+			std::vector<int64_t> input(batchSize,0);
+			int64_t expectedSum;
+
+			EvalSumSetup(input,expectedSum, 65537);
+
+			std::vector<int64_t> evalSumResult;
+			std::vector<int64_t> result = BFVrnsEvalSumBSGSPackedArray(input, maxBatchSize, babySteps, &evalSumResult);
+
+			// the same automorphisms are summed, so all the slots agree with EvalSum
+			EXPECT_EQ(expectedSum, result[0]) << "batchSize = " << batchSize << ", babySteps = " << babySteps;
+			EXPECT_EQ(evalSumResult, result) << "batchSize = " << batchSize << ", babySteps = " << babySteps;
+		}
+	}
+}
+
 int64_t ArbLTVEvalSumPackedArray(std::vector<int64_t> &clearVector, PlaintextModulus p) {
 
 	usint m = 22;
@@ -339,3 +378,83 @@ int64_t ArbBFVEvalSumPackedArray(std::vector<int64_t> &clearVector, PlaintextMod
 	return intArrayNew->GetPackedValue()[0];
 
 }
+
+int64_t ArbBGVEvalSumBSGSPackedArrayPrime(std::vector<int64_t> &clearVector, PlaintextModulus p, usint babySteps) {
+
+	usint m = 11;
+
+	BigInteger modulusQ("1125899906842679");
+	BigInteger squareRootOfRoot("7742739281594");
+
+	BigInteger bigmodulus("81129638414606681695789005144449");
+	BigInteger bigroot("74771531227552428119450922526156");
+
+	auto cycloPoly = GetCyclotomicPolynomial<BigVector>(m, modulusQ);
+	ChineseRemainderTransformArb<BigVector>::SetCylotomicPolynomial(cycloPoly, modulusQ);
+
+	float stdDev = 4;
+
+	usint batchSize = 8;
+
+	shared_ptr<ILParams> params(new ILParams(m, modulusQ, squareRootOfRoot, bigmodulus, bigroot));
+
+	EncodingParams encodingParams(new EncodingParamsImpl(p, batchSize, PackedEncoding::GetAutomorphismGenerator(m)));
+
+	PackedEncoding::SetParams(m, encodingParams);
+
+	CryptoContext<Poly> cc = CryptoContextFactory<Poly>::genCryptoContextBGV(params, encodingParams, 8, stdDev);
+
+	cc->Enable(ENCRYPTION);
+	cc->Enable(SHE);
+
+	LPKeyPair<Poly> kp = cc->KeyGen();
+
+	Plaintext intArray = cc->MakePackedPlaintext(clearVector);
+
+	cc->EvalSumKeyGenBSGS(kp.secretKey, babySteps);
+
+	Ciphertext<Poly> ciphertext = cc->Encrypt(kp.publicKey, intArray);
+
+	auto ciphertextSum = cc->EvalSumBSGS(ciphertext, batchSize, babySteps);
+
+	Plaintext intArrayNew;
+
+	cc->Decrypt(kp.secretKey, ciphertextSum, &intArrayNew);
+
+	return intArrayNew->GetPackedValue()[0];
+}
+
+std::vector<int64_t> BFVrnsEvalSumBSGSPackedArray(std::vector<int64_t> &clearVector, usint batchSize, usint babySteps,
+	std::vector<int64_t> *evalSumResult) {
+
+	PlaintextModulus p = 65537;
+	double sigma = 4;
+	double rootHermiteFactor = 1.006;
+
+	EncodingParams encodingParams(new EncodingParamsImpl(p, batchSize));
+
+	CryptoContext<DCRTPoly> cc = CryptoContextFactory<DCRTPoly>::genCryptoContextBFVrns(
+			encodingParams, rootHermiteFactor, sigma, 0, 1, 0, OPTIMIZED, 2);
+
+	cc->Enable(ENCRYPTION);
+	cc->Enable(SHE);
+
+	LPKeyPair<DCRTPoly> kp = cc->KeyGen();
+
+	Plaintext intArray = cc->MakePackedPlaintext(clearVector);
+
+	Ciphertext<DCRTPoly> ciphertext = cc->Encrypt(kp.publicKey, intArray);
+
+	Plaintext intArrayNew;
+
+	// the keys of EvalSumBSGS only, then with the keys of EvalSum added
+	cc->EvalSumKeyGenBSGS(kp.secretKey, babySteps);
+	cc->Decrypt(kp.secretKey, cc->EvalSumBSGS(ciphertext, clearVector.size(), babySteps), &intArrayNew);
+	std::vector<int64_t> result = intArrayNew->GetPackedValue();
+
+	cc->EvalSumKeyGen(kp.secretKey);
+	cc->Decrypt(kp.secretKey, cc->EvalSum(ciphertext, clearVector.size()), &intArrayNew);
+	*evalSumResult = intArrayNew->GetPackedValue();
+
+	return result;
+}
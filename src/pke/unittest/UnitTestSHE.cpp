@@ -451,6 +451,102 @@ static void UnitTest_EvalAtIndex(const CryptoContext<Element> cc, const string&
 
 GENERATE_TEST_CASES_FUNC_EVALATINDEX(UTSHE, UnitTest_EvalAtIndex, 512, 65537)
 
+template<class Element>
+static void UnitTest_EvalFastRotation(const CryptoContext<Element> cc, const string& failmsg) {
+
+	std::vector<int64_t> vectorOfInts1 = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+
+	// Expected results after evaluating EvalAtIndex(3), EvalAtIndex(-3) and EvalAtIndex(1)
+	std::vector<int64_t> vectorOfIntsPlus3= { 4,5,6,7,8,9,10,11,12,13,14,15,16,0,0,0 };
+	std::vector<int64_t> vectorOfIntsMinus3 = {0,0,0,1,2,3,4,5,6,7,8,9,10,11,12,13};
+	std::vector<int64_t> vectorOfIntsPlus1= { 2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,0 };
+
+	Plaintext intArray1 = cc->MakePackedPlaintext(vectorOfInts1);
+
+	// Initialize the public key containers.
+	LPKeyPair<Element> kp = cc->KeyGen();
+
+	Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, intArray1);
+
+	cc->EvalAtIndexKeyGen(kp.secretKey,{3,-3,1});
+
+	// the digits are computed once for all the rotations
+	auto digits = cc->EvalFastRotationPrecompute(ciphertext1);
+
+	std::vector<int32_t> indices = {3,-3,1};
+	std::vector<std::vector<int64_t>> expected = {vectorOfIntsPlus3, vectorOfIntsMinus3, vectorOfIntsPlus1};
+
+	for (size_t i = 0; i < indices.size(); i++) {
+		Ciphertext<Element> cResult = cc->EvalFastRotation(ciphertext1, indices[i], digits);
+
+		Plaintext results;
+		cc->Decrypt(kp.secretKey, cResult, &results);
+		results->SetLength(expected[i].size());
+		EXPECT_EQ(expected[i], results->GetPackedValue()) << failmsg << " EvalFastRotation(" << indices[i] << ") fails";
+	}
+
+}
+
+GENERATE_TEST_CASES_FUNC_EVALATINDEX(UTSHE, UnitTest_EvalFastRotation, 512, 65537)
+
+template<class Element>
+static void UnitTest_EvalLinearTransform(const CryptoContext<Element> cc, const string& failmsg) {
+
+	const usint dimension = 8;
+
+	std::vector<std::vector<int64_t>> matrix(dimension, std::vector<int64_t>(dimension));
+	for (usint i = 0; i < dimension; i++)
+		for (usint j = 0; j < dimension; j++)
+			matrix[i][j] = (int64_t)((3*i + 5*j) % 7) - 3;
+
+	std::vector<std::vector<int64_t>> diagonals(dimension, std::vector<int64_t>(dimension));
+	for (usint k = 0; k < dimension; k++)
+		for (usint i = 0; i < dimension; i++)
+			diagonals[k][i] = matrix[i][(i + k) % dimension];
+
+	std::vector<int64_t> vectorOfInts = { 1,2,3,4,5,6,7,8 };
+
+	std::vector<int64_t> expected(dimension, 0);
+	for (usint i = 0; i < dimension; i++)
+		for (usint j = 0; j < dimension; j++)
+			expected[i] += matrix[i][j] * vectorOfInts[j];
+
+	// the vector is repeated in all the slots, so that rotations are cyclic in the dimension
+	std::vector<int64_t> repeated(cc->GetRingDimension());
+	for (usint s = 0; s < repeated.size(); s++)
+		repeated[s] = vectorOfInts[s % dimension];
+
+	Plaintext intArray = cc->MakePackedPlaintext(repeated);
+
+	for (usint babySteps : {0, 1, 3, 8}) {
+		LPKeyPair<Element> kp = cc->KeyGen();
+
+		Ciphertext<Element> ciphertext = cc->Encrypt(kp.publicKey, intArray);
+
+		cc->EvalLinearTransformKeyGen(kp.secretKey, dimension, babySteps);
+
+		auto encoded = cc->EvalLinearTransformPrecompute(diagonals, babySteps);
+		Ciphertext<Element> cResult = cc->EvalLinearTransform(ciphertext, encoded);
+
+		Plaintext results;
+		cc->Decrypt(kp.secretKey, cResult, &results);
+		results->SetLength(dimension);
+		EXPECT_EQ(expected, results->GetPackedValue()) << failmsg << " EvalLinearTransform with " << babySteps << " baby steps fails";
+
+		// diagonals with inconsistent baby steps or encoded for other slots are rejected rather than
+		// giving a wrong product
+		LinearTransformDiagonals mismatched(encoded);
+		mismatched.babySteps = dimension + 1;
+		EXPECT_THROW(cc->EvalLinearTransform(ciphertext, mismatched), config_error) << failmsg;
+		mismatched = encoded;
+		mismatched.slots *= 2;
+		EXPECT_THROW(cc->EvalLinearTransform(ciphertext, mismatched), config_error) << failmsg;
+	}
+
+}
+
+GENERATE_TEST_CASES_FUNC_EVALATINDEX(UTSHE, UnitTest_EvalLinearTransform, 512, 65537)
+
 template<class Element>
 static void UnitTest_EvalMerge(const CryptoContext<Element> cc, const string& failmsg) {
 
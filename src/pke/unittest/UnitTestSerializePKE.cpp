@@ -26,6 +26,7 @@
 
 #include "include/gtest/gtest.h"
 #include <iostream>
+#include <fstream>
 
 #include "palisade.h"
 #include "cryptocontext.h"
@@ -171,6 +172,281 @@ TEST_F(UTPKESer, BFVrnsB_DCRTPoly_Serial) {
 	UnitTestContext<DCRTPoly>(cc);
 }
 
+TEST_F(UTPKESer, BFVrns_DCRTPoly_Serial_CenteredBinomial) {
+	CryptoContext<DCRTPoly> cc = GenerateTestDCRTCryptoContext("BFVrns2", 3, 20);
+	std::dynamic_pointer_cast<LPCryptoParametersRLWE<DCRTPoly>>(cc->GetCryptoParameters())->SetNoiseDistribution(CENTERED_BINOMIAL);
+	UnitTestContext<DCRTPoly>(cc);
+}
+
+// with seeded uniform components, keys and ciphertexts are serialized with a seed in place of their
+// uniform component, which is expanded again after deserialization
+template<typename T>
+void UnitTestSeededUniform(CryptoContext<T> cc) {
+	std::dynamic_pointer_cast<LPCryptoParametersRLWE<T>>(cc->GetCryptoParameters())->SetSeededUniform(true);
+
+	LPKeyPair<T> kp = cc->KeyGen();
+	cc->EvalMultKeyGen(kp.secretKey);
+	EXPECT_TRUE( kp.publicKey->GetUniformSeed().IsSet() ) << "Public key not seeded";
+
+	vector<int64_t> vals = { 1,0,1,1,0,1,0,0,1,1 };
+	Plaintext plaintext = cc->MakeCoefPackedPlaintext( vals );
+	Ciphertext<T> ciphertext = cc->Encrypt(kp.secretKey, plaintext);
+	EXPECT_TRUE( ciphertext->GetUniformSeed().IsSet() ) << "Ciphertext not seeded";
+
+	Plaintext product;
+	cc->Decrypt(kp.secretKey, cc->EvalMult(ciphertext, ciphertext), &product);
+
+	// the objects are deserialized in place: encoding a plaintext for DCRTPoly changes the element
+	// parameters of the context, so a context deserialized from them would not match
+	Serialized pser;
+	pser.SetObject();
+	ASSERT_TRUE( kp.publicKey->Serialize(&pser) ) << "Public key serialization failed";
+	EXPECT_TRUE( pser.HasMember("UniformSeed") ) << "Public key serialized without seed";
+
+	LPPublicKey<T> newPK(new LPPublicKeyImpl<T>(cc));
+	ASSERT_TRUE( newPK->Deserialize(pser) ) << "Public key deserialization failed";
+	EXPECT_EQ( *kp.publicKey, *newPK ) << "Public key mismatch after ser/deser";
+
+	Serialized ser;
+	ser.SetObject();
+	ASSERT_TRUE( ciphertext->Serialize(&ser) ) << "Ciphertext serialization failed";
+	EXPECT_TRUE( ser.HasMember("UniformSeed") ) << "Ciphertext serialized without seed";
+
+	Serialized kser;
+	kser.SetObject();
+	ASSERT_TRUE( cc->GetEvalMultKeyVector(kp.secretKey->GetKeyTag())[0]->Serialize(&kser) ) << "EvalMult key serialization failed";
+	EXPECT_TRUE( kser.HasMember("UniformSeed") ) << "EvalMult key serialized without seed";
+
+	cc->ClearEvalMultKeys();
+
+	Ciphertext<T> newC(new CiphertextImpl<T>(cc));
+	ASSERT_TRUE( newC->Deserialize(ser) ) << "Ciphertext deserialization failed";
+	EXPECT_EQ( *ciphertext, *newC ) << "Ciphertext mismatch after ser/deser";
+
+	LPEvalKeyRelin<T> newKey(new LPEvalKeyRelinImpl<T>(cc));
+	ASSERT_TRUE( newKey->Deserialize(kser) ) << "EvalMult key deserialization failed";
+	cc->InsertEvalMultKey({newKey});
+
+	Plaintext newProduct;
+	cc->Decrypt(kp.secretKey, cc->EvalMult(newC, newC), &newProduct);
+	EXPECT_EQ( *product, *newProduct ) << "EvalMult with deserialized key and ciphertext failed";
+}
+
+TEST_F(UTPKESer, BFV_Poly_Serial_SeededUniform) {
+	UnitTestSeededUniform<Poly>(GenerateTestCryptoContext("BFV2"));
+}
+
+TEST_F(UTPKESer, BGV_Poly_Serial_SeededUniform) {
+	UnitTestSeededUniform<Poly>(GenerateTestCryptoContext("BGV2"));
+}
+
+TEST_F(UTPKESer, BFVrns_DCRTPoly_Serial_SeededUniform) {
+	UnitTestSeededUniform<DCRTPoly>(GenerateTestDCRTCryptoContext("BFVrns2", 3, 20));
+}
+
+template<typename T>
+void UnitTestBinary(CryptoContext<T> cc, bool seeded) {
+	std::dynamic_pointer_cast<LPCryptoParametersRLWE<T>>(cc->GetCryptoParameters())->SetSeededUniform(seeded);
+
+	LPKeyPair<T> kp = cc->KeyGen();
+	cc->EvalMultKeyGen(kp.secretKey);
+	LPEvalKey<T> ek = cc->GetEvalMultKeyVector(kp.secretKey->GetKeyTag())[0];
+
+	{
+		std::stringstream ss;
+		cc->SerializeBinary(ss);
+		CryptoContext<T> newcc = CryptoContextFactory<T>::DeserializeAndCreateContextBinary(ss);
+		EXPECT_EQ( cc, newcc ) << "Context mismatch after binary ser/deser";
+	}
+
+	{
+		std::stringstream ss;
+		kp.publicKey->SerializeBinary(ss);
+		LPPublicKey<T> newPK = CryptoContextImpl<T>::deserializePublicKeyBinary(ss);
+		EXPECT_EQ( *kp.publicKey, *newPK ) << "Public key mismatch after binary ser/deser";
+
+		Serialized ser;
+		ser.SetObject();
+		string json;
+		ASSERT_TRUE( kp.publicKey->Serialize(&ser) ) << "Public key serialization failed";
+		SerializableHelper::SerializationToString(ser, json);
+		EXPECT_LT( ss.str().size(), json.size() ) << "Binary public key is not compact";
+	}
+
+	{
+		std::stringstream ss;
+		kp.secretKey->SerializeBinary(ss);
+		LPPrivateKey<T> newSK = CryptoContextImpl<T>::deserializeSecretKeyBinary(ss);
+		EXPECT_EQ( *kp.secretKey, *newSK ) << "Secret key mismatch after binary ser/deser";
+	}
+
+	{
+		std::stringstream ss;
+		ek->SerializeBinary(ss);
+		LPEvalKey<T> newEK = CryptoContextImpl<T>::deserializeEvalKeyBinary(ss);
+		EXPECT_EQ( *ek, *newEK ) << "EvalMult key mismatch after binary ser/deser";
+	}
+
+	vector<int64_t> vals = { 1,0,1,1,0,1,0,0,1,1 };
+	Plaintext plaintext = cc->MakeCoefPackedPlaintext( vals );
+	Ciphertext<T> ciphertext = cc->Encrypt(kp.publicKey, plaintext);
+
+	// encoding a plaintext for DCRTPoly changes the element parameters of the context, so the
+	// ciphertext is written without its context and deserialized in place
+	std::stringstream ss;
+	BinaryWriter writer(BINARY_CIPHERTEXT);
+	ciphertext->SerializeBinaryWithoutContext(writer);
+	writer.WriteTo(ss);
+
+	BinaryReader reader(ss, BINARY_CIPHERTEXT);
+	Ciphertext<T> newC(new CiphertextImpl<T>(cc));
+	newC->DeserializeBinary(reader);
+	EXPECT_TRUE( reader.AtEnd() ) << "Ciphertext not entirely read";
+	EXPECT_EQ( *ciphertext, *newC ) << "Ciphertext mismatch after binary ser/deser";
+
+	Plaintext decrypted;
+	cc->Decrypt(kp.secretKey, newC, &decrypted);
+	decrypted->SetLength(plaintext->GetLength());
+	EXPECT_EQ( *plaintext, *decrypted ) << "Decryption of the deserialized ciphertext failed";
+}
+
+TEST_F(UTPKESer, BFV_Poly_Binary) {
+	UnitTestBinary<Poly>(GenerateTestCryptoContext("BFV2"), false);
+}
+
+TEST_F(UTPKESer, BFV_Poly_Binary_SeededUniform) {
+	UnitTestBinary<Poly>(GenerateTestCryptoContext("BFV2"), true);
+}
+
+TEST_F(UTPKESer, BFVrns_DCRTPoly_Binary) {
+	UnitTestBinary<DCRTPoly>(GenerateTestDCRTCryptoContext("BFVrns2", 3, 20), false);
+}
+
+TEST_F(UTPKESer, BFVrns_DCRTPoly_Binary_SeededUniform) {
+	UnitTestBinary<DCRTPoly>(GenerateTestDCRTCryptoContext("BFVrns2", 3, 20), true);
+}
+
+TEST_F(UTPKESer, Binary_Ciphertext_With_Context) {
+	CryptoContext<Poly> cc = GenerateTestCryptoContext("BFV2");
+	LPKeyPair<Poly> kp = cc->KeyGen();
+
+	vector<int64_t> vals = { 1,0,1,1,0,1,0,0,1,1 };
+	Plaintext plaintext = cc->MakeCoefPackedPlaintext( vals );
+	Ciphertext<Poly> ciphertext = cc->Encrypt(kp.publicKey, plaintext);
+
+	std::stringstream ss;
+	ciphertext->SerializeBinary(ss);
+	string binary = ss.str();
+	Ciphertext<Poly> newC = CryptoContextImpl<Poly>::deserializeCiphertextBinary(ss);
+	EXPECT_EQ( *ciphertext, *newC ) << "Ciphertext mismatch after binary ser/deser";
+
+	// objects of another type or truncated objects are rejected
+	std::stringstream wrongType(binary);
+	EXPECT_THROW( CryptoContextImpl<Poly>::deserializePublicKeyBinary(wrongType), deserialize_error );
+	std::stringstream truncated(binary.substr(0, binary.size() - 1));
+	EXPECT_THROW( CryptoContextImpl<Poly>::deserializeCiphertextBinary(truncated), deserialize_error );
+}
+
+static void UnitTestEvalKeyStore(CryptoContext<DCRTPoly> cc, bool seeded) {
+	std::dynamic_pointer_cast<LPCryptoParametersRLWE<DCRTPoly>>(cc->GetCryptoParameters())->SetSeededUniform(seeded);
+
+	LPKeyPair<DCRTPoly> kp = cc->KeyGen();
+	const string keyTag = kp.secretKey->GetKeyTag();
+	cc->EvalMultKeyGen(kp.secretKey);
+	auto automorphismKeys = cc->EvalAutomorphismKeyGen(kp.secretKey, {3, 5, 7});
+	CryptoContextImpl<DCRTPoly>::InsertEvalAutomorphismKey(automorphismKeys);
+	LPEvalKey<DCRTPoly> multKey = cc->GetEvalMultKeyVector(keyTag)[0];
+
+	const string filename = "UnitTestEvalKeyStore.bin";
+	{
+		std::ofstream out(filename, std::ios::binary);
+		CryptoContextImpl<DCRTPoly>::SerializeEvalKeyStore(out, cc);
+	}
+
+	CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+	CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+
+	CryptoContext<DCRTPoly> newcc = CryptoContextImpl<DCRTPoly>::DeserializeEvalKeyStore(filename);
+	std::remove(filename.c_str());
+	EXPECT_EQ( cc, newcc ) << "Context mismatch after loading the key store";
+
+	const std::map<usint, LPEvalKey<DCRTPoly>> &newKeys = CryptoContextImpl<DCRTPoly>::GetEvalAutomorphismKeyMap(keyTag);
+	ASSERT_EQ( automorphismKeys->size(), newKeys.size() ) << "Key store is missing automorphism keys";
+	for( const auto &k : newKeys )
+		EXPECT_TRUE( std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(k.second)->IsDeferred() ) << "Key read before its first use";
+
+	// only the keys used are read from the store
+	EXPECT_EQ( *automorphismKeys->at(5), *newKeys.at(5) ) << "Automorphism key mismatch after loading the key store";
+	EXPECT_FALSE( std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(newKeys.at(5))->IsDeferred() );
+	EXPECT_TRUE( std::static_pointer_cast<LPEvalKeyRelinImpl<DCRTPoly>>(newKeys.at(3))->IsDeferred() );
+
+	LPEvalKey<DCRTPoly> newMultKey = CryptoContextImpl<DCRTPoly>::GetEvalMultKeyVector(keyTag)[0];
+	EXPECT_EQ( keyTag, newMultKey->GetKeyTag() ) << "Key tag mismatch before the key is read";
+
+	vector<int64_t> vals = { 1,0,1,1,0,1,0,0,1,1 };
+	Plaintext plaintext = cc->MakeCoefPackedPlaintext( vals );
+	Ciphertext<DCRTPoly> ciphertext = cc->Encrypt(kp.publicKey, plaintext);
+	Plaintext product;
+	cc->Decrypt(kp.secretKey, cc->EvalMult(ciphertext, ciphertext), &product);
+
+	Plaintext expected;
+	CryptoContextImpl<DCRTPoly>::InsertEvalMultKey({multKey});
+	cc->Decrypt(kp.secretKey, cc->EvalMult(ciphertext, ciphertext), &expected);
+	EXPECT_EQ( *expected, *product ) << "EvalMult with a key from the key store failed";
+
+	// an EvalMult key index beyond the entries is rejected before anything is allocated for it
+	std::stringstream store;
+	CryptoContextImpl<DCRTPoly>::SerializeEvalKeyStore(store, cc);
+	string corrupt = store.str();
+	size_t tagPosition = corrupt.find(keyTag);
+	ASSERT_NE( string::npos, tagPosition );
+	corrupt.replace(tagPosition + keyTag.size(), 4, 4, '\xff');
+	{
+		std::ofstream out(filename, std::ios::binary);
+		out << corrupt;
+	}
+	EXPECT_THROW( CryptoContextImpl<DCRTPoly>::DeserializeEvalKeyStore(filename), deserialize_error );
+	std::remove(filename.c_str());
+
+	CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+}
+
+TEST_F(UTPKESer, BFVrns_DCRTPoly_EvalKeyStore) {
+	UnitTestEvalKeyStore(GenerateTestDCRTCryptoContext("BFVrns2", 3, 20), false);
+}
+
+TEST_F(UTPKESer, BFVrns_DCRTPoly_EvalKeyStore_SeededUniform) {
+	UnitTestEvalKeyStore(GenerateTestDCRTCryptoContext("BFVrns2", 3, 20), true);
+}
+
+TEST_F(UTPKESer, Ciphertexts_Stream) {
+	CryptoContext<Poly> cc = GenerateTestCryptoContext("BFV2");
+	LPKeyPair<Poly> kp = cc->KeyGen();
+
+	vector<Ciphertext<Poly>> ciphertexts;
+	for( int64_t i = 0; i < 4; i++ ) {
+		vector<int64_t> vals = { i,1,0,1,1,0,1,0,0,i };
+		ciphertexts.push_back( cc->Encrypt(kp.publicKey, cc->MakeCoefPackedPlaintext(vals)) );
+	}
+
+	Serialized ser;
+	ASSERT_TRUE( CryptoContextImpl<Poly>::SerializeCiphertexts(&ser, ciphertexts) ) << "Ciphertexts serialization failed";
+	std::stringstream ss;
+	SerializableHelper::SerializationToStream(ser, ss);
+
+	vector<Ciphertext<Poly>> newCiphertexts;
+	ASSERT_TRUE( CryptoContextImpl<Poly>::DeserializeCiphertexts(ss, &newCiphertexts) ) << "Ciphertexts stream deserialization failed";
+	ASSERT_EQ( ciphertexts.size(), newCiphertexts.size() ) << "Ciphertexts missing after stream deserialization";
+	for( size_t i = 0; i < ciphertexts.size(); i++ )
+		EXPECT_EQ( *ciphertexts[i], *newCiphertexts[i] ) << "Ciphertext mismatch after stream deserialization";
+
+	// truncated streams are rejected
+	std::string json;
+	SerializableHelper::SerializationToString(ser, json);
+	std::stringstream truncated(json.substr(0, json.size()/2));
+	EXPECT_FALSE( CryptoContextImpl<Poly>::DeserializeCiphertexts(truncated, &newCiphertexts) );
+}
+
 // REMAINDER OF THE TESTS USE BGV AS A REPRESENTITIVE CONTEXT
 TEST_F(UTPKESer, Keys_and_ciphertext) {
         bool dbg_flag = false;
@@ -350,6 +626,34 @@ TEST_F(UTPKESer, Keys_and_ciphertext) {
 	EXPECT_EQ(CryptoContextFactory<Poly>::GetContextCount(), 2) << "all-key deser, context";
 	EXPECT_EQ(cc->GetAllEvalSumKeys().size(), 2U) << "all-key deser, keys";
 
+	// test streaming deserialize, against the keys deserialized above; the contexts are kept
+	// so that the keys can be compared
+	auto sumKeys = cc->GetAllEvalSumKeys();
+	cc->ClearEvalSumKeys();
+	cc->DeserializeEvalMultKey(ser3);
+	auto multKeys = cc->GetAllEvalMultKeys();
+
+	std::stringstream mstream, sstream;
+	SerializableHelper::SerializationToStream(ser3, mstream);
+	SerializableHelper::SerializationToStream(aser3, sstream);
+
+	cc->ClearEvalMultKeys();
+	cc->ClearEvalSumKeys();
+	EXPECT_TRUE(cc->DeserializeEvalMultKey(mstream)) << "all-key stream deser";
+	EXPECT_EQ(CryptoContextFactory<Poly>::GetContextCount(), 2) << "all-key stream deser, context";
+	ASSERT_EQ(cc->GetAllEvalMultKeys().size(), 3U) << "all-key stream deser, keys";
+	for( const auto& k : multKeys )
+		EXPECT_EQ(*k.second[0], *cc->GetEvalMultKeyVector(k.first)[0]) << "mult key mismatch after stream deser";
+
+	cc->ClearEvalMultKeys();
+	cc->ClearEvalSumKeys();
+	EXPECT_TRUE(cc->DeserializeEvalSumKey(sstream)) << "all-key stream deser";
+	EXPECT_EQ(CryptoContextFactory<Poly>::GetContextCount(), 2) << "all-key stream deser, context";
+	ASSERT_EQ(cc->GetAllEvalSumKeys().size(), 2U) << "all-key stream deser, keys";
+	for( const auto& k : sumKeys )
+		for( const auto& key : *k.second )
+			EXPECT_EQ(*key.second, *cc->GetEvalSumKeyMap(k.first).at(key.first)) << "sum key mismatch after stream deser";
+
 	// FIXME add tests to delete one context worth of keys, or a single key
 
 